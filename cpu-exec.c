@@ -47,6 +47,7 @@ const int has_llvm_engine = 1;
 int generate_llvm = 0;
 int execute_llvm = 0;
 extern bool panda_tb_chaining;
+extern bool panda_bypass_llvm_block;
 
 /* -icount align implementation. */
 
@@ -184,6 +185,8 @@ static inline tcg_target_ulong cpu_tb_exec(CPUState *cpu, TranslationBlock *itb)
 
     cpu->can_do_io = !use_icount;
 
+    // before_block_exec may ask for the TCG translation of this block
+    panda_bypass_llvm_block = false;
     if (!panda_exit_loop)
         panda_callbacks_before_block_exec(cpu, itb);
 
@@ -201,7 +204,7 @@ static inline tcg_target_ulong cpu_tb_exec(CPUState *cpu, TranslationBlock *itb)
     panda_bb_invalidate_done = false;
 
 #if defined(CONFIG_LLVM)
-    if (execute_llvm) {
+    if (execute_llvm && !(panda_llvm_bypass && panda_bypass_llvm_block)) {
         assert(itb->llvm_tc_ptr);
         ret = tcg_llvm_qemu_tb_exec(env, itb);
     } else {
@@ -389,6 +392,21 @@ static TranslationBlock *tb_htable_lookup(CPUState *cpu,
     return qht_lookup(&tcg_ctx.tb_ctx.htable, tb_cmp, &desc, h);
 }
 
+#ifdef CONFIG_SOFTMMU
+/* Chained TBs run without coming back to cpu_exec.  During replay each TB
+ * checks rr_chain_budget itself (see gen_tb_start), so chains still stop
+ * before the next interrupt or main loop log entry, but they skip the
+ * block callbacks and the debugging checks done here.  */
+static inline bool rr_replay_can_chain(CPUState *cpu)
+{
+    return panda_tb_chaining
+        && !panda_block_callbacks_enabled()
+        && QTAILQ_EMPTY(&cpu->breakpoints)
+        && !cpu->singlestep_enabled
+        && !cpu->temp_rr_bp_instr;
+}
+#endif
+
 static inline TranslationBlock *tb_find(CPUState *cpu,
                                         TranslationBlock *last_tb,
                                         int tb_exit)
@@ -445,7 +463,7 @@ static inline TranslationBlock *tb_find(CPUState *cpu,
 #endif
     /* See if we can patch the calling TB. */
 #ifdef CONFIG_SOFTMMU
-    if (!rr_in_replay() && panda_tb_chaining) {
+    if (rr_in_replay() ? rr_replay_can_chain(cpu) : panda_tb_chaining) {
 #endif
     if (last_tb && !qemu_loglevel_mask(CPU_LOG_TB_NOCHAIN)) {
         if (!have_tb_lock) {
@@ -861,6 +879,16 @@ int cpu_exec(CPUState *cpu)
             }
 
             if (!rr_in_replay() || until_interrupt > 0) {
+#ifdef CONFIG_SOFTMMU
+                if (rr_in_replay()) {
+                    /* Without chaining, only this TB may run. */
+                    cpu->rr_chain_budget = rr_replay_can_chain(cpu)
+                        ? MIN(until_interrupt, INT32_MAX) : tb->icount;
+                } else {
+                    /* Replay TBs not yet flushed mustn't stall live runs. */
+                    cpu->rr_chain_budget = INT32_MAX;
+                }
+#endif
                 cpu_loop_exec_tb(cpu, tb, &last_tb, &tb_exit, &sc);
                 /* Try to align the host and virtual clocks
                    if the guest is in advance */
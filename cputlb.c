@@ -35,6 +35,7 @@
 #include "panda/rr/rr_log_all.h"
 #include "panda/rr/rr_log.h"
 #include "panda/callbacks/cb-support.h"
+#include "panda/plugin.h"
 
 /* DEBUG defines, enable DEBUG_TLB_LOG to log to the CPU_LOG_MMU target */
 /* #define DEBUG_TLB */
@@ -107,6 +108,8 @@ static void tlb_flush_nocheck(CPUState *cpu)
 {
     CPUArchState *env = cpu->env_ptr;
 
+    panda_v2p_cache_flush(cpu);
+
     /* The QOM tests will trigger tlb_flushes without setting up TCG
      * so we bug out here in that case.
      */
@@ -172,6 +175,8 @@ static void tlb_flush_by_mmuidx_async_work(CPUState *cpu, run_on_cpu_data data)
 
     assert_cpu_is_self(cpu);
 
+    panda_v2p_cache_flush(cpu);
+
     tb_lock();
 
     tlb_debug("start: mmu_idx:0x%04lx\n", mmu_idx_bitmask);
@@ -271,6 +276,7 @@ static void tlb_flush_page_async_work(CPUState *cpu, run_on_cpu_data data)
     }
 
     addr &= TARGET_PAGE_MASK;
+    panda_v2p_cache_flush_page(cpu, addr);
     i = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
         tlb_flush_entry(&env->tlb_table[mmu_idx][i], addr);
@@ -320,6 +326,8 @@ static void tlb_flush_page_by_mmuidx_async_work(CPUState *cpu,
     tlb_debug("page:%d addr:"TARGET_FMT_lx" mmu_idx:0x%lx\n",
               page, addr, mmu_idx_bitmap);
 
+    panda_v2p_cache_flush_page(cpu, addr);
+
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
         if (test_bit(mmu_idx, &mmu_idx_bitmap)) {
             tlb_flush_entry(&env->tlb_table[mmu_idx][page], addr);
@@ -543,8 +551,8 @@ void tlb_reset_dirty(CPUState *cpu, ram_addr_t start1, ram_addr_t length)
 
 static inline void tlb_set_dirty1(CPUTLBEntry *tlb_entry, target_ulong vaddr)
 {
-    if (tlb_entry->addr_write == (vaddr | TLB_NOTDIRTY)) {
-        tlb_entry->addr_write = vaddr;
+    if ((tlb_entry->addr_write & ~TLB_PANDA_WATCH) == (vaddr | TLB_NOTDIRTY)) {
+        tlb_entry->addr_write &= ~TLB_NOTDIRTY;
     }
 }
 
@@ -658,6 +666,7 @@ void tlb_set_page_with_attrs(CPUState *cpu, target_ulong vaddr,
     /* refill the tlb */
     env->iotlb[mmu_idx][index].addr = iotlb - vaddr;
     env->iotlb[mmu_idx][index].attrs = attrs;
+    env->iotlb[mmu_idx][index].panda_paddr = paddr & TARGET_PAGE_MASK;
 
     /* Now calculate the new entry */
     tn.addend = addend - vaddr;
@@ -688,6 +697,18 @@ void tlb_set_page_with_attrs(CPUState *cpu, target_ulong vaddr,
         }
     }
 
+    /* PANDA: divert accesses to watched pages to the memcb helpers */
+    if (unlikely(panda_memcb_watching)) {
+        int kinds = panda_memcb_page_watched(vaddr & TARGET_PAGE_MASK,
+                                             paddr & TARGET_PAGE_MASK);
+        if ((kinds & PANDA_MEMCB_READ) && tn.addr_read != -1) {
+            tn.addr_read |= TLB_PANDA_WATCH;
+        }
+        if ((kinds & PANDA_MEMCB_WRITE) && tn.addr_write != -1) {
+            tn.addr_write |= TLB_PANDA_WATCH;
+        }
+    }
+
     /* Pairs with flag setting in tlb_reset_dirty_range */
     copy_tlb_helper(te, &tn, true);
     /* atomic_mb_set(&te->addr_write, write_address); */
@@ -946,14 +967,15 @@ static void *atomic_mmu_lookup(CPUArchState *env, target_ulong addr,
     }
 
     /* Notice an IO access, or a notdirty page.  */
-    if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
+    if (unlikely(tlb_addr & ~(TARGET_PAGE_MASK | TLB_PANDA_WATCH))) {
         /* There's really nothing that can be done to
            support this apart from stop-the-world.  */
         goto stop_the_world;
     }
 
     /* Let the guest notice RMW on a write-only page.  */
-    if (unlikely(tlbe->addr_read != tlb_addr)) {
+    if (unlikely((tlbe->addr_read & ~TLB_PANDA_WATCH)
+                 != (tlb_addr & ~TLB_PANDA_WATCH))) {
         tlb_fill(ENV_GET_CPU(env), addr, MMU_DATA_LOAD, mmu_idx, retaddr);
         /* Since we don't support reads and writes to different addresses,
            and we do have the proper page loaded for write, this shouldn't
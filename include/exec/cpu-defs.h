@@ -127,6 +127,7 @@ QEMU_BUILD_BUG_ON(sizeof(CPUTLBEntry) != (1 << CPU_TLB_ENTRY_BITS));
 typedef struct CPUIOTLBEntry {
     hwaddr addr;
     MemTxAttrs attrs;
+    hwaddr panda_paddr; /* guest physical address of the page */
 } CPUIOTLBEntry;
 
 #define CPU_COMMON_TLB \
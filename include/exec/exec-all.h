@@ -566,6 +566,7 @@ extern CPUState *tcg_current_cpu;
 extern bool exit_request;
 
 extern int generate_llvm;
+extern bool panda_llvm_bypass;
 extern int execute_llvm;
 extern const int has_llvm_engine;
 
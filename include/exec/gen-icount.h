@@ -2,12 +2,14 @@
 #define GEN_ICOUNT_H
 
 #include "qemu/timer.h"
+#include "panda/rr/rr_api.h"
 
 /* Helpers for instruction counting code generation.  */
 
 static int icount_start_insn_idx;
 static TCGLabel *icount_label;
 static TCGLabel *exitreq_label;
+static int rr_chain_insn_idx = -1;
 
 static inline void gen_tb_start(TranslationBlock *tb)
 {
@@ -20,6 +22,27 @@ static inline void gen_tb_start(TranslationBlock *tb)
     tcg_gen_brcondi_i32(TCG_COND_NE, flag, 0, exitreq_label);
     tcg_temp_free_i32(flag);
 
+    /* In replay a TB may be reached through a chained jump, so it has to
+       check itself that it ends before the next interrupt or main loop log
+       entry: take its insn count from rr_chain_budget, or leave the chain
+       without running if that would go negative.  The main loop sets the
+       budget before entering a chain.  */
+    rr_chain_insn_idx = -1;
+    if (rr_in_replay() && !(tb->cflags & CF_NOCACHE)) {
+        TCGv_i32 budget = tcg_temp_local_new_i32();
+        tcg_gen_ld_i32(budget, cpu_env,
+                       -ENV_OFFSET + offsetof(CPUState, rr_chain_budget));
+        imm = tcg_temp_new_i32();
+        rr_chain_insn_idx = tcg_op_buf_count();
+        tcg_gen_movi_i32(imm, 0xdeadbeef);
+        tcg_gen_sub_i32(budget, budget, imm);
+        tcg_temp_free_i32(imm);
+        tcg_gen_brcondi_i32(TCG_COND_LT, budget, 0, exitreq_label);
+        tcg_gen_st_i32(budget, cpu_env,
+                       -ENV_OFFSET + offsetof(CPUState, rr_chain_budget));
+        tcg_temp_free_i32(budget);
+    }
+
     if (!(tb->cflags & CF_USE_ICOUNT)) {
         return;
     }
@@ -50,6 +73,10 @@ static void gen_tb_end(TranslationBlock *tb, int num_insns)
     gen_set_label(exitreq_label);
     tcg_gen_exit_tb((uintptr_t)tb + TB_EXIT_REQUESTED);
 
+    if (rr_chain_insn_idx >= 0) {
+        tcg_set_insn_param(rr_chain_insn_idx, 1, num_insns);
+    }
+
     if (tb->cflags & CF_USE_ICOUNT) {
         /* Update the num_insn immediate parameter now that we know
          * the actual insn count.  */
@@ -392,6 +392,10 @@ struct CPUState {
     int32_t exception_index; /* used by m68k TCG */
     uint64_t rr_guest_instr_count;
     vaddr panda_guest_pc;
+    // Translations used by PANDA's guest memory accessors (panda/common.h)
+    struct PandaV2PCache *panda_v2p_cache;
+    // Instructions chained TBs may still run in replay (see gen_tb_start)
+    int32_t rr_chain_budget;
 
     // Used for rr reverse debugging
     uint8_t reverse_flags;
@@ -133,6 +133,7 @@ void qemu_savevm_send_postcopy_ram_discard(QEMUFile *f, const char *name,
 
 int qemu_loadvm_state(QEMUFile *f);
 int qemu_savevm_state(QEMUFile *f, Error **errp);
+int qemu_save_device_state(QEMUFile *f);
 
 extern int autostart;
 
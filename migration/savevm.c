@@ -1286,12 +1286,13 @@ done:
     return ret;
 }
 
-static int qemu_save_device_state(QEMUFile *f)
+int qemu_save_device_state(QEMUFile *f)
 {
     SaveStateEntry *se;
 
-    qemu_put_be32(f, QEMU_VM_FILE_MAGIC);
-    qemu_put_be32(f, QEMU_VM_FILE_VERSION);
+    /* PANDA: checkpoints load this with qemu_loadvm_state, which wants the
+     * configuration section whenever it is enabled */
+    qemu_savevm_state_header(f);
 
     cpu_synchronize_all_states();
 
@@ -0,0 +1,71 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#pragma once
+/*!
+ * @file cb-dispatch.h
+ * @brief Dense per-type callback dispatch tables.
+ *
+ * `panda_cbs` stays the authoritative list of registered callbacks. Every
+ * time a callback is registered, unregistered, enabled or disabled, the
+ * table for its type is rebuilt as a contiguous array holding only the
+ * enabled callbacks, so dispatching never walks the list or tests
+ * `enabled`. `panda_cb_any()` is the zero-callback check hot paths (e.g.
+ * the TCG front ends) can test inline before calling into cb-support.c.
+ */
+#include "qemu/timer.h"
+#include "panda/plugin.h"
+
+typedef struct panda_cb_slot {
+    panda_cb entry;
+    panda_cb_list *node;    // for per-callback accounting
+} panda_cb_slot;
+
+typedef struct panda_cb_table {
+    panda_cb_slot *slots;   // enabled callbacks, in registration order
+    int num;
+    uint64_t calls;         // dispatches that ran at least one callback
+    uint64_t ticks;         // host ticks spent in callbacks (profiling only)
+} panda_cb_table;
+
+extern panda_cb_table panda_cb_tables[PANDA_CB_LAST];
+
+// Set by -panda-cb-stats: time every callback and dump the totals at exit.
+extern bool panda_cb_profiling;
+
+static inline bool panda_cb_any(panda_cb_type type) {
+    return panda_cb_tables[type].num != 0;
+}
+
+void panda_cb_table_rebuild(panda_cb_type type);
+void panda_cb_account(panda_cb_table *table, panda_cb_slot *slot,
+                      int64_t start);
+void panda_cb_free_retired(void);
+void panda_cb_stats_dump(FILE *f);
+
+// Run stmt once for each enabled callback of the given type, with `slot`
+// pointing at its panda_cb_slot. The table is snapshotted first: callbacks
+// that register, enable or disable callbacks take effect from the next
+// dispatch (the old array stays valid until panda_cb_free_retired).
+#define PANDA_CB_DISPATCH(type, stmt) do { \
+        panda_cb_table *_table = &panda_cb_tables[type]; \
+        panda_cb_slot *_slots = _table->slots; \
+        int _num = _table->num; \
+        if (_num == 0) { \
+            break; \
+        } \
+        _table->calls++; \
+        for (int _i = 0; _i < _num; _i++) { \
+            panda_cb_slot *slot = &_slots[_i]; \
+            if (unlikely(panda_cb_profiling)) { \
+                int64_t _start = cpu_get_host_ticks(); \
+                stmt; \
+                panda_cb_account(_table, slot, _start); \
+            } else { \
+                stmt; \
+            } \
+        } \
+    } while (0)
@@ -14,21 +14,17 @@ PANDAENDCOMMENT */
 #pragma once
 #include "panda/callbacks/cb-support.h"
 #include "panda/plugin.h"
+#include "panda/callbacks/cb-dispatch.h"
 
 void HELPER(panda_insn_exec)(target_ulong pc) {
     // PANDA instrumentation: before basic block
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.insn_exec(first_cpu, pc);
-    }
+    PANDA_CB_DISPATCH(PANDA_CB_INSN_EXEC, slot->entry.insn_exec(first_cpu, pc));
 }
 
 void HELPER(panda_after_insn_exec)(target_ulong pc) {
     // PANDA instrumentation: after basic block
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_AFTER_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_insn_exec(first_cpu, pc);
-    }
+    PANDA_CB_DISPATCH(PANDA_CB_AFTER_INSN_EXEC,
+                      slot->entry.after_insn_exec(first_cpu, pc));
 }
 
 #if defined(TARGET_ARM)
@@ -1,5 +1,7 @@
 // Macros to help with cb-support.c
 
+#include "panda/callbacks/cb-dispatch.h"
+
 // The COMBINE_TYPES series of macros will combine a list of
 // (type1, var1, type2, var2, ...) into (type1 var1, type2 var2...)
 // Supports up to 10 elements (5 pairs)
@@ -50,13 +52,8 @@
 // Call all enabled & registered functions for this callback. Return void
 #define MAKE_CALLBACK_void(name_upper, name, ...) \
     void panda_callbacks_ ## name(COMBINE_TYPES(__VA_ARGS__)) { \
-        panda_cb_list *plist; \
-        for (plist = panda_cbs[PANDA_CB_ ## name_upper]; \
-             plist != NULL; \
-             plist = panda_cb_list_next(plist)) { \
-              if (plist->enabled) \
-                plist->entry. ENTRY_NAME(name, EVERY_SECOND(__VA_ARGS__)); \
-        } \
+        PANDA_CB_DISPATCH(PANDA_CB_ ## name_upper, \
+            slot->entry. ENTRY_NAME(name, EVERY_SECOND(__VA_ARGS__))); \
     }
 
 // Call all enabled & registered functions for this callback. Return
@@ -64,14 +61,9 @@
 // XXX: double underscore in name is intentional
 #define MAKE_CALLBACK__Bool(name_upper, name, ...) \
     bool panda_callbacks_ ## name(COMBINE_TYPES(__VA_ARGS__)) { \
-        panda_cb_list *plist; \
         bool any_true = false; \
-        for (plist = panda_cbs[PANDA_CB_ ## name_upper]; \
-             plist != NULL; \
-             plist = panda_cb_list_next(plist)) { \
-              if (plist->enabled) \
-                any_true |= plist->entry. ENTRY_NAME(name, EVERY_SECOND(__VA_ARGS__)); \
-        } \
+        PANDA_CB_DISPATCH(PANDA_CB_ ## name_upper, \
+            any_true |= slot->entry. ENTRY_NAME(name, EVERY_SECOND(__VA_ARGS__))); \
         return any_true; \
     }
 
@@ -89,12 +81,7 @@
 #define MAKE_REPLAY_ONLY_CALLBACK(name_upper, name, ...) \
     void panda_callbacks_ ## name(COMBINE_TYPES(__VA_ARGS__)) { \
         if (rr_in_replay()) { \
-          panda_cb_list *plist; \
-          for (plist = panda_cbs[PANDA_CB_ ## name_upper]; \
-               plist != NULL; \
-               plist = panda_cb_list_next(plist)) { \
-                if (plist->enabled) \
-                  plist->entry. ENTRY_NAME(name, EVERY_SECOND(__VA_ARGS__)); \
-          } \
+            PANDA_CB_DISPATCH(PANDA_CB_ ## name_upper, \
+                slot->entry. ENTRY_NAME(name, EVERY_SECOND(__VA_ARGS__))); \
         } \
     }
@@ -14,11 +14,16 @@ typedef struct Checkpoint {
 
     size_t memfd_usage;
 
+    uint32_t seq;      // order taken, unique
+    uint64_t *pages;   // RAM pages that changed since the previous checkpoint
+    size_t num_pages;
+    size_t max_pages;
+
     QLIST_ENTRY(Checkpoint) next;
 } Checkpoint;
 
-#define MAX_CHECKPOINTS 256
-extern Checkpoint* checkpoints[MAX_CHECKPOINTS];
+// in instruction count order
+extern Checkpoint** checkpoints;
 
 /*void* search_checkpoints(uint64_t target_instr);*/
 size_t get_num_checkpoints(void);
@@ -27,3 +32,6 @@ Checkpoint* get_checkpoint(int num);
 void* panda_checkpoint(void);
 void panda_restore_by_num(int num);
 void panda_restore(void *opaque);
+// Drop checkpoints (spreading out the survivors) to stay within bytes of
+// memory. 0 means no limit.
+void panda_checkpoint_set_budget(size_t bytes);
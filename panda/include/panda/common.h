@@ -85,20 +85,74 @@ static inline int panda_physical_memory_rw(hwaddr addr, uint8_t *buf, int len,
     return MEMTX_OK;
 }
 
+/**
+ * @brief Software TLB for the guest memory accessors below.
+ *
+ * Walking the guest page tables (cpu_get_phys_page_debug) for every page
+ * of every read dominates the cost of introspection, so successful
+ * translations are kept in a small direct-mapped cache per CPU, along with
+ * the host address of the page when it is plain RAM. It is flushed along
+ * with QEMU's TLB (which the guest must flush after changing a mapping) and
+ * whenever the ASID changes. Failed translations are never cached, since a
+ * guest may map a page without flushing anything.
+ */
+#define PANDA_V2P_CACHE_BITS 8
+#define PANDA_V2P_CACHE_SIZE (1 << PANDA_V2P_CACHE_BITS)
+
+typedef struct PandaV2PEntry {
+    target_ulong vpage;     // -1 for an empty entry
+    hwaddr ppage;
+    uint8_t *host;          // host address of ppage, NULL unless it's RAM
+    bool host_writable;
+} PandaV2PEntry;
+
+struct PandaV2PCache {
+    PandaV2PEntry e[PANDA_V2P_CACHE_SIZE];
+};
+
+/**
+ * @brief Translates \p page (page aligned) and caches the result. Returns
+ * NULL if the page isn't mapped.
+ */
+PandaV2PEntry *panda_v2p_fill(CPUState *cpu, target_ulong page);
+
+/**
+ * @brief Forgets all of \p cpu's cached translations.
+ */
+void panda_v2p_cache_flush(CPUState *cpu);
+
+/**
+ * @brief Forgets \p cpu's cached translations after the guest flushed the
+ * page with \p addr. That page may be part of a large mapping, so this
+ * forgets all of them.
+ */
+void panda_v2p_cache_flush_page(CPUState *cpu, target_ulong addr);
+
+/**
+ * @brief Returns the translation of \p page (page aligned), or NULL if
+ * it isn't mapped. The entry is only valid until the next lookup.
+ */
+static inline PandaV2PEntry *panda_v2p_lookup(CPUState *cpu, target_ulong page) {
+    struct PandaV2PCache *c = cpu->panda_v2p_cache;
+    if (likely(c != NULL)) {
+        PandaV2PEntry *e = &c->e[(page >> TARGET_PAGE_BITS) & (PANDA_V2P_CACHE_SIZE - 1)];
+        if (e->vpage == page) {
+            return e;
+        }
+    }
+    return panda_v2p_fill(cpu, page);
+}
+
 /**
  * @brief Translates guest virtual addres \p addr to a guest physical address.
  */
 static inline hwaddr panda_virt_to_phys(CPUState *env, target_ulong addr) {
-    target_ulong page;
-    hwaddr phys_addr;
-    page = addr & TARGET_PAGE_MASK;
-    phys_addr = cpu_get_phys_page_debug(env, page);
-    if (phys_addr == -1) {
+    PandaV2PEntry *e = panda_v2p_lookup(env, addr & TARGET_PAGE_MASK);
+    if (e == NULL) {
         // no physical page mapped
         return -1;
     }
-    phys_addr += (addr & ~TARGET_PAGE_MASK);
-    return phys_addr;
+    return e->ppage + (addr & ~TARGET_PAGE_MASK);
 }
 
 /**
@@ -127,19 +181,20 @@ static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
     int ret;
     hwaddr phys_addr;
     target_ulong page;
+    PandaV2PEntry *e;
     bool changed_priv = false;
 
     while (len > 0) {
         page = addr & TARGET_PAGE_MASK;
-        phys_addr = cpu_get_phys_page_debug(env, page);
+        e = panda_v2p_lookup(env, page);
         // If we failed and we aren't in priv mode and we CAN go into it, toggle modes and try again
-        if (phys_addr == -1  && !changed_priv && (changed_priv=enter_priv(env))) {
-            phys_addr = cpu_get_phys_page_debug(env, page);
-            //if (phys_addr != -1) printf("[panda dbg] virt->phys failed until privileged mode\n");
+        if (e == NULL && !changed_priv && (changed_priv=enter_priv(env))) {
+            e = panda_v2p_lookup(env, page);
+            //if (e != NULL) printf("[panda dbg] virt->phys failed until privileged mode\n");
         }
 
         // No physical page mapped, even after potential privileged switch, abort
-        if (phys_addr == -1)  {
+        if (e == NULL)  {
             if (changed_priv) exit_priv(env); // Cleanup mode if necessary
             return -1;
         }
@@ -148,7 +203,21 @@ static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
         if (l > len) {
             l = len;
         }
-        phys_addr += (addr & ~TARGET_PAGE_MASK);
+
+        // RAM: copy straight to or from the host page
+        if (e->host != NULL && (!is_write || e->host_writable)) {
+            if (is_write) {
+                memcpy(e->host + (addr & ~TARGET_PAGE_MASK), buf, l);
+            } else {
+                memcpy(buf, e->host + (addr & ~TARGET_PAGE_MASK), l);
+            }
+            len -= l;
+            buf += l;
+            addr += l;
+            continue;
+        }
+
+        phys_addr = e->ppage + (addr & ~TARGET_PAGE_MASK);
         ret = panda_physical_memory_rw(phys_addr, buf, l, is_write);
 
         // Failed and privileged mode wasn't already enabled - enable priv and retry if we can
@@ -186,12 +255,35 @@ static inline int panda_virtual_memory_write(CPUState *env, target_ulong addr,
     return panda_virtual_memory_rw(env, addr, buf, len, 1);
 }
 
+/**
+ * @brief One read of a panda_virtual_memory_readv() batch.
+ */
+typedef struct PandaVirtRead {
+    target_ulong addr;
+    uint8_t *buf;
+    int len;
+    int ret;                // set to the panda_virtual_memory_read() result
+} PandaVirtRead;
+
+/**
+ * @brief Does all \p n reads in \p reads, and returns how many of them
+ * failed. Cheaper than separate panda_virtual_memory_read() calls when
+ * gathering many small fields: consecutive reads from the same page share
+ * one translation, and the privilege switch (if any) is done once.
+ */
+int panda_virtual_memory_readv(CPUState *env, PandaVirtRead *reads, int n);
+
 /**
  * @brief Obtains a host pointer for the given virtual address.
  */
 static inline void *panda_map_virt_to_host(CPUState *env, target_ulong addr,
                                            int len)
 {
+    PandaV2PEntry *e = panda_v2p_lookup(env, addr & TARGET_PAGE_MASK);
+    if (e != NULL && e->host_writable) {
+        return e->host + (addr & ~TARGET_PAGE_MASK);
+    }
+
     hwaddr phys = panda_virt_to_phys(env, addr);
     hwaddr l = len;
     hwaddr addr1;
@@ -5,6 +5,10 @@
  *
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,6 +33,17 @@ void pandalog_cc_init_read_bwd(const char* path);
 //Open C++ pandalog for write
 void pandalog_cc_init_write(const char* path);
 
+// Choose the codec for the pandalog about to be opened for write, as
+// "codec[:level]" with codec one of none, zlib, zstd, lz4. Returns false if
+// the codec is unknown or wasn't compiled in.
+bool pandalog_cc_set_codec(const char *spec);
+
+// Number of threads compressing chunks (0: compress on the emulation thread)
+void pandalog_cc_set_threads(unsigned n);
+
+// Interface for plog.c to write an entry it packed itself
+void pandalog_cc_write_packed(const unsigned char *buf, size_t n, uint64_t instr);
+
 //Seek to an instr
 void pandalog_cc_seek(uint64_t instr);
 
@@ -21,24 +21,42 @@ extern "C" {
 }
 
 #include <stdio.h>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdint.h>
+#include <thread>
+#include <vector>
 #include "plog.pb.h"
 
-#define PL_CURRENT_VERSION 2
-// compression level
+// version 3 added the codec to the header
+#define PL_CURRENT_VERSION 3
+// default compression level for each codec
 #define PL_Z_LEVEL 9
+#define PL_ZSTD_LEVEL 3
+#define PL_LZ4_LEVEL 0
+// chunks are compressed by this many threads unless told otherwise
+#define PL_DEFAULT_THREADS 2
 // 16 MB chunk
 #define PL_CHUNKSIZE (1024 * 1024 * 16)
 // header at most this many bytes
 #define PL_HEADER_SIZE 128
 
 
+// codecs compiled into this build
+bool pl_codec_supported(PlCodec codec);
+const char *pl_codec_name(PlCodec codec);
+// decompress n bytes of chunk data into out, growing it as needed
+bool pl_uncompress_chunk(PlCodec codec, const unsigned char *src, size_t n,
+                         std::vector<unsigned char> &out);
+
 typedef struct pandalog_header_struct {
     uint32_t version;     // version number
     uint64_t dir_pos;     // position in file of directory
     uint32_t chunk_size;  // chunk size
+    uint32_t codec;       // PlCodec of the chunks (version 3 and up, zlib before)
 } PlHeader;
 
 // directory mapping instructions to chunks in the outfile
@@ -76,6 +94,19 @@ struct PandalogCcChunk {
     uint32_t ind_entry;         // index into array of entries
 };
 
+// A full chunk on its way to disk while writing. Chunks are compressed by a
+// pool of threads, then written strictly in order.
+struct PandalogCcJob {
+    std::vector<unsigned char> buf;     // uncompressed entries
+    size_t len;                         // bytes of buf in use
+    std::vector<unsigned char> zbuf;    // compressed chunk
+    size_t zlen;
+    uint64_t start_instr;               // for the dir entry
+    uint32_t num_entries;
+    uint32_t seq;                       // chunk number
+    bool done;                          // compressed, ready to write
+};
+
 class PandaLog {
     PlMode mode;
     const char *filename;
@@ -83,14 +114,47 @@ class PandaLog {
     PandalogCcDir dir;
     PandalogCcChunk chunk;
     uint32_t chunk_num;
+    PlCodec codec;
+    int level;
+
+    // writing: cur is being filled by the emulation thread
+    unsigned nthreads;
+    PandalogCcJob *cur;
+    std::vector<std::unique_ptr<PandalogCcJob>> jobs;
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable work_cv;    // todo has jobs, or stopping
+    std::condition_variable free_cv;    // a job was written
+    std::deque<PandalogCcJob *> todo;       // waiting to be compressed
+    std::deque<PandalogCcJob *> inflight;   // submitted, not yet written
+    std::vector<PandalogCcJob *> free_jobs;
+    bool writing;                       // a worker is writing chunks out
+    bool stopping;
+    uint64_t stalls;                    // times the emulation thread waited
+    uint64_t last_instr_entry;
 
 public:    
     //default constructor
     PandaLog(): mode(PL_MODE_UNKNOWN){
         mode = PL_MODE_UNKNOWN;
         chunk_num = 0;
+        codec = PL_CODEC_ZLIB;
+        level = PL_Z_LEVEL;
+        nthreads = PL_DEFAULT_THREADS;
+        cur = NULL;
+        writing = false;
+        stopping = false;
+        stalls = 0;
+        last_instr_entry = -1;
     };
 
+    // choose how chunks are compressed; only before open_write
+    void set_codec(PlCodec codec, int level);
+
+    // number of compression threads, 0 to compress on the calling thread;
+    // only before open_write
+    void set_threads(unsigned n);
+
     // open pandalog for write with this uncompressed chunk size
     void open_write(const char *path, uint32_t chunk_size);
 
@@ -109,6 +173,9 @@ public:
 
     void write_entry(std::unique_ptr<panda::LogEntry> entry);
 
+    // write an entry that is already packed; pc and instr must be set in it
+    void write_packed(const unsigned char *buf, size_t n, uint64_t instr);
+
     std::unique_ptr<panda::LogEntry> read_entry(void);
 
     // seek to the element in pandalog corresponding to this instr
@@ -137,11 +204,18 @@ private:
     void unmarshall_chunk(uint32_t chunk_num);
 
     // Adds directory entry to list of directory entries. Does not write to log
-    void add_dir_entry();
+    void add_dir_entry(PandalogCcJob *job, uint64_t pos);
 
-    //Zlib compresses and writes current chunk to log
+    // Hands the current chunk off to be compressed and written
     void write_current_chunk();
 
+    // Room for an entry of n bytes for instr in the current chunk
+    unsigned char *reserve_entry(size_t n, uint64_t instr);
+
+    void compress_job(PandalogCcJob *job);
+    void write_job(PandalogCcJob *job);
+    void worker();
+
     // Finds index of entry with this instr number
     uint32_t find_ind(uint64_t instr, uint32_t lo, uint32_t high);
 
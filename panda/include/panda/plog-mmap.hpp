@@ -0,0 +1,102 @@
+/**
+ *
+ * Random-access pandalog reader.
+ *
+ * PandaLog reads a log front to back (or back to front), one chunk at a
+ * time. PandaLogMmap maps the whole log instead, so any chunk can be
+ * decompressed on its own and several can be decompressed at once.
+ *
+ * It can also keep a sidecar index next to the log (<log>.idx) recording,
+ * for every chunk, the range of instructions it covers and which LogEntry
+ * fields appear in it. Queries like "all tainted_branch entries between
+ * instr X and Y" then only touch the chunks that can have an answer, and
+ * within those only parse the entries that have the field.
+ *
+ * Sidecar layout (little endian):
+ *
+ *   char magic[8]        PL_INDEX_MAGIC
+ *   u64 dir_pos          dir_pos of the log it indexes (to spot stale ones)
+ *   u32 num_chunks
+ *   u32 reserved
+ *   per chunk:
+ *     u64 first_instr    smallest instr in the chunk, -1 if none
+ *     u64 last_instr     largest instr in the chunk, 0 if none
+ *     u32 num_fields
+ *     u32 fields[num_fields]   LogEntry field numbers present, sorted
+ *
+ */
+
+#ifndef __PANDALOG_MMAP_H_
+#define __PANDALOG_MMAP_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "panda/plog-cc.hpp"
+
+#define PL_INDEX_MAGIC "PLOGIDX1"
+
+struct PandalogChunkInfo {
+    uint64_t pos;               // file position of the compressed chunk
+    uint64_t zsize;             // its compressed size
+    uint64_t start_instr;       // from the directory
+    uint64_t num_entries;
+    // from the index
+    uint64_t first_instr;
+    uint64_t last_instr;
+    std::vector<uint32_t> fields;
+};
+
+class PandaLogMmap {
+public:
+    PandaLogMmap() : base(NULL), size(0), nthreads(4), indexed(false) {}
+    ~PandaLogMmap() { close(); }
+
+    // map the log and read its directory; false if that fails
+    bool open(const char *path);
+    void close();
+
+    // chunks are decompressed on this many threads (at least 1)
+    void set_threads(unsigned n) { nthreads = n ? n : 1; }
+
+    uint32_t num_chunks() const { return chunks.size(); }
+    const PandalogChunkInfo &chunk(uint32_t i) const { return chunks[i]; }
+
+    // decompressed chunk i: entries stored as u32 size then the entry
+    bool read_chunk(uint32_t i, std::vector<unsigned char> &out) const;
+
+    // use <log>.idx if it's there and matches the log
+    bool load_index();
+    // scan every chunk (in parallel) to fill in the index
+    void build_index();
+    bool save_index() const;
+    bool has_index() const { return indexed; }
+
+    // LogEntry field number for a field name, 0 if there is none
+    static uint32_t field_number(const char *name);
+
+    // Calls f, in log order, for every entry with instr in
+    // [start_instr, end_instr] that has the given field (0 for any).
+    // Without an index every chunk is a candidate.
+    void query(uint32_t field, uint64_t start_instr, uint64_t end_instr,
+               const std::function<void(std::unique_ptr<panda::LogEntry>)> &f) const;
+
+private:
+    std::string path;
+    const unsigned char *base;
+    size_t size;
+    PlHeader header;
+    PlCodec codec;
+    unsigned nthreads;
+    bool indexed;
+    std::vector<PandalogChunkInfo> chunks;
+
+    std::string index_path() const { return path + ".idx"; }
+    void index_chunk(uint32_t i);
+    // run work(i) for each of the chunk numbers, nthreads at a time
+    void parallel_for(const std::vector<uint32_t> &which,
+                      const std::function<void(uint32_t)> &work) const;
+};
+
+#endif
@@ -15,6 +15,14 @@
 #include <zlib.h>
 #include "plog.pb-c.h"
 
+// How pandalog chunks are compressed; recorded in the header
+typedef enum {
+    PL_CODEC_NONE = 0,
+    PL_CODEC_ZLIB = 1,
+    PL_CODEC_ZSTD = 2,     // needs CONFIG_ZSTD
+    PL_CODEC_LZ4 = 3,      // needs CONFIG_LZ4, LZ4 frame format
+} PlCodec;
+
 typedef enum {
     PL_MODE_WRITE,
     PL_MODE_READ_FWD,
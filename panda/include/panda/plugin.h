@@ -42,6 +42,8 @@ struct _panda_cb_list {
     panda_cb_list *next;
     panda_cb_list *prev;
     bool enabled;
+    uint64_t calls;     // with -panda-cb-stats: times called
+    uint64_t ticks;     // with -panda-cb-stats: host ticks spent
 };
 panda_cb_list *panda_cb_list_next(panda_cb_list *plist);
 void panda_enable_plugin(void *plugin);
@@ -74,6 +76,8 @@ extern panda_cb_list *panda_cbs[PANDA_CB_LAST];
 extern bool panda_plugins_to_unload[MAX_PANDA_PLUGINS];
 extern bool panda_plugin_to_unload;
 extern bool panda_tb_chaining;
+extern bool panda_llvm_bypass;
+extern bool panda_bypass_llvm_block;
 
 // this stuff is used by the new qemu cmd-line arg '-os os_name'
 typedef enum OSFamilyEnum { OS_UNKNOWN, OS_WINDOWS, OS_LINUX } PandaOsFamily;
@@ -90,16 +94,47 @@ extern PandaOsFamily panda_os_familyno; // numeric identifier for family
 bool panda_flush_tb(void);
 
 void panda_do_flush_tb(void);
+// Bumped every time the translation cache is flushed; TranslationBlock
+// pointers from an older count are stale.
+unsigned panda_tb_flush_count(void);
 void panda_enable_precise_pc(void);
 void panda_disable_precise_pc(void);
 void panda_enable_memcb(void);
 void panda_disable_memcb(void);
+
+// Selective memory callbacks: instead of panda_enable_memcb, which sends
+// every load and store through the memory callbacks, watch just the
+// ranges a plugin cares about.  Other accesses stay on the TLB fast path.
+// The callbacks registered by all plugins run for every watched access.
+typedef enum {
+    PANDA_MEMCB_READ = 1,
+    PANDA_MEMCB_WRITE = 2,
+    PANDA_MEMCB_PHYS = 4,   // start is a guest physical address
+    PANDA_MEMCB_ASID = 8,   // only while the current ASID is asid
+} panda_memcb_kind;
+// Returns a handle for panda_memcb_unwatch, or -1.
+int panda_memcb_watch(uint64_t start, uint64_t len, int kinds, target_ulong asid);
+void panda_memcb_unwatch(int handle);
+extern bool panda_memcb_watching;
+int panda_memcb_page_watched(target_ulong vaddr, uint64_t paddr);
+bool panda_memcb_match(CPUState *cpu, target_ulong vaddr, uint64_t paddr,
+                       size_t size, bool is_write);
 void panda_enable_llvm(void);
 void panda_disable_llvm(void);
 void panda_enable_llvm_helpers(void);
 void panda_disable_llvm_helpers(void);
+// Keep a runnable TCG translation next to the LLVM one for every block.
+void panda_enable_llvm_bypass(void);
+void panda_disable_llvm_bypass(void);
+// From before_block_exec: run this block's TCG translation instead of the
+// LLVM one.  Needs panda_enable_llvm_bypass.
+void panda_bypass_llvm(void);
 void panda_enable_tb_chaining(void);
 void panda_disable_tb_chaining(void);
+// Make TBs chained during replay return to the main loop at the next block.
+void panda_stop_chaining(void);
+// Whether any per-block callback (which chained TBs would skip) is enabled.
+bool panda_block_callbacks_enabled(void);
 void panda_memsavep(FILE *f);
 
 // Struct for holding a parsed key/value pair from
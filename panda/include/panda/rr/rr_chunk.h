@@ -0,0 +1,98 @@
+#ifndef __RR_CHUNK_H_
+#define __RR_CHUNK_H_
+
+/* Chunked, compressed nondet log (version 2).
+
+   The original nondet log is a raw stream: a u64 holding the last guest
+   instruction count followed by the entries back to back.  Version 2 keeps
+   exactly that byte stream but stores it zlib-compressed in chunks, laid
+   out much like the pandalog (see plog.c).
+
+   Section 1: The header (RR_CHUNK_HEADER_SIZE bytes)
+
+     u64 magic           RR_CHUNK_MAGIC, never a plausible instr count
+     u64 last_instr      what the v1 header holds
+     u64 dir_pos         file position of the directory
+     u32 version         RR_CHUNK_VERSION
+     u32 chunk_size      target uncompressed size of a chunk
+
+   Section 2: The chunks
+
+     Compressed chunk data, back to back.  A chunk only ever ends on an
+     entry boundary, so every chunk starts with a complete entry.
+
+   Section 3: The directory (dir_pos .. end of file)
+
+     u32 num_chunks
+     RR_chunk_dir_entry[num_chunks]
+
+   Offsets handed out by the reader ("logical" offsets) are offsets into the
+   uncompressed v1 byte stream, header included, so file_pos values and
+   checkpoint positions mean the same thing for both versions.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define RR_CHUNK_MAGIC 0x32525241444e4150ULL // "PANDARR2"
+#define RR_CHUNK_VERSION 2
+#define RR_CHUNK_HEADER_SIZE 64
+#define RR_CHUNK_DEFAULT_SIZE (1 << 20)
+
+typedef struct {
+    uint64_t start_instr;  // guest instr count of the first entry
+    uint64_t start_offset; // logical offset of the first entry
+    uint64_t file_pos;     // file position of the compressed data
+    uint32_t size;         // uncompressed size
+    uint32_t zsize;        // compressed size
+} RR_chunk_dir_entry;
+
+typedef struct RR_chunked_log {
+    FILE *fp;
+    bool writing;
+    uint32_t chunk_size;
+    uint64_t last_instr;
+
+    // directory
+    uint32_t num_chunks;
+    uint32_t max_chunks;
+    RR_chunk_dir_entry *dir;
+
+    // uncompressed data of the chunk being written, or the loaded chunk
+    uint8_t *buf;
+    size_t buf_len;
+    size_t buf_cap;
+    uint8_t *zbuf;
+    size_t zbuf_cap;
+    int64_t cur_chunk; // loaded chunk when reading, -1 if none
+
+    uint64_t offset;      // logical offset of the end of what is written
+    uint64_t entry_instr; // instr count of the first entry in buf
+
+    struct RR_chunk_writer *writer; // see rr_chunked_start_writer
+} RR_chunked_log;
+
+// Writing.  Call rr_chunked_begin_entry before the bytes of every entry.
+RR_chunked_log *rr_chunked_open_write(const char *path, uint32_t chunk_size);
+void rr_chunked_begin_entry(RR_chunked_log *log, uint64_t instr);
+void rr_chunked_write(RR_chunked_log *log, const void *ptr, size_t len);
+// Compress and write chunks on a background thread, using at most max_bufs
+// chunk buffers; writers block while all of them are full. If the thread
+// can't be started, chunks keep being written on the calling thread.
+void rr_chunked_start_writer(RR_chunked_log *log, unsigned max_bufs);
+// Number of times a writer had to wait for a free chunk buffer.
+uint64_t rr_chunked_writer_stalls(RR_chunked_log *log);
+
+// Reading.  Returns NULL if path is not a v2 log.
+RR_chunked_log *rr_chunked_open_read(const char *path);
+uint64_t rr_chunked_size(RR_chunked_log *log);
+size_t rr_chunked_read(RR_chunked_log *log, uint64_t offset, void *ptr,
+                       size_t len);
+// Write the v1 byte stream for a v2 log to out.
+void rr_chunked_to_stream(RR_chunked_log *log, FILE *out);
+
+// Flushes, writes the directory and header (when writing) and closes.
+void rr_chunked_close(RR_chunked_log *log);
+
+#endif
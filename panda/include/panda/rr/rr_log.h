@@ -142,6 +142,7 @@ typedef struct RR_log_t {
 
     char* name; // file name
     FILE* fp;   // file pointer for log
+    struct RR_chunked_log* chunked; // v2 log; NULL for a raw v1 log
     unsigned long long
         size; // for a log being opened for read, this will be the size in bytes
     uint64_t bytes_read;
@@ -46,6 +46,10 @@ void rr_create_record_log(const char* filename);
 void rr_create_replay_log(const char* filename);
 void rr_destroy_log(void);
 uint8_t rr_replay_finished(void);
+void rr_replay_seek(uint64_t pos);
+
+// decode the replay log on a background thread (default on)
+extern bool rr_prefetch_enabled;
 
 // used from monitor.c
 int rr_do_begin_record(const char* name, CPUState* cpu_state);
@@ -435,6 +435,18 @@ Value* TCGLLVMContextPrivate::getPtrForValue(int idx)
     return m_memValuesPtr[idx];
 }
 
+/* With panda_llvm_bypass the TCG ops keep panda_guest_pc and the rr
+ * instruction count up to date themselves, so that the plain TCG translation
+ * of a block can be run instead of ours.  generateCode already does both at
+ * each insn_start, so loads of these fields read as 0 and stores are dropped.
+ */
+static inline bool isPandaCounterOffset(int64_t offset) {
+    return offset == -(int64_t)ENV_OFFSET +
+            (int64_t)offsetof(CPUState, rr_guest_instr_count) ||
+        offset == -(int64_t)ENV_OFFSET +
+            (int64_t)offsetof(CPUState, panda_guest_pc);
+}
+
 Value* TCGLLVMContextPrivate::getEnvOffsetPtr(int64_t offset, TCGTemp &temp) {
     llvm::Type *tempType = tcgPtrType(temp.type);
     auto key = std::make_pair(offset, tempType);
@@ -1006,6 +1018,10 @@ int TCGLLVMContextPrivate::generateOperation(int opc, const TCGOp *op,
         TCGTemp &temp = m_tcgContext->temps[args[0]];               \
         assert(!m_tcgContext->temps[args[1]].name                   \
                 || !strcmp(m_tcgContext->temps[args[1]].name, "env"));\
+        if (isPandaCounterOffset(args[2])) {                        \
+            setValue(args[0], constInt(regBits, 0));                \
+            break;                                                  \
+        }                                                           \
         v = getEnvOffsetPtr(args[2], temp);                         \
         v = m_builder.CreatePointerCast(v, intPtrType(memBits)); \
         v = m_builder.CreateLoad(v);                                \
@@ -1019,6 +1035,7 @@ int TCGLLVMContextPrivate::generateOperation(int opc, const TCGOp *op,
         assert(getValue(args[0])->getType() == intType(regBits));   \
         assert(!m_tcgContext->temps[args[1]].name                   \
                 || !strcmp(m_tcgContext->temps[args[1]].name, "env"));\
+        if (isPandaCounterOffset(args[2])) break;                   \
         Value* valueToStore = getValue(args[0]);                    \
         Value* storePtr = getEnvOffsetPtr(args[2], temp);           \
         storePtr = m_builder.CreatePointerCast(storePtr, intPtrType(memBits)); \
@@ -54,16 +54,20 @@ void after_init(CPUState* env) {
     const char* avail_space = panda_parse_string_opt(args, "space", "6G", "Available disk/RAM space for storing checkpoints");
     uint64_t space_bytes;
     parse_option_size("space", avail_space, &space_bytes, NULL );
+    checkpoint_instr_size = panda_parse_uint64_opt(args, "interval", 0, "Instructions between checkpoints (0: spread 256 over the replay)");
 
-    // Get approx size of each checkpoint
+    // Checkpoints only hold the pages that changed since the previous one,
+    // and identical pages are stored once, so only the first one costs
+    // about ram_size. Older checkpoints are thinned out to stay in budget.
     LOG_INFO("Avail space %" PRIx64 ", ram_size %" PRIx64, space_bytes, ram_size);
     if (space_bytes < ram_size){
-        LOG_ERROR("Not enough RAM for a checkpoint!");
-        abort();
+        LOG_WARNING("Space may not fit the first checkpoint");
+    }
+    panda_checkpoint_set_budget(space_bytes);
+
+    if (checkpoint_instr_size == 0) {
+        checkpoint_instr_size = rr_nondet_log->last_prog_point.guest_instr_count/256;
     }
-    uint64_t num_checkpoints = space_bytes/ram_size;
-    LOG_INFO("Number of checkpoints allowed:  %" PRIu64, num_checkpoints);
-    checkpoint_instr_size = rr_nondet_log->last_prog_point.guest_instr_count/num_checkpoints;
     if (checkpoint_instr_size < 500000) {
         checkpoint_instr_size = 500000;
     }
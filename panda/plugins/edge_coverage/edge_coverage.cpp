@@ -22,6 +22,8 @@ extern "C" {
 #include <iostream>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <algorithm>
 #include <iomanip>
 #include <vector>
 
@@ -36,19 +38,221 @@ typedef target_ulong Pc;
 
 target_ulong start_main = 0;
 
-map <Asid, vector<Pc>> asid_trace; 
-
 bool debug=false;
 
 // Up to n-edge coverage 
 int n;
 
+// Edges are counted as the trace is produced, so only the last n pcs of
+// each asid are kept around. Counts are written to the pandalog (and
+// reset) every flush_instr instructions, when the tables hold more than
+// max_edges edges, and at the end.
+uint64_t flush_instr = 0;
+uint64_t next_flush = 0;
+uint64_t max_edges = 0;
+uint64_t num_edges = 0;
+
+// Counts of n-edges, keyed by a hash of their pcs. Open addressing with
+// linear probing; the pcs of every edge live in one pool so that an entry
+// is fixed-size and a hit compares them without chasing pointers.
+class EdgeTable {
+public:
+    struct Entry {
+        uint64_t hash;
+        uint64_t count;         // 0 for an empty slot
+        uint32_t pcs_off;
+        uint32_t len;
+    };
+
+    EdgeTable() : used(0) { slots.resize(64); }
+
+    // count the edge pcs[0..len), whose hash is h; true if it is new
+    bool hit(uint64_t h, const Pc *pcs, uint32_t len) {
+        if (2 * (used + 1) > slots.size()) grow();
+        size_t mask = slots.size() - 1;
+        for (size_t i = h & mask; ; i = (i + 1) & mask) {
+            Entry &e = slots[i];
+            if (e.count == 0) {
+                e.hash = h;
+                e.count = 1;
+                e.pcs_off = pool.size();
+                e.len = len;
+                pool.insert(pool.end(), pcs, pcs + len);
+                used++;
+                return true;
+            }
+            if (e.hash == h && e.len == len &&
+                    equal(pcs, pcs + len, pool.begin() + e.pcs_off)) {
+                e.count++;
+                return false;
+            }
+        }
+    }
+
+    size_t size() const { return used; }
+    size_t pool_size() const { return pool.size(); }
+    const Pc *pcs(const Entry &e) const { return &pool[e.pcs_off]; }
+
+    template <typename F>
+    void for_each(F f) const {
+        for (const Entry &e : slots) {
+            if (e.count) f(e);
+        }
+    }
+
+    void clear() {
+        vector<Entry>(64).swap(slots);
+        vector<Pc>().swap(pool);
+        used = 0;
+    }
+
+private:
+    vector<Entry> slots;
+    vector<Pc> pool;
+    size_t used;
+
+    void grow() {
+        vector<Entry> old(2 * slots.size());
+        old.swap(slots);
+        size_t mask = slots.size() - 1;
+        for (const Entry &e : old) {
+            if (e.count == 0) continue;
+            size_t i = e.hash & mask;
+            while (slots[i].count) i = (i + 1) & mask;
+            slots[i] = e;
+        }
+    }
+};
+
+// Everything we track for an asid
+struct AsidState {
+    bool seen_after = false;        // after_block has run for this asid
+    bool seen_before = false;       // before_block has run for this asid
+    Pc last_bb_start = 0;
+    bool last_bb_was_split = false;
+    bool last_bb_intexc = false;
+    Pc last_bb_before_intexc = 0;
+
+    // the last n pcs of the trace, newest at recent[(pos - 1) % n]
+    vector<Pc> recent;
+    uint32_t pos = 0;
+    uint32_t filled = 0;
 
-map<target_ulong,target_ulong> last_bb_start;
-map<target_ulong,bool> last_bb_was_split;
-map<target_ulong,bool> last_bb_was_exception;
-map<target_ulong,bool> last_bb_intexc;
-map<target_ulong,target_ulong> last_bb_before_intexc;
+    EdgeTable edges;
+    vector<Pc> trace;               // pcs not yet written out, with trace
+};
+
+unordered_map<Asid, AsidState> asids;
+
+bool pandalog_trace = false;
+// trace pcs are written out in pieces of at most this many
+const size_t trace_piece = 1 << 16;
+
+static inline uint64_t mix(uint64_t h, uint64_t v) {
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    return h * 0xff51afd7ed558ccdULL;
+}
+
+// pcs are target_ulong, the pandalog wants them as uint64_t
+static vector<uint64_t> wide_pcs;
+
+void write_asid_trace(Asid asid, AsidState &st) {
+    if (st.trace.empty()) return;
+    wide_pcs.assign(st.trace.begin(), st.trace.end());
+    Panda__AsidTrace at = PANDA__ASID_TRACE__INIT;
+    at.pcs = wide_pcs.data();
+    at.n_pcs = wide_pcs.size();
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.has_asid = 1;
+    ple.asid = asid;
+    ple.trace = &at;
+    pandalog_write_entry(&ple);
+    st.trace.clear();
+}
+
+void write_asid_edges(Asid asid, AsidState &st) {
+    if (st.edges.size() == 0) return;
+    static vector<Panda__Edge> e;
+    static vector<Panda__Edge *> ep;
+    e.resize(st.edges.size());
+    ep.resize(st.edges.size());
+    wide_pcs.resize(st.edges.pool_size());
+    size_t i = 0;
+    size_t off = 0;
+    st.edges.for_each([&](const EdgeTable::Entry &ent) {
+        const Pc *pcs = st.edges.pcs(ent);
+        copy(pcs, pcs + ent.len, wide_pcs.begin() + off);
+        e[i] = PANDA__EDGE__INIT;
+        e[i].pc = &wide_pcs[off];
+        e[i].n_pc = ent.len;
+        off += ent.len;
+        e[i].hit_count = ent.count;
+        ep[i] = &e[i];
+        i++;
+    });
+
+    Panda__AsidEdges ae = PANDA__ASID_EDGES__INIT;
+    ae.n_edges = i;
+    ae.edges = ep.data();
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.has_asid = 1;
+    ple.asid = asid;
+    ple.edge_coverage = &ae;
+    pandalog_write_entry(&ple);
+
+    num_edges -= st.edges.size();
+    st.edges.clear();
+}
+
+// write out, and forget, everything counted so far
+void flush_edges() {
+    if (!pandalog) return;
+    for (auto &kvp : asids) {
+        if (pandalog_trace) write_asid_trace(kvp.first, kvp.second);
+        write_asid_edges(kvp.first, kvp.second);
+    }
+}
+
+// pc is the next pc in asid's trace: count every edge of up to n pcs
+// that ends with it
+void add_to_trace(Asid asid, AsidState &st, Pc pc) {
+    // counts only ever go to the pandalog; without one there's no point
+    if (!pandalog) return;
+
+    if (pandalog_trace) {
+        st.trace.push_back(pc);
+        if (st.trace.size() >= trace_piece)
+            write_asid_trace(asid, st);
+    }
+
+    st.recent[st.pos] = pc;
+    st.pos = (st.pos + 1) % n;
+    if (st.filled < (uint32_t) n) st.filled++;
+
+    // the k-edge is the k-1-edge with one more pc in front, so the hash
+    // of each is one step from the last
+    static vector<Pc> edge;
+    edge.resize(n);
+    uint64_t h = asid;
+    for (uint32_t k = 1; k <= st.filled; k++) {
+        Pc p = st.recent[(st.pos + n - k) % n];
+        edge[st.filled - k] = p;
+        h = mix(h, p);
+        if (st.edges.hit(h, &edge[st.filled - k], k)) num_edges++;
+    }
+
+    if (max_edges && num_edges > max_edges)
+        flush_edges();
+}
+
+AsidState &asid_state(Asid asid) {
+    auto it = asids.find(asid);
+    if (it == asids.end()) {
+        it = asids.emplace(asid, AsidState()).first;
+        it->second.recent.resize(n);
+    }
+    return it->second;
+}
 
 bool saw_main = false;
 
@@ -65,12 +269,15 @@ void after_block(CPUState *env, TranslationBlock *tb, uint8_t exitCode) {
     if (check_in_exception() || check_in_interrupt()) 
         return;
     
+    AsidState &st = asid_state(asid);
+
     // dont record pc if last block was split
-    if (last_bb_was_split.count(asid) != 0 && !last_bb_was_split[asid])
-        last_bb_start[asid] = tb->pc;
+    if (st.seen_after && !st.last_bb_was_split)
+        st.last_bb_start = tb->pc;
     
     // keep track of if last bb was split
-    last_bb_was_split[asid] = tb->was_split; 
+    st.last_bb_was_split = tb->was_split; 
+    st.seen_after = true;
     
 }
 
@@ -87,34 +294,41 @@ void before_block(CPUState *env, TranslationBlock *tb) {
         if (!saw_main)
             return;
     }
+
+    if (flush_instr && rr_get_guest_instr_count() >= next_flush) {
+        flush_edges();
+        next_flush = rr_get_guest_instr_count() + flush_instr;
+    }
     
     target_ulong asid = panda_current_asid(env);
     bool intexc = (check_in_exception() || check_in_interrupt());
+    AsidState &st = asid_state(asid);
     
     // we can only know transition if we know where we were for this asid last
-    if (last_bb_intexc.count(asid) != 0) {
+    if (st.seen_before) {
         
         // four possibilities
         
         // 1. transition from reg to intexc code
-        if (!last_bb_intexc[asid] && intexc) {
+        if (!st.last_bb_intexc && intexc) {
             // remember start pc of last bb before intexc
             if (debug) 
                 cout << "trans from reg to intexc -- saving last_bb_before_intexc[" 
-                     << hex << asid << "]=" << last_bb_start[asid] << "\n";
-            last_bb_before_intexc[asid] = last_bb_start[asid];
+                     << hex << asid << "]=" << st.last_bb_start << "\n";
+            st.last_bb_before_intexc = st.last_bb_start;
             goto done;
         }
         
         // 2. transition from int/exc code to reg
-        if (last_bb_intexc[asid] && !intexc) {
+        if (st.last_bb_intexc && !intexc) {
             // if this bb is just same as the last one before
             // the int/exc, we ignore
             if (debug) 
                 cout << "trans from intexc to reg\n";
-            if (tb->pc == last_bb_before_intexc[asid]) {
-                cout << "same last bb\n";
-                last_bb_start[asid] = tb->pc;
+            if (tb->pc == st.last_bb_before_intexc) {
+                if (debug)
+                    cout << "same last bb\n";
+                st.last_bb_start = tb->pc;
                 goto done;
             }
             // bbs have different start pc. 
@@ -123,21 +337,21 @@ void before_block(CPUState *env, TranslationBlock *tb) {
             if (debug) {
                 cout << "not same last bb\n";
                 cout << "adding to trace last_bb_before_intexc["
-                     << hex << asid << "]=" << last_bb_before_intexc[asid] << "\n";
+                     << hex << asid << "]=" << st.last_bb_before_intexc << "\n";
                 cout << "and setting last_bb_start[" << hex << asid << "]=" << tb->pc << "\n";
             }
 
-            asid_trace[asid].push_back(last_bb_before_intexc[asid]);                     
+            add_to_trace(asid, st, st.last_bb_before_intexc);
             // update pc in case we get longjmped
-            last_bb_start[asid] = tb->pc;
+            st.last_bb_start = tb->pc;
         }
         
         // 3. no transition && we are in regular code
-        if (!last_bb_intexc[asid] && !intexc) {
+        if (!st.last_bb_intexc && !intexc) {
             // ugh last bb was split so we dont update trace yet
             if (debug) 
                 cout << "no trans and in reg code\n";
-            if (last_bb_was_split[asid]) {
+            if (st.last_bb_was_split) {
                 if (debug) 
                     cout << "but last bb was split\n";
                 goto done;
@@ -145,14 +359,14 @@ void before_block(CPUState *env, TranslationBlock *tb) {
             if (debug) {
                 cout << "last bb not split\n";
                 cout << "adding to trace last_bb_start["
-                     << hex << asid << "]=" << last_bb_start[asid] << "\n";        
+                     << hex << asid << "]=" << st.last_bb_start << "\n";        
                 cout << "and setting last_bb_start[" << asid << "]=" << tb->pc << "\n";
             }
             
             // update trace in normal way
-            asid_trace[asid].push_back(last_bb_start[asid]);                 
+            add_to_trace(asid, st, st.last_bb_start);
             // update pc in case we get longjmped
-            last_bb_start[asid] = tb->pc; 
+            st.last_bb_start = tb->pc; 
         }
     }
     
@@ -163,11 +377,11 @@ void before_block(CPUState *env, TranslationBlock *tb) {
     // keep track of last intexc value to be able
     // to observe transition
 done:
-    last_bb_intexc[asid] = intexc;
+    st.last_bb_intexc = intexc;
+    st.seen_before = true;
 }
 
 
-bool pandalog_trace = false;
 
 bool init_plugin(void *self) {
 
@@ -181,6 +395,15 @@ bool init_plugin(void *self) {
     n = panda_parse_uint64_opt(args, "n", 1, "collect up-to-and-including n-edges");
     //    no_kernel = panda_parse_bool_opt(args, "no_kernel", "disable kernel pcs"); 
     pandalog_trace = panda_parse_bool_opt(args, "trace", "output trace to pandalog");
+    flush_instr = panda_parse_uint64_opt(args, "flush_instr", 0,
+            "write edge counts to the pandalog every this many instructions (0: only at the end)");
+    max_edges = panda_parse_uint64_opt(args, "max_edges", 1 << 22,
+            "write edge counts to the pandalog whenever more than this many are held (0: no limit)");
+    if (n < 1) {
+        fprintf(stderr, "edge_coverage: n must be at least 1\n");
+        return false;
+    }
+    next_flush = flush_instr;
     const char *start_main_str = panda_parse_string_opt(args, "main", nullptr,
                                             "hex addr of main");
     if (start_main_str != nullptr) {
@@ -204,98 +427,5 @@ bool init_plugin(void *self) {
 
 
 void uninit_plugin(void *) {
-
-    if (!pandalog) return; 
-
-    map<Asid, map<vector<Pc>, int>> final_map; 
-
-    // From the traces in each asid, collect up to n-edges 
-    for (auto kvp : asid_trace) { 
-        map<vector<Pc>, int> edges;
-        auto asid = kvp.first;
-        auto pc_trace = kvp.second; 
-        ofstream tracef;
-        for (int k = 1; k <= n; k++) { 
-            for (int i = 0; i < pc_trace.size(); i++) {
-                // Build the edge (vector) 
-                vector<Pc> edge;
-                for (int j = 0; j < k; j++) { 
-                    if (i+j < pc_trace.size()) 
-                        edge.push_back(pc_trace[i + j]);                     
-                }
-                // Add the edge to the map for this asid and update its count  
-                if (edges.find(edge) != edges.end())  edges[edge] += 1;
-                else  edges[edge] = 1; 
-            }
-        }
-        if (pandalog_trace) {
-            Panda__AsidTrace *at = (Panda__AsidTrace *) malloc (sizeof(Panda__AsidTrace));
-            *at = PANDA__ASID_TRACE__INIT;
-            at->pcs = (uint64_t *) malloc(sizeof(uint64_t) * pc_trace.size());
-            int i=0;
-            for (auto pc : pc_trace) 
-                at->pcs[i++] = pc;
-            at->n_pcs = pc_trace.size();	  
-            Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
-            ple.has_asid = 1;
-            ple.asid = asid;
-            ple.trace = at;
-            pandalog_write_entry(&ple);
-            free(at->pcs);
-            free(at);
-            final_map[asid] = edges; 
-        }
-    }
-
-    // Write out each to a pandalog 
-    for (auto kvp: final_map) { 
-        auto asid = kvp.first;
-        auto edge_map = kvp.second; 
-
-        Panda__AsidEdges * ae = (Panda__AsidEdges *) malloc (sizeof (Panda__AsidEdges)); 
-        *ae = PANDA__ASID_EDGES__INIT; 
-
-        ae->n_edges = edge_map.size(); 
-        Panda__Edge ** e = (Panda__Edge **) malloc (sizeof (Panda__Edge *) * edge_map.size()); 
-
-        int i = 0;
-        for (auto kvp : edge_map) { 
-            auto n_edge = kvp.first;
-            auto hit_count = kvp.second;
-
-            e[i] = (Panda__Edge *) malloc (sizeof (Panda__Edge)); 
-            *(e[i]) = PANDA__EDGE__INIT;
-
-            //e[i]->n = n_edge.size(); 
-            uint64_t *pc_list = (uint64_t *) malloc (sizeof (uint64_t) * (n_edge.size()));
-            int j = 0;
-            for (auto edge : n_edge) {
-                pc_list[j++] = edge; 
-            }
-
-            e[i]->pc = pc_list;
-            e[i]->n_pc = n_edge.size();
-            e[i]->hit_count = hit_count; 
-            i++; 
-        } 
-        ae->edges = e; 
-
-
-        Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT; 
-        ple.has_asid = 1;
-        ple.asid = asid; 
-        ple.edge_coverage = ae; 
-        pandalog_write_entry(&ple); 
-
-        // Free everything I used
-        for (int i = 0; i < edge_map.size(); i++) { 
-            free(e[i]->pc);
-            free(e[i]); 
-        }
-        free(e); 
-        free(ae); 
-    } 
-
+    flush_edges();
 }
-
-
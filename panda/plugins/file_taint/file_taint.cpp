@@ -153,39 +153,21 @@ void read_return(uint64_t file_id, uint64_t bytes_read,
     uint64_t range_end =
         std::min(read_start_pos + bytes_read - 1, max_byte_pos);
 
-    bool print_apply_message = true;
-    for (uint64_t i = 0; i < bytes_read && tainted_byte_count < max_byte_count;
-         i++) {
-        uint64_t file_pos = read_start_pos + i;
-        if (range_start <= file_pos && file_pos <= range_end) {
-            if (print_apply_message) {
-                printf("*** applying %s taint labels %" PRIu64 "..%" PRIu64
-                       " to buffer @ %" PRIu64 " ***\n",
-                       positional ? "positional" : "uniform", range_start,
-                       range_end, rr_get_guest_instr_count());
-                print_apply_message = false;
-            }
-            hwaddr shadow_addr = panda_virt_to_phys(first_cpu, buffer_addr + i);
-            if (shadow_addr == (hwaddr)(-1))
-            {
-                printf("file_taint can't label file_pos=%lu buffer_addr=0x%" PRIx64 ": mmu hasn't mapped virt->phys, i.e., it isnt actually there.\n", file_pos, buffer_addr + i);
-            }
-            ram_addr_t RamOffset = RAM_ADDR_INVALID;
-            if (PandaPhysicalAddressToRamOffset(&RamOffset, shadow_addr, false) != MEMTX_OK)
-            {
-                printf("file_taint can't label file_pos=%lu buffer_addr=0x%" PRIx64 " shadow_addr=0x%" PRIx64 ": physical map is not RAM.\n", file_pos, buffer_addr + i, shadow_addr);
-                continue;
-            }
-            verbose_printf(
-                "file_taint applying label: file_pos=%lu buffer_addr=%lu\n",
-                file_pos, buffer_addr + i);
-            if (positional) {
-                taint2_label_ram(RamOffset, file_pos);
-            } else {
-                taint2_label_ram(RamOffset, static_label);
-            }
-            tainted_byte_count++;
-        }
+    if (bytes_read > 0 && range_start <= range_end &&
+        tainted_byte_count < max_byte_count) {
+        uint64_t count = std::min(range_end - range_start + 1,
+                                  max_byte_count - tainted_byte_count);
+        target_ulong label_addr = buffer_addr + (range_start - read_start_pos);
+        printf("*** applying %s taint labels %" PRIu64 "..%" PRIu64
+               " to buffer @ %" PRIu64 " ***\n",
+               positional ? "positional" : "uniform", range_start,
+               range_start + count - 1, rr_get_guest_instr_count());
+        verbose_printf("file_taint applying labels: file_pos=%lu "
+                       "buffer_addr=%lu count=%lu\n",
+                       range_start, label_addr, count);
+        tainted_byte_count += taint2_label_ram_range(
+            first_cpu, label_addr, count,
+            positional ? range_start : static_label, positional);
     }
 
     // We've handled the read for this pid, tid, and file id. We have to see
@@ -14,9 +14,10 @@ PANDAENDCOMMENT */
 #define __STDC_FORMAT_MACROS
 
 #include "panda/plugin.h"
+#include "panda/common.h"
 #include "hooks_int_fns.h"
 #include <iostream>
-#include <unordered_map>
+#include <map>
 #include <vector>
 
 // These need to be extern "C" so that the ABI is compatible with
@@ -26,39 +27,87 @@ bool init_plugin(void *);
 void uninit_plugin(void *);
 }
 
-// Hooking framework to execute code before guest executes given basic block
+// Hooking framework to execute code before guest executes a given instruction.
+//
+// Hooks are placed at translation time: insn_translate tells the translator
+// which instructions are hooked and only those get a call into insn_exec.
+// Every other block runs (and chains) at full speed, so adding, moving or
+// removing a hook throws away all translated code.
 
 // Mapping of addresses to hook functions
-std::unordered_map<target_ulong, std::vector<hook_func_t>> hooks;
+std::map<target_ulong, std::vector<hook_func_t>> hooks;
 
-// Callback object
-panda_cb c_callback;
+// Most recently translated block containing each hooked address, with the
+// translation cache generation it came from. Blocks can be invalidated or
+// the whole cache flushed underneath us, so entries are checked before use.
+struct hook_tb {
+    TranslationBlock *tb;
+    unsigned flush_count;
+};
+std::map<target_ulong, hook_tb> hook_tbs;
+
+// A hook asked for its instruction to be re-executed; don't run the hooks at
+// this pc again for that one execution.
+bool skip_once = false;
+target_ulong skip_pc;
+
+// Callback objects
+panda_cb c_translate, c_exec, c_block;
 
 // Handle to self
 void* self = NULL;
 
+// Hooks are keyed by virtual pc, so code at that pc may be translated in
+// any process. Adding or removing a hook is rare: just throw away all
+// translated code so the next translation sees the current set of hooks.
+static void invalidate_hooks(void) {
+  panda_do_flush_tb();
+}
+
+// Discard the translation of pc that cpu is executing right now.
+static void invalidate_current(CPUState *cpu, target_ulong pc) {
+  hwaddr phys = panda_virt_to_phys(cpu, pc);
+  if (phys == (hwaddr)-1) {
+    panda_do_flush_tb();
+  } else {
+    tb_invalidate_phys_addr(&address_space_memory, phys);
+  }
+}
+
 // Enable and disable callbacks
 void enable_hooking() {
   assert(self != NULL);
-  panda_enable_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT, c_callback);
+  panda_enable_callback(self, PANDA_CB_INSN_TRANSLATE, c_translate);
+  panda_enable_callback(self, PANDA_CB_INSN_EXEC, c_exec);
+  panda_enable_callback(self, PANDA_CB_AFTER_BLOCK_TRANSLATE, c_block);
 }
 void disable_hooking() {
   assert(self != NULL);
-  panda_disable_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT, c_callback);
+  panda_disable_callback(self, PANDA_CB_INSN_TRANSLATE, c_translate);
+  panda_disable_callback(self, PANDA_CB_INSN_EXEC, c_exec);
+  panda_disable_callback(self, PANDA_CB_AFTER_BLOCK_TRANSLATE, c_block);
 }
 
 void update_hook(hook_func_t hook, target_ulong value){
-	for (auto it = hooks.begin(); it != hooks.end(); ++it){
-		if (it->first == value) continue;
-		std::vector<hook_func_t> hook_pile = it->second;
-		for (auto it=hook_pile.begin(); it!=hook_pile.end(); ++it){
-			if (*it == hook){
-				hook_pile.erase(it);				
-				it--;
+	for (auto it = hooks.begin(); it != hooks.end(); ){
+		if (it->first == value) { ++it; continue; }
+		std::vector<hook_func_t> &hook_pile = it->second;
+		for (auto hit = hook_pile.begin(); hit != hook_pile.end(); ){
+			if (*hit == hook){
+				hit = hook_pile.erase(hit);
+				invalidate_hooks();
+			} else {
+				++hit;
 			}
 		}
+		if (hook_pile.empty()) {
+			hook_tbs.erase(it->first);
+			it = hooks.erase(it);
+		} else {
+			++it;
+		}
 	}
-	hooks[value].push_back(hook);
+	add_hook(value, hook);
 }
 
 void enable_hook(hook_func_t hook, target_ulong value){
@@ -74,52 +123,106 @@ void disable_hook(hook_func_t hook){
 void add_hook(target_ulong addr, hook_func_t hook) {
   printf("Adding hook from guest 0x" TARGET_FMT_lx " to host %p\n", addr, hook);
 
-  if (!panda_is_callback_enabled(self, PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT, c_callback)) enable_hooking(); // Ensure our panda callback is enabled when we add a hook
+  if (!panda_is_callback_enabled(self, PANDA_CB_INSN_TRANSLATE, c_translate)) enable_hooking(); // Ensure our panda callbacks are enabled when we add a hook
 	// check for existing hook
-  std::vector<hook_func_t> hook_pile = hooks[addr];
+  std::vector<hook_func_t> &hook_pile = hooks[addr];
 	for (auto it=hook_pile.begin(); it!=hook_pile.end(); ++it){
 		if (*it == hook){
 			return;
 		}
 	}
-  hooks[addr].push_back(hook);
+  hook_pile.push_back(hook);
+  // Code at addr may already be translated without the call to us
+  if (hook_pile.size() == 1) invalidate_hooks();
 }
 
 
-// The panda callback to determine if we should call a python callback
-bool before_block_exec_invalidate_opt(CPUState *cpu, TranslationBlock *tb) {
-    // Call any callbacks registered at this PC. Any called callback may invalidate the translation block
- 
-    bool ret = false;
+// Instrument only the instructions that have hooks
+bool insn_translate(CPUState *cpu, target_ulong pc) {
+    return hooks.find(pc) != hooks.end();
+}
+
+// Remember which block each hooked instruction ended up in; the hooks are
+// handed that block.
+void after_block_translate(CPUState *cpu, TranslationBlock *tb) {
+    for (auto it = hooks.lower_bound(tb->pc);
+         it != hooks.end() && it->first < tb->pc + tb->size; ++it) {
+        hook_tbs[it->first] = { tb, panda_tb_flush_count() };
+    }
+}
+
+// Call any callbacks registered at this PC. Any called callback may ask for
+// the instruction to be re-executed by returning true.
+int insn_exec(CPUState *cpu, target_ulong pc) {
+    if (skip_once && skip_pc == pc) {
+        skip_once = false;
+        return 0;
+    }
 
-    auto func_hooks = hooks.find(tb->pc);
-    if (func_hooks != hooks.end()) {
-        for (auto &hook : func_hooks->second) {
-            ret |= (*hook)(cpu, tb);
+    auto func_hooks = hooks.find(pc);
+    if (func_hooks == hooks.end()) {
+        return 0;
+    }
+
+    // Only hand out a block that is still live and still covers pc; a flush
+    // recycles TranslationBlocks, so a stale pointer may name another block.
+    TranslationBlock *tb = NULL;
+    auto tb_it = hook_tbs.find(pc);
+    if (tb_it != hook_tbs.end()) {
+        TranslationBlock *htb = tb_it->second.tb;
+        if (tb_it->second.flush_count == panda_tb_flush_count() &&
+            !htb->invalid && htb->pc <= pc && pc < htb->pc + htb->size) {
+            tb = htb;
+        } else {
+            hook_tbs.erase(tb_it);
         }
     }
 
-#ifdef DEBUG
-    if (ret) {
-        printf("Invalidating the translation block at 0x" TARGET_FMT_lx "\n", tb->pc);
+    bool ret = false;
+    // Copy: a hook may add or remove hooks at this address
+    std::vector<hook_func_t> hook_pile = func_hooks->second;
+    for (auto &hook : hook_pile) {
+        ret |= (*hook)(cpu, tb);
     }
+
+    if (ret) {
+#ifdef DEBUG
+        printf("Restarting execution at 0x" TARGET_FMT_lx "\n", panda_current_pc(cpu));
 #endif
+        // The hook may have changed guest code or state that the rest of the
+        // block was translated against. The translator stored the precise pc
+        // before calling us, so leave the block and continue from the guest's
+        // pc. If that is still this instruction, don't run its hooks twice.
+        invalidate_current(cpu, pc);
+        hook_tbs.erase(pc);
+        // This instruction was already counted when its block reached it.
+        // It either runs again or never runs, so take that count back or
+        // replay drifts from the recording.
+        if (rr_on()) {
+            cpu->rr_guest_instr_count--;
+        }
+        if (panda_current_pc(cpu) == pc) {
+            skip_once = true;
+            skip_pc = pc;
+        }
+        cpu_loop_exit_noexc(cpu);
+    }
 
-    return ret;
+    return 0;
 }
 
 
 bool init_plugin(void *_self) {
-    // On init, register a callback but don't enable it
+    // On init, register callbacks but don't enable them
     self = _self;
 
-    panda_disable_tb_chaining();
-
-    c_callback.before_block_exec_invalidate_opt = before_block_exec_invalidate_opt;
-    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT, c_callback);
-    panda_disable_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT, c_callback);
-
-    panda_enable_memcb();
+    c_translate.insn_translate = insn_translate;
+    c_exec.insn_exec = insn_exec;
+    c_block.after_block_translate = after_block_translate;
+    panda_register_callback(self, PANDA_CB_INSN_TRANSLATE, c_translate);
+    panda_register_callback(self, PANDA_CB_INSN_EXEC, c_exec);
+    panda_register_callback(self, PANDA_CB_AFTER_BLOCK_TRANSLATE, c_block);
+    disable_hooking();
 
     return true;
 }
@@ -10,6 +10,10 @@
 #include <cstdlib>
 #include <cerrno>
 #include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <glib.h>
 
 #include "panda/plugin.h"
@@ -157,6 +161,17 @@ void fill_osiproc(CPUState *cpu, OsiProc *p, target_ptr_t task_addr) {
     p->pages = NULL;  // OsiPage - TODO
 }
 
+/**
+ * @brief Does a batch of reads with panda_virtual_memory_readv(), zeroing
+ * the fields that can't be read (like the get_* accessors).
+ */
+static void read_fields(CPUState *env, PandaVirtRead *reads, int n) {
+    if (panda_virtual_memory_readv(env, reads, n) == 0) return;
+    for (int i = 0; i < n; i++) {
+        if (reads[i].ret != 0) memset(reads[i].buf, 0, reads[i].len);
+    }
+}
+
 /**
  * @brief Fills an OsiModule struct.
  */
@@ -166,9 +181,13 @@ static void fill_osimodule(CPUState *env, OsiModule *m, target_ptr_t vma_addr) {
     target_ptr_t vma_dentry;
     target_ptr_t mm_addr, start_brk, brk, start_stack;
 
-    vma_start = get_vma_start(env, vma_addr);
-    vma_end = get_vma_end(env, vma_addr);
-    vma_vm_file = get_vma_vm_file(env, vma_addr);
+    PandaVirtRead vma_fields[] = {
+        {vma_addr + ki.vma.vm_start_offset, (uint8_t *)&vma_start, sizeof(vma_start), 0},
+        {vma_addr + ki.vma.vm_end_offset, (uint8_t *)&vma_end, sizeof(vma_end), 0},
+        {vma_addr + ki.vma.vm_file_offset, (uint8_t *)&vma_vm_file, sizeof(vma_vm_file), 0},
+        {vma_addr + ki.vma.vm_mm_offset, (uint8_t *)&mm_addr, sizeof(mm_addr), 0},
+    };
+    read_fields(env, vma_fields, sizeof(vma_fields) / sizeof(vma_fields[0]));
 
     // Fill everything but m->name and m->file.
     m->modd = vma_addr;
@@ -182,10 +201,12 @@ static void fill_osimodule(CPUState *env, OsiModule *m, target_ptr_t vma_addr) {
         m->name = g_strrstr(m->file, "/");
         if (m->name != NULL) m->name = g_strdup(m->name + 1);
     } else {  // Other memory areas.
-        mm_addr = get_vma_vm_mm(env, vma_addr);
-        start_brk = get_mm_start_brk(env, mm_addr);
-        brk = get_mm_brk(env, mm_addr);
-        start_stack = get_mm_start_stack(env, mm_addr);
+        PandaVirtRead mm_fields[] = {
+            {mm_addr + ki.mm.start_brk_offset, (uint8_t *)&start_brk, sizeof(start_brk), 0},
+            {mm_addr + ki.mm.brk_offset, (uint8_t *)&brk, sizeof(brk), 0},
+            {mm_addr + ki.mm.start_stack_offset, (uint8_t *)&start_stack, sizeof(start_stack), 0},
+        };
+        read_fields(env, mm_fields, sizeof(mm_fields) / sizeof(mm_fields[0]));
 
         m->file = NULL;
         if (vma_start <= start_brk && vma_end >= brk) {
@@ -272,6 +293,252 @@ bool osi_guest_is_ready(CPUState *cpu, void** ret) {
     return false;
 }
 
+/* ******************************************************************
+ Process table
+****************************************************************** */
+/*
+ * With the incremental argument, the process list and the mappings of
+ * each process are walked once and then served from memory until a
+ * syscall that may change them returns (clone/fork/wait for the list,
+ * mmap & co for the mappings of the calling process), a process exits or
+ * execs, or a task we haven't seen gets scheduled. execve doesn't return
+ * to where it was called from, so exits and execs are noted on entry and
+ * acted on at the next address space switch. The new name of an execing
+ * process is set a little after its mm is, so it is walked once more when
+ * it is first seen in user mode (or switched away from). Every rewalk_instr
+ * instructions everything is walked again anyway, to pick up changes no
+ * syscall tells us about (e.g. the stack vma growing).
+ */
+enum SyscallEffect {
+    SE_NONE,
+    SE_PROCS,       // the process list (or a name in it) may change
+    SE_EXIT,        // the calling task is about to go away
+    SE_EXEC,        // the calling process gets a new name and mappings
+    SE_MAPPINGS,    // the calling process's mappings may change
+};
+
+static bool table_enabled = false;
+static bool table_pandalog = false;
+static uint64_t table_rewalk_instr = 0;
+static uint64_t table_last_walk = 0;
+
+static bool procs_valid = false;
+static bool check_current = false;       // scheduled task may be new
+static bool switch_pending = false;      // rewalk after the next switch
+static target_ptr_t exec_leader = (target_ptr_t)NULL; // execing, if any
+static bool exec_switched = false;       // exec_leader is on its new mm
+static std::vector<OsiProc> table_procs;
+static std::unordered_map<target_ptr_t, size_t> table_by_taskd;
+// tasks current at some point that a walk didn't find (e.g. swapper)
+static std::unordered_set<target_ptr_t> table_unlisted;
+static std::unordered_map<target_ptr_t, GArray *> table_mappings;
+
+static SyscallEffect syscall_effect(const syscall_info_t *call) {
+    static const std::unordered_map<std::string, SyscallEffect> by_name = {
+        {"sys_clone", SE_PROCS}, {"sys_clone3", SE_PROCS},
+        {"sys_fork", SE_PROCS}, {"sys_vfork", SE_PROCS},
+        {"sys_wait4", SE_PROCS}, {"sys_waitid", SE_PROCS},
+        {"sys_waitpid", SE_PROCS}, {"sys_prctl", SE_PROCS},
+        {"sys_exit", SE_EXIT}, {"sys_exit_group", SE_EXIT},
+        {"sys_execve", SE_EXEC}, {"sys_execveat", SE_EXEC},
+        {"sys_mmap", SE_MAPPINGS}, {"sys_mmap2", SE_MAPPINGS},
+        {"sys_mmap_pgoff", SE_MAPPINGS}, {"sys_old_mmap", SE_MAPPINGS},
+        {"sys_munmap", SE_MAPPINGS}, {"sys_mremap", SE_MAPPINGS},
+        {"sys_mprotect", SE_MAPPINGS}, {"sys_pkey_mprotect", SE_MAPPINGS},
+        {"sys_brk", SE_MAPPINGS}, {"sys_madvise", SE_MAPPINGS},
+        {"sys_remap_file_pages", SE_MAPPINGS},
+        {"sys_shmat", SE_MAPPINGS}, {"sys_shmdt", SE_MAPPINGS},
+    };
+    static std::unordered_map<int, SyscallEffect> by_no;
+
+    auto it = by_no.find(call->no);
+    if (it != by_no.end()) return it->second;
+    auto n = by_name.find(call->name);
+    SyscallEffect e = (n == by_name.end()) ? SE_NONE : n->second;
+    by_no[call->no] = e;
+    return e;
+}
+
+static void clear_procs(void) {
+    for (auto &p : table_procs) free_osiproc_contents(&p);
+    table_procs.clear();
+    table_by_taskd.clear();
+    procs_valid = false;
+}
+
+static void clear_mappings(target_ptr_t taskd) {
+    auto it = table_mappings.find(taskd);
+    if (it == table_mappings.end()) return;
+    g_array_free(it->second, true);
+    table_mappings.erase(it);
+}
+
+static void clear_all_mappings(void) {
+    for (auto &kvp : table_mappings) g_array_free(kvp.second, true);
+    table_mappings.clear();
+}
+
+static target_ptr_t current_leader(CPUState *cpu) {
+    target_ptr_t ts = kernel_profile->get_current_task_struct(cpu);
+    if (ts == (target_ptr_t)NULL) return (target_ptr_t)NULL;
+    return kernel_profile->get_group_leader(cpu, ts);
+}
+
+static void write_proc_table(void) {
+    std::vector<Panda__OsiProcEntry> entries(table_procs.size());
+    std::vector<Panda__OsiProcEntry *> ptrs(table_procs.size());
+    for (size_t i = 0; i < table_procs.size(); i++) {
+        const OsiProc &p = table_procs[i];
+        entries[i] = PANDA__OSI_PROC_ENTRY__INIT;
+        entries[i].taskd = p.taskd;
+        entries[i].asid = p.asid;
+        entries[i].pid = p.pid;
+        entries[i].ppid = p.ppid;
+        entries[i].name = p.name;
+        ptrs[i] = &entries[i];
+    }
+    Panda__OsiProcTable pt = PANDA__OSI_PROC_TABLE__INIT;
+    pt.n_procs = ptrs.size();
+    pt.procs = ptrs.data();
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.osi_proc_table = &pt;
+    pandalog_write_entry(&ple);
+}
+
+static void walk_procs(CPUState *cpu) {
+    GArray *ps = NULL;
+
+    clear_procs();
+    get_process_info<>(cpu, &ps, fill_osiproc, free_osiproc_contents);
+    if (ps != NULL) {
+        for (uint32_t i = 0; i < ps->len; i++) {
+            OsiProc &p = g_array_index(ps, OsiProc, i);
+            table_by_taskd[p.taskd] = table_procs.size();
+            table_procs.push_back(p);
+        }
+        // the table owns the names now
+        g_array_set_clear_func(ps, NULL);
+        g_array_free(ps, true);
+    }
+    procs_valid = true;
+    table_last_walk = rr_get_guest_instr_count();
+
+    // forget the mappings of processes that are gone
+    for (auto it = table_mappings.begin(); it != table_mappings.end(); ) {
+        if (table_by_taskd.count(it->first)) {
+            ++it;
+        } else {
+            g_array_free(it->second, true);
+            it = table_mappings.erase(it);
+        }
+    }
+
+    if (table_pandalog && pandalog) write_proc_table();
+}
+
+/**
+ * @brief Brings the process table up to date.
+ */
+static void update_procs(CPUState *cpu) {
+    if (exec_switched && !panda_in_kernel(cpu)) {
+        // back from execve: the name has been set now
+        procs_valid = false;
+        clear_mappings(exec_leader);
+        exec_leader = (target_ptr_t)NULL;
+        exec_switched = false;
+    }
+    if (table_rewalk_instr &&
+            rr_get_guest_instr_count() - table_last_walk >= table_rewalk_instr) {
+        clear_procs();
+        clear_all_mappings();
+        table_unlisted.clear();
+    }
+    if (procs_valid && check_current) {
+        target_ptr_t leader = current_leader(cpu);
+        if (leader != (target_ptr_t)NULL && !table_by_taskd.count(leader) &&
+                !table_unlisted.count(leader)) {
+            procs_valid = false;
+        }
+    }
+    if (!procs_valid) {
+        walk_procs(cpu);
+        if (check_current) {
+            target_ptr_t leader = current_leader(cpu);
+            if (!table_by_taskd.count(leader)) table_unlisted.insert(leader);
+        }
+    }
+    check_current = false;
+}
+
+static const OsiProc *table_lookup(CPUState *cpu, target_ptr_t taskd) {
+    update_procs(cpu);
+    auto it = table_by_taskd.find(taskd);
+    return (it == table_by_taskd.end()) ? NULL : &table_procs[it->second];
+}
+
+void table_sys_enter(CPUState *cpu, target_ulong pc, const syscall_info_t *call,
+                     const syscall_ctx_t *ctx) {
+    if (call == NULL) return;
+    switch (syscall_effect(call)) {
+        case SE_EXIT:
+            // the task is still listed until it's switched away from (and
+            // then until it's reaped, which a wait syscall will tell us about)
+            clear_mappings(current_leader(cpu));
+            procs_valid = false;
+            switch_pending = true;
+            break;
+        case SE_EXEC:
+            // a successful exec switches to the new mm; the name, asid and
+            // mappings are only worth walking again after that
+            exec_leader = current_leader(cpu);
+            clear_mappings(exec_leader);
+            procs_valid = false;
+            switch_pending = true;
+            break;
+        default:
+            break;
+    }
+}
+
+void table_sys_return(CPUState *cpu, target_ulong pc, const syscall_info_t *call,
+                      const syscall_ctx_t *ctx) {
+    if (call == NULL) {
+        // no syscall info for this call: assume the worst
+        procs_valid = false;
+        clear_all_mappings();
+        return;
+    }
+    switch (syscall_effect(call)) {
+        case SE_PROCS:
+            procs_valid = false;
+            break;
+        case SE_MAPPINGS:
+            clear_mappings(current_leader(cpu));
+            break;
+        default:
+            break;
+    }
+}
+
+bool table_asid_changed(CPUState *cpu, target_ulong oldval, target_ulong newval) {
+    check_current = true;
+    if (exec_switched) {
+        procs_valid = false;
+        clear_mappings(exec_leader);
+        exec_leader = (target_ptr_t)NULL;
+        exec_switched = false;
+    }
+    if (switch_pending) {
+        procs_valid = false;
+        if (exec_leader != (target_ptr_t)NULL) {
+            clear_mappings(exec_leader);
+            exec_switched = true;
+        }
+        switch_pending = false;
+    }
+    return false;
+}
+
 /* ******************************************************************
  PPP Callbacks
 ****************************************************************** */
@@ -282,6 +549,19 @@ bool osi_guest_is_ready(CPUState *cpu, void** ret) {
  */
 void on_get_processes(CPUState *env, GArray **out) {
     if (!osi_guest_is_ready(env, (void**)out)) return;
+    if (table_enabled) {
+        update_procs(env);
+        if (*out == NULL) {
+            *out = g_array_sized_new(false, false, sizeof(OsiProc), table_procs.size());
+            g_array_set_clear_func(*out, (GDestroyNotify)free_osiproc_contents);
+        }
+        for (auto &p : table_procs) {
+            OsiProc c;
+            copy_osiproc(&p, (OsiProc *)memset(&c, 0, sizeof(c)));
+            g_array_append_val(*out, c);
+        }
+        return;
+    }
     // instantiate and call function from get_process_info template
     get_process_info<>(env, out, fill_osiproc, free_osiproc_contents);
 }
@@ -291,6 +571,18 @@ void on_get_processes(CPUState *env, GArray **out) {
  */
 void on_get_process_handles(CPUState *env, GArray **out) {
     if (!osi_guest_is_ready(env, (void**)out)) return;
+    if (table_enabled) {
+        update_procs(env);
+        if (*out == NULL) {
+            *out = g_array_sized_new(false, false, sizeof(OsiProcHandle), table_procs.size());
+            g_array_set_clear_func(*out, (GDestroyNotify)free_osiprochandle_contents);
+        }
+        for (auto &p : table_procs) {
+            OsiProcHandle h = { p.taskd, p.asid };
+            g_array_append_val(*out, h);
+        }
+        return;
+    }
 
     // instantiate and call function from get_process_info template
     get_process_info<>(env, out, fill_osiprochandle, free_osiprochandle_contents);
@@ -366,8 +658,13 @@ void on_get_process(CPUState *env, const OsiProcHandle *h, OsiProc **out) {
 
     OsiProc *p = NULL;
     if (h != NULL && h->taskd != (target_ptr_t)NULL) {
-        p = (OsiProc *)g_malloc(sizeof(OsiProc));
-        fill_osiproc(env, p, h->taskd);
+        const OsiProc *known = table_enabled ? table_lookup(env, h->taskd) : NULL;
+        if (known != NULL) {
+            p = copy_osiproc(const_cast<OsiProc *>(known), NULL);
+        } else {
+            p = (OsiProc *)g_malloc(sizeof(OsiProc));
+            fill_osiproc(env, p, h->taskd);
+        }
     }
     *out = p;
 }
@@ -381,9 +678,46 @@ void on_get_process(CPUState *env, const OsiProcHandle *h, OsiProc **out) {
  *
  * @todo Remove duplicates from results.
  */
+static void walk_mappings(CPUState *env, OsiProc *p, GArray **out);
+
 void on_get_mappings(CPUState *env, OsiProc *p, GArray **out) {
     if (!osi_guest_is_ready(env, (void**)out)) return;
+    if (!table_enabled) {
+        walk_mappings(env, p, out);
+        return;
+    }
+
+    update_procs(env);
+    auto it = table_mappings.find(p->taskd);
+    if (it == table_mappings.end()) {
+        GArray *ms = NULL;
+        walk_mappings(env, p, &ms);
+        if (ms == NULL) {
+            // leave *out as the walk would have
+            if (*out != NULL) g_array_free(*out, true);
+            *out = NULL;
+            return;
+        }
+        it = table_mappings.emplace(p->taskd, ms).first;
+    }
+
+    GArray *ms = it->second;
+    if (*out == NULL) {
+        *out = g_array_sized_new(false, false, sizeof(OsiModule), ms->len);
+        g_array_set_clear_func(*out, (GDestroyNotify)free_osimodule_contents);
+    }
+    for (uint32_t i = 0; i < ms->len; i++) {
+        OsiModule m;
+        memset(&m, 0, sizeof(m));
+        copy_osimod(&g_array_index(ms, OsiModule, i), &m);
+        g_array_append_val(*out, m);
+    }
+}
 
+/**
+ * @brief Reads the mappings of process \p p from guest memory.
+ */
+static void walk_mappings(CPUState *env, OsiProc *p, GArray **out) {
     OsiModule m;
     target_ptr_t vma_first, vma_current;
 
@@ -642,6 +976,9 @@ bool init_plugin(void *self) {
     char *kconf_file = g_strdup(panda_parse_string_opt(plugin_args, "kconf_file", NULL, "file containing kernel configuration information"));
     char *kconf_group = g_strdup(panda_parse_string_opt(plugin_args, "kconf_group", NULL, "kernel profile to use"));
     osi_initialized = panda_parse_bool_opt(plugin_args, "load_now", "Raise a fatal error if OSI cannot be initialized immediately");
+    table_enabled = panda_parse_bool_opt(plugin_args, "incremental", "Keep the process list and mappings in memory, updated from syscalls");
+    table_rewalk_instr = panda_parse_uint64_opt(plugin_args, "rewalk_instr", 0, "With incremental, walk everything again every this many instructions (0: never)");
+    table_pandalog = panda_parse_bool_opt(plugin_args, "pandalog", "With incremental, write the process list to the pandalog whenever it is walked");
     panda_free_args(plugin_args);
 
     if (!kconf_file) {
@@ -719,6 +1056,17 @@ bool init_plugin(void *self) {
       PPP_REG_CB("syscalls2", on_all_sys_enter, on_first_syscall);
     }
 
+    // The process table needs to know which syscalls are which
+    if (table_enabled) {
+        panda_add_arg("syscalls2", "load-info=true");
+        panda_require("syscalls2");
+        PPP_REG_CB("syscalls2", on_all_sys_enter2, table_sys_enter);
+        PPP_REG_CB("syscalls2", on_all_sys_return2, table_sys_return);
+
+        panda_cb pcb = { .asid_changed = table_asid_changed };
+        panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
+    }
+
 
     return true;
 #else
@@ -735,7 +1083,8 @@ error:
  */
 void uninit_plugin(void *self) {
 #if defined(TARGET_I386) || defined(TARGET_ARM)
-    // Nothing to do...
+    clear_procs();
+    clear_all_mappings();
 #endif
     return;
 }
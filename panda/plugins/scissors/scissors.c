@@ -11,6 +11,7 @@
 #include "panda/plugin.h"
 #include "panda/rr/rr_log.h"
 #include "panda/rr/rr_api.h"
+#include "panda/rr/rr_chunk.h"
 #include "panda/common.h"
 
 #include "migration/migration.h"
@@ -219,7 +220,17 @@ static RR_prog_point copy_entry(void) {
 }
 
 static void start_snip(uint64_t count) {
-    sassert((oldlog = fopen(rr_nondet_log->name, "r")), 8);
+    if (rr_nondet_log->chunked) {
+        // copy from the uncompressed stream of a v2 log; file_pos offsets
+        // refer to that stream.
+        RR_chunked_log *v2 = rr_chunked_open_read(rr_nondet_log->name);
+        sassert(v2 && (oldlog = tmpfile()), 8);
+        rr_chunked_to_stream(v2, oldlog);
+        rr_chunked_close(v2);
+        rewind(oldlog);
+    } else {
+        sassert((oldlog = fopen(rr_nondet_log->name, "r")), 8);
+    }
     rr_nondet_log_type = rr_nondet_log->type;
     rr_nondet_log_size = rr_nondet_log->size;
     sassert(fread(&orig_last_prog_point, sizeof(RR_prog_point), 1, oldlog) == 1, 9);
@@ -247,7 +258,7 @@ static void start_snip(uint64_t count) {
     fwrite(&prog_point.guest_instr_count,
            sizeof(prog_point.guest_instr_count), 1, newlog);
     
-    fseek(oldlog, ftell(rr_nondet_log->fp), SEEK_SET);
+    fseek(oldlog, rr_nondet_log->bytes_read, SEEK_SET);
     
     // If there are items in the queue, then start copying the log
     // from there
@@ -0,0 +1,98 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#include <cassert>
+#include <cctype>
+
+#include "aho_corasick.h"
+
+size_t AhoCorasick::add(const uint8_t *pat, size_t len) {
+    assert(!compiled);
+    assert(len > 0);
+    patterns.push_back(std::string((const char *)pat, len));
+    return patterns.size() - 1;
+}
+
+void AhoCorasick::compile() {
+    assert(!compiled);
+    compiled = true;
+
+    // Byte classes. Class 0 is every byte no pattern uses.
+    uint8_t fold[256];
+    bool used[256] = {};
+    uint16_t cls[256];
+    for (int b = 0; b < 256; b++) {
+        fold[b] = nocase ? tolower(b) : b;
+    }
+    for (auto &p : patterns) {
+        for (unsigned char c : p) {
+            used[fold[c]] = true;
+        }
+    }
+    num_classes = 1;
+    for (int b = 0; b < 256; b++) {
+        cls[b] = used[b] ? num_classes++ : 0;
+    }
+    for (int b = 0; b < 256; b++) {
+        byte_class[b] = cls[fold[b]];
+    }
+
+    // Trie. An entry of 0 means "no edge"; nothing ever goes back to the root.
+    std::vector<std::vector<uint32_t>> own(1);
+    delta.assign(num_classes, 0);
+    num_states_ = 1;
+    for (size_t idx = 0; idx < patterns.size(); idx++) {
+        uint32_t s = 0;
+        for (unsigned char c : patterns[idx]) {
+            size_t e = (size_t)s * num_classes + byte_class[c];
+            if (delta[e] == 0) {
+                delta[e] = num_states_++;
+                delta.resize(num_states_ * num_classes, 0);
+                own.emplace_back();
+            }
+            s = delta[e];
+        }
+        own[s].push_back(idx);
+    }
+
+    // Fail links and the full DFA, breadth first so a state's fail target
+    // (always shallower) has its row completed before the state itself.
+    fail.assign(num_states_, 0);
+    out_link.assign(num_states_, 0);
+    std::vector<uint32_t> order;
+    order.reserve(num_states_);
+    for (size_t k = 0; k < num_classes; k++) {
+        if (delta[k] != 0) {
+            order.push_back(delta[k]);
+        }
+    }
+    for (size_t qi = 0; qi < order.size(); qi++) {
+        uint32_t s = order[qi];
+        out_link[s] = own[s].empty() ? out_link[fail[s]] : s;
+        uint32_t *row = &delta[(size_t)s * num_classes];
+        const uint32_t *frow = &delta[(size_t)fail[s] * num_classes];
+        for (size_t k = 0; k < num_classes; k++) {
+            if (row[k] != 0) {
+                fail[row[k]] = frow[k];
+                order.push_back(row[k]);
+            } else {
+                row[k] = frow[k];
+            }
+        }
+    }
+
+    out_off.assign(num_states_ + 1, 0);
+    out_ids.clear();
+    for (size_t s = 0; s < num_states_; s++) {
+        out_off[s] = out_ids.size();
+        out_ids.insert(out_ids.end(), own[s].begin(), own[s].end());
+    }
+    out_off[num_states_] = out_ids.size();
+
+    for (int b = 0; b < 256; b++) {
+        starts[b] = delta[byte_class[b]] != 0;
+    }
+}
@@ -0,0 +1,87 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __AHO_CORASICK_H_
+#define __AHO_CORASICK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Multi-pattern matcher: an Aho-Corasick automaton compiled into a dense DFA.
+//
+// Bytes are first mapped to equivalence classes (every byte that appears in
+// no pattern shares class 0, and with nocase upper and lower case letters
+// share a class), so the transition table is num_states x num_classes
+// instead of num_states x 256. A matcher's whole state is one uint32_t, with
+// 0 being the root ("nothing matched so far").
+class AhoCorasick {
+public:
+    explicit AhoCorasick(bool nocase = false) : nocase(nocase), compiled(false) {}
+
+    // Adds a pattern and returns its index. Only valid before compile().
+    size_t add(const uint8_t *pat, size_t len);
+    void compile();
+
+    size_t num_patterns() const { return patterns.size(); }
+    size_t num_states() const { return num_states_; }
+    const std::string &pattern(size_t idx) const { return patterns[idx]; }
+
+    // Can a match start with b? Used to skip accesses cheaply while a
+    // matcher is at the root.
+    bool can_start(uint8_t b) const { return starts[b]; }
+
+    // Do the pattern(idx).size() bytes at buf spell pattern idx (ignoring
+    // case with nocase)?
+    bool matches(size_t idx, const uint8_t *buf) const {
+        const std::string &p = patterns[idx];
+        for (size_t i = 0; i < p.size(); i++) {
+            if (byte_class[buf[i]] != byte_class[(uint8_t)p[i]]) return false;
+        }
+        return true;
+    }
+
+    uint32_t step(uint32_t state, uint8_t b) const {
+        return delta[(size_t)state * num_classes + byte_class[b]];
+    }
+
+    // Runs the automaton over buf starting in state, calling
+    // on_match(pattern_idx, offset_of_last_byte) for every match, and
+    // returns the final state.
+    template <typename F>
+    uint32_t scan(uint32_t state, const uint8_t *buf, size_t len,
+                  F on_match) const {
+        for (size_t i = 0; i < len; i++) {
+            state = step(state, buf[i]);
+            for (uint32_t s = out_link[state]; s != 0; s = out_link[fail[s]]) {
+                for (uint32_t o = out_off[s]; o < out_off[s + 1]; o++) {
+                    on_match(out_ids[o], i);
+                }
+            }
+        }
+        return state;
+    }
+
+private:
+    bool nocase;
+    bool compiled;
+    std::vector<std::string> patterns;
+
+    uint16_t byte_class[256];
+    bool starts[256];
+    size_t num_classes;
+    size_t num_states_;
+
+    std::vector<uint32_t> delta;     // num_states x num_classes
+    std::vector<uint32_t> fail;
+    std::vector<uint32_t> out_link;  // nearest state (self included) on the
+                                     // fail chain that ends a pattern, or 0
+    std::vector<uint32_t> out_off;   // patterns ending exactly at state s are
+    std::vector<uint32_t> out_ids;   // out_ids[out_off[s] .. out_off[s+1])
+};
+
+#endif
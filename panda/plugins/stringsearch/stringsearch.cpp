@@ -24,6 +24,7 @@ PANDAENDCOMMENT */
 #include <sstream>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include "panda/plugin.h"
 
@@ -31,6 +32,8 @@ extern "C" {
 #include "stringsearch.h"
 }
 
+#include "aho_corasick.h"
+
 #include "callstack_instr/callstack_instr.h"
 #include "callstack_instr/callstack_instr_ext.h"
 
@@ -50,15 +53,6 @@ PPP_PROT_REG_CB(on_ssm);
 
 }
 
-// Silly: since we use these as map values, they have to be
-// copy constructible. Plain arrays aren't, but structs containing
-// arrays are. So we make these goofy wrappers.
-struct match_strings {
-    int val[MAX_STRINGS];
-};
-struct string_pos {
-    uint32_t val[MAX_STRINGS];
-};
 struct fullstack {
     int n;
     target_ulong callers[MAX_CALLERS];
@@ -68,12 +62,90 @@ struct fullstack {
     stack_type stackKind;
 };
 
+// Automaton state of the matcher at each prog point, in an open-addressing
+// table: this is looked up on every searched memory access.
+class matcher_states {
+public:
+    matcher_states() : used(0), nonroot(0) { slots.resize(1024); }
+
+    // Number of prog points in the middle of a possible match. While this is
+    // 0, accesses that can't start a match don't need a lookup at all.
+    size_t active() const { return nonroot; }
+
+    uint32_t get(const prog_point &p) {
+        return slots[find(p)].state;
+    }
+
+    void set(const prog_point &p, uint32_t state) {
+        size_t i = find(p);
+        if (!slots[i].used) {
+            // Prog points at the root don't need an entry
+            if (state == 0) return;
+            slots[i].used = true;
+            slots[i].p = p;
+            slots[i].state = state;
+            nonroot++;
+            if (++used * 2 > slots.size()) grow();
+            return;
+        }
+        if (slots[i].state == 0 && state != 0) nonroot++;
+        if (slots[i].state != 0 && state == 0) nonroot--;
+        slots[i].state = state;
+    }
+
+private:
+    struct slot {
+        prog_point p;
+        uint32_t state;
+        bool used;
+    };
+    std::vector<slot> slots;
+    size_t used;
+    size_t nonroot;
+
+    static uint64_t hash(const prog_point &p) {
+        uint64_t h = p.pc;
+        h = (h ^ p.caller) * 0x9e3779b97f4a7c15ULL;
+        h = (h ^ p.sidFirst) * 0x9e3779b97f4a7c15ULL;
+        h = (h ^ p.sidSecond) * 0x9e3779b97f4a7c15ULL;
+        h ^= ((uint64_t)p.stackKind << 1) | p.isKernelMode;
+        return h ^ (h >> 29);
+    }
+
+    // Slot holding p, or the empty slot where it would go
+    size_t find(const prog_point &p) const {
+        size_t mask = slots.size() - 1;
+        size_t i = hash(p) & mask;
+        while (slots[i].used && !(slots[i].p == p)) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    void grow() {
+        std::vector<slot> old(slots.size() * 2);
+        old.swap(slots);
+        for (auto &s : old) {
+            if (s.used) {
+                slots[find(s.p)] = s;
+            }
+        }
+    }
+};
+
+// A search string as given by the user; its automaton patterns (the plain
+// and the UTF-16 form with wide=1) all point back here.
+struct search_string {
+    std::string bytes;
+};
+
 std::map<prog_point,fullstack> matchstacks;
-std::map<prog_point,match_strings> matches;
-std::map<prog_point,string_pos> read_text_tracker;
-std::map<prog_point,string_pos> write_text_tracker;
-uint8_t tofind[MAX_STRINGS][MAX_STRLEN];
-uint32_t strlens[MAX_STRINGS];
+std::map<prog_point,std::vector<int>> matches;
+matcher_states read_text_tracker;
+matcher_states write_text_tracker;
+std::vector<search_string> search_strings;
+std::vector<int> pattern_string;    // automaton pattern -> search string
+AhoCorasick *automaton;
 int num_strings = 0;
 int n_callers = 16;
 
@@ -85,58 +157,59 @@ PPP_CB_BOILERPLATE(on_ssm)
 
 void mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                   size_t size, uint8_t *buf, bool is_write,
-                  std::map<prog_point, string_pos> &text_tracker) {
+                  matcher_states &text_tracker) {
+    // Every prog point is at the root, so unless some byte can start a
+    // match this access can't change anything
+    if (text_tracker.active() == 0) {
+        size_t i;
+        for (i = 0; i < size && !automaton->can_start(buf[i]); i++);
+        if (i == size) return;
+    }
+
     prog_point p = {};
     get_prog_point(env, &p);
 
-    string_pos &sp = text_tracker[p];
-
-    for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        for(int str_idx = 0; str_idx < num_strings; str_idx++) {
-            if (tofind[str_idx][sp.val[str_idx]] == val)
-                sp.val[str_idx]++;
-            else
-                sp.val[str_idx] = 0;
-
-            if (sp.val[str_idx] == strlens[str_idx]) {
-                // Victory!
-                char *sid_string = get_stackid_string(p);
-                printf("%s Match of str %d at: instr_count=%" PRIu64 " :  "
-                       TARGET_FMT_lx " " TARGET_FMT_lx " %s\n",
-                       (is_write ? "WRITE" : "READ"), str_idx,
-                       rr_get_guest_instr_count(), p.caller, p.pc, sid_string);
-                matches[p].val[str_idx]++;
-                sp.val[str_idx] = 0;
-                g_free(sid_string);
-
-                // Also get the full stack here
-                fullstack f = {0};
-                f.n = get_callers(f.callers, n_callers, env);
-                f.pc = p.pc;
-                f.sidFirst = p.sidFirst;
-                f.sidSecond = p.sidSecond;
-                f.stackKind = p.stackKind;
-                matchstacks[p] = f;
-
-                // Check if the full string is in memory.
-                uint8_t *tmp =
-                    (uint8_t *)calloc(strlens[str_idx] + 1, sizeof(*tmp));
-                target_ulong match_addr = (addr + i) - (strlens[str_idx] - 1);
-                panda_virtual_memory_read(env, match_addr, tmp,
-                                          strlens[str_idx]);
-                bool in_memory =
-                    memcmp(tmp, tofind[str_idx], strlens[str_idx]) == 0;
-                free(tmp);
-
-                // call the i-found-a-match registered callbacks here
-                PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
-                           tofind[str_idx], strlens[str_idx], is_write,
-                           in_memory);
-            }
-        }
-    }
- 
+    uint32_t state = text_tracker.get(p);
+    state = automaton->scan(state, buf, size, [&](size_t pat, size_t i) {
+        int str_idx = pattern_string[pat];
+        const std::string &found = automaton->pattern(pat);
+        uint32_t len = found.size();
+
+        // Victory!
+        char *sid_string = get_stackid_string(p);
+        printf("%s Match of str %d at: instr_count=%" PRIu64 " :  "
+               TARGET_FMT_lx " " TARGET_FMT_lx " %s\n",
+               (is_write ? "WRITE" : "READ"), str_idx,
+               rr_get_guest_instr_count(), p.caller, p.pc, sid_string);
+        std::vector<int> &counts = matches[p];
+        if (counts.empty()) counts.resize(num_strings);
+        counts[str_idx]++;
+        g_free(sid_string);
+
+        // Also get the full stack here
+        fullstack f = {0};
+        f.n = get_callers(f.callers, n_callers, env);
+        f.pc = p.pc;
+        f.sidFirst = p.sidFirst;
+        f.sidSecond = p.sidSecond;
+        f.stackKind = p.stackKind;
+        matchstacks[p] = f;
+
+        // Check if the full string is in memory. Read it back rather than
+        // comparing with the pattern, which is case-folded with nocase.
+        std::vector<uint8_t> tmp(len);
+        target_ulong match_addr = (addr + i) - (len - 1);
+        bool in_memory =
+            panda_virtual_memory_read(env, match_addr, tmp.data(), len) == 0 &&
+            automaton->matches(pat, tmp.data());
+        uint8_t *matched = in_memory ? tmp.data() : (uint8_t *)found.data();
+
+        // call the i-found-a-match registered callbacks here
+        PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
+                   matched, len, is_write, in_memory);
+    });
+    text_tracker.set(p, state);
+
     return;
 }
 
@@ -164,14 +237,18 @@ bool init_plugin(void *self) {
     const char *arg_str = panda_parse_string_opt(args, "str", "", "a single string to search for");
     size_t arg_len = strlen(arg_str);
     if (arg_len > 0) {
-        memcpy(tofind[num_strings], arg_str, arg_len);
-        strlens[num_strings] = arg_len;
-        num_strings++;
+        search_strings.push_back({std::string(arg_str, arg_len)});
     }
 
     n_callers = panda_parse_uint64_opt(args, "callers", 16, "depth of callstack for matches");
     if (n_callers > MAX_CALLERS) n_callers = MAX_CALLERS;
 
+    target_ulong watch_start = panda_parse_ulong_opt(args, "start", 0, "only search accesses in [start, start+len)");
+    target_ulong watch_len = panda_parse_ulong_opt(args, "len", 0, "length of the range to search, 0 for all of memory");
+    target_ulong watch_asid = panda_parse_ulong_opt(args, "asid", 0, "only search accesses made in this address space, 0 for all");
+    bool nocase = panda_parse_bool_opt(args, "nocase", "ignore ASCII case when matching");
+    bool wide = panda_parse_bool_opt(args, "wide", "also search for the UTF-16LE form of each string");
+
     const char *prefix = panda_parse_string_opt(args, "name", "", "prefix of filename containing search strings, which must have the suffix _search_strings.txt");
     if (strlen(prefix) > 0) {
         char stringsfile[128] = {};
@@ -179,8 +256,8 @@ bool init_plugin(void *self) {
 
         printf ("search strings file [%s]\n", stringsfile);
 
-        std::ifstream search_strings(stringsfile);
-        if (!search_strings) {
+        std::ifstream search_strings_file(stringsfile);
+        if (!search_strings_file) {
             printf("Couldn't open %s; no strings to search for. Exiting.\n", stringsfile);
             return false;
         }
@@ -189,34 +266,50 @@ bool init_plugin(void *self) {
         // 0a:1b:2c:3d:4e
         // or "string" (no newlines)
         std::string line;
-        while(std::getline(search_strings, line)) {
+        while(std::getline(search_strings_file, line)) {
             std::istringstream iss(line);
+            std::string bytes;
 
+            if (line.empty()) continue;
             if (line[0] == '"') {
                 size_t len = line.size() - 2;
-                memcpy(tofind[num_strings], line.substr(1, len).c_str(), len);
-                strlens[num_strings] = len;
+                bytes = line.substr(1, len);
             } else {
                 std::string x;
-                int i = 0;
                 while (std::getline(iss, x, ':')) {
-                    tofind[num_strings][i++] = (uint8_t)strtoul(x.c_str(), NULL, 16);
-                    if (i >= MAX_STRLEN) {
-                        printf("WARN: Reached max number of characters (%d) on string %d, truncating.\n", MAX_STRLEN, num_strings);
-                        break;
-                    }
+                    bytes.push_back((uint8_t)strtoul(x.c_str(), NULL, 16));
                 }
-                strlens[num_strings] = i;
             }
+            if (bytes.size() > MAX_STRLEN) {
+                printf("WARN: Reached max number of characters (%d) on string %zu, truncating.\n", MAX_STRLEN, search_strings.size());
+                bytes.resize(MAX_STRLEN);
+            }
+            if (bytes.empty()) continue;
 
-            printf("stringsearch: added string of length %d to search set\n", strlens[num_strings]);
-
-            if(++num_strings >= MAX_STRINGS) {
-                printf("WARN: maximum number of strings (%d) reached, will not load any more.\n", MAX_STRINGS);
-                break;
+            search_strings.push_back({bytes});
+            printf("stringsearch: added string of length %zu to search set\n", bytes.size());
+        }
+    }
+    num_strings = search_strings.size();
+
+    automaton = new AhoCorasick(nocase);
+    for (int i = 0; i < num_strings; i++) {
+        const std::string &b = search_strings[i].bytes;
+        automaton->add((const uint8_t *)b.data(), b.size());
+        pattern_string.push_back(i);
+        if (wide) {
+            std::string w;
+            for (char c : b) {
+                w.push_back(c);
+                w.push_back('\0');
             }
+            automaton->add((const uint8_t *)w.data(), w.size());
+            pattern_string.push_back(i);
         }
     }
+    automaton->compile();
+    printf("stringsearch: %d strings, %zu automaton states\n", num_strings,
+           automaton->num_states());
 
     char matchfile[128] = {};
     sprintf(matchfile, "%s_string_matches.txt", prefix);
@@ -231,8 +324,18 @@ bool init_plugin(void *self) {
 
     // Need this to get EIP with our callbacks
     panda_enable_precise_pc();
-    // Enable memory logging
-    panda_enable_memcb();
+    // Enable memory logging, just for the range if there is one
+    if (watch_len > 0 || watch_asid != 0) {
+        int kinds = PANDA_MEMCB_READ | PANDA_MEMCB_WRITE;
+        if (watch_asid != 0) kinds |= PANDA_MEMCB_ASID;
+        if (watch_len == 0) watch_len = (target_ulong)-1 - watch_start;
+        if (panda_memcb_watch(watch_start, watch_len, kinds, watch_asid) < 0) {
+            printf("Couldn't watch the search range\n");
+            return false;
+        }
+    } else {
+        panda_enable_memcb();
+    }
 
     pcb.virt_mem_before_write = mem_write_callback;
     panda_register_callback(self, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb);
@@ -244,7 +347,7 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    std::map<prog_point,match_strings>::iterator it;
+    std::map<prog_point,std::vector<int>>::iterator it;
     for(it = matches.begin(); it != matches.end(); it++) {
         // Print prog point
 
@@ -260,9 +363,10 @@ void uninit_plugin(void *self) {
 
         // Print strings that matched and how many times
         for(int i = 0; i < num_strings; i++)
-            fprintf(mem_report, " %d", it->second.val[i]);
+            fprintf(mem_report, " %d", it->second[i]);
         fprintf(mem_report, "\n");
         g_free(sid_string);
     }
     fclose(mem_report);
+    delete automaton;
 }
@@ -12,6 +12,7 @@ extern "C" {
 #include "syscall_ppp_extern_enter.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 /**
  * @brief Called when a system call invocation is identified.
@@ -40,7 +41,7 @@ void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc) {
 		{%- for arg in syscall.args %}
 		{{arg.emit_temp_assignment()}}
 		{%- endfor %}
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_{{syscall.name}}_return)))) {
 			{%- for arg in syscall.args %}
@@ -58,8 +59,10 @@ void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
+	if (syscall_trace_on) syscall_trace_enter(cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		watch_syscall_return(cpu, ctx.retaddr);
 	}
 #endif
 }
@@ -11,6 +11,7 @@ extern "C" {
 #include "syscalls_ext_typedefs.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 void syscall_return_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc, const syscall_ctx_t *ctx) {
 #if {{arch_conf.qemu_target}}
@@ -35,6 +36,7 @@ void syscall_return_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc, const
 	}
 	PPP_RUN_CB(on_all_sys_return, cpu, pc, ctx->no);
 	PPP_RUN_CB(on_all_sys_return2, cpu, pc, call, ctx);
+	if (syscall_trace_on) syscall_trace_return(cpu, pc, call, ctx);
 #endif
 }
 
@@ -12,6 +12,7 @@ extern "C" {
 #include "syscall_ppp_extern_enter.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 /**
  * @brief Called when a system call invocation is identified.
@@ -41,7 +42,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 1: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -59,7 +60,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_read_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -74,7 +75,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_write_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -89,7 +90,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -102,7 +103,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 6: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_close_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -114,7 +115,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_creat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -127,7 +128,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_link_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -139,7 +140,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 10: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -152,7 +153,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execve_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -165,7 +166,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 12: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -176,7 +177,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 13: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_time_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -189,7 +190,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -203,7 +204,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chmod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -217,7 +218,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -232,7 +233,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lseek_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -254,7 +255,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mount_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -269,7 +270,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 23: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -285,7 +286,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 25: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -299,7 +300,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ptrace_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -313,7 +314,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 27: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_alarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -330,7 +331,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -343,7 +344,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_access_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -355,7 +356,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 34: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -372,7 +373,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -385,7 +386,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rename_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -398,7 +399,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -410,7 +411,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 40: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rmdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -421,7 +422,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 41: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -432,7 +433,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 42: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -443,7 +444,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 43: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_times_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -454,7 +455,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 45: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_brk_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -465,7 +466,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 46: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -491,7 +492,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 51: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_acct_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -503,7 +504,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umount_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -517,7 +518,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -532,7 +533,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -546,7 +547,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -558,7 +559,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 60: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -569,7 +570,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 61: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chroot_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -581,7 +582,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ustat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -594,7 +595,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -623,7 +624,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -637,7 +638,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -650,7 +651,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -664,7 +665,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigsuspend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -677,7 +678,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 73: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigpending_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -689,7 +690,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sethostname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -702,7 +703,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setrlimit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -715,7 +716,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrusage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -728,7 +729,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -741,7 +742,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_settimeofday_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -754,7 +755,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -767,7 +768,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -780,7 +781,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -794,7 +795,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -807,7 +808,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 86: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_uselib_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -819,7 +820,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapon_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -834,7 +835,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_reboot_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -849,7 +850,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munmap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -862,7 +863,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -875,7 +876,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -888,7 +889,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -902,7 +903,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -916,7 +917,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpriority_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -930,7 +931,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpriority_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -944,7 +945,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -957,7 +958,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -970,7 +971,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketcall_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -984,7 +985,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syslog_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -999,7 +1000,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setitimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1013,7 +1014,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getitimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1026,7 +1027,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1039,7 +1040,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newlstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1052,7 +1053,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newfstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1072,7 +1073,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_wait4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1086,7 +1087,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 115: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapoff_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1097,7 +1098,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 116: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1113,7 +1114,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ipc_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1129,7 +1130,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 118: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1140,7 +1141,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 119: {
 		panda_noreturn = true;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigreturn_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1155,7 +1156,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clone_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1171,7 +1172,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setdomainname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1183,7 +1184,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 122: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newuname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1194,7 +1195,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 124: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_adjtimex_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1207,7 +1208,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mprotect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1222,7 +1223,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigprocmask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1237,7 +1238,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_init_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1251,7 +1252,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_delete_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1266,7 +1267,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_quotactl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1280,7 +1281,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 132: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1291,7 +1292,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 133: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1303,7 +1304,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bdflush_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1317,7 +1318,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1330,7 +1331,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 136: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_personality_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1341,7 +1342,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 138: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1352,7 +1353,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 139: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1367,7 +1368,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llseek_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1384,7 +1385,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1401,7 +1402,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_select_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1417,7 +1418,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1431,7 +1432,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1446,7 +1447,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1461,7 +1462,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_writev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1474,7 +1475,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 147: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1485,7 +1486,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 148: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fdatasync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1496,7 +1497,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 149: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1508,7 +1509,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1521,7 +1522,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munlock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1533,7 +1534,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 152: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlockall_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1550,7 +1551,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1563,7 +1564,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1577,7 +1578,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1590,7 +1591,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 157: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1606,7 +1607,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 159: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1617,7 +1618,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 160: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1629,7 +1630,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1642,7 +1643,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nanosleep_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1658,7 +1659,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mremap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1675,7 +1676,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1690,7 +1691,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1705,7 +1706,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_poll_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1720,7 +1721,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1735,7 +1736,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1752,7 +1753,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1767,7 +1768,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 173: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigreturn_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1781,7 +1782,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1798,7 +1799,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1813,7 +1814,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1828,7 +1829,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1844,7 +1845,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1858,7 +1859,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1873,7 +1874,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pread64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1890,7 +1891,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwrite64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1906,7 +1907,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1920,7 +1921,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcwd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1933,7 +1934,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1946,7 +1947,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capset_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1959,7 +1960,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1974,7 +1975,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1994,7 +1995,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrlimit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2011,7 +2012,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_do_mmap2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2028,7 +2029,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2041,7 +2042,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2054,7 +2055,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2067,7 +2068,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lstat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2080,7 +2081,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2094,7 +2095,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2128,7 +2129,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2141,7 +2142,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2154,7 +2155,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2167,7 +2168,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2181,7 +2182,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2196,7 +2197,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2211,7 +2212,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2226,7 +2227,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2241,7 +2242,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2256,7 +2257,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2269,7 +2270,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 213: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2280,7 +2281,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 214: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2291,7 +2292,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 215: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2302,7 +2303,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 216: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2315,7 +2316,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2329,7 +2330,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pivot_root_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2343,7 +2344,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mincore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2358,7 +2359,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_madvise_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2373,7 +2374,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2393,7 +2394,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readahead_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2410,7 +2411,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2429,7 +2430,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2448,7 +2449,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2466,7 +2467,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2483,7 +2484,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2500,7 +2501,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2516,7 +2517,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2531,7 +2532,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llistxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2546,7 +2547,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flistxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2560,7 +2561,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_removexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2573,7 +2574,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2586,7 +2587,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2599,7 +2600,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tkill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2614,7 +2615,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2633,7 +2634,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futex_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2651,7 +2652,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2666,7 +2667,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2680,7 +2681,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_setup_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2692,7 +2693,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 244: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_destroy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2707,7 +2708,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_getevents_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2724,7 +2725,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_submit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2739,7 +2740,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_cancel_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2752,7 +2753,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 248: {
 		panda_noreturn = true;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_group_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2765,7 +2766,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2778,7 +2779,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 250: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2792,7 +2793,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2809,7 +2810,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_wait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2827,7 +2828,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2842,7 +2843,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 256: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2855,7 +2856,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2871,7 +2872,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2886,7 +2887,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2898,7 +2899,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 260: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2909,7 +2910,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 261: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_delete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2921,7 +2922,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2934,7 +2935,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2947,7 +2948,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_getres_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2962,7 +2963,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2978,7 +2979,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2993,7 +2994,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3008,7 +3009,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tgkill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3022,7 +3023,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimes_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3037,7 +3038,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_arm_fadvise64_64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3053,7 +3054,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pciconfig_iobase_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3070,7 +3071,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pciconfig_read_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3089,7 +3090,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pciconfig_write_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3107,7 +3108,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3121,7 +3122,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 275: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3136,7 +3137,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3155,7 +3156,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3171,7 +3172,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_notify_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3185,7 +3186,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3202,7 +3203,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_waitid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3219,7 +3220,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socket_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3234,7 +3235,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bind_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3249,7 +3250,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_connect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3263,7 +3264,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listen_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3277,7 +3278,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3292,7 +3293,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3307,7 +3308,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpeername_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3323,7 +3324,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketpair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3340,7 +3341,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_send_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3359,7 +3360,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendto_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3378,7 +3379,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3397,7 +3398,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvfrom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3414,7 +3415,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shutdown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3430,7 +3431,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setsockopt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3449,7 +3450,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockopt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3466,7 +3467,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3481,7 +3482,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3496,7 +3497,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semop_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3511,7 +3512,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3527,7 +3528,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3544,7 +3545,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgsnd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3562,7 +3563,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgrcv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3578,7 +3579,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3592,7 +3593,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3607,7 +3608,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3620,7 +3621,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 306: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmdt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3633,7 +3634,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3648,7 +3649,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3665,7 +3666,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_add_key_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3683,7 +3684,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_request_key_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3701,7 +3702,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_keyctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3719,7 +3720,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semtimedop_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3735,7 +3736,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3749,7 +3750,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3768,7 +3769,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3782,7 +3783,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3799,7 +3800,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mbind_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3819,7 +3820,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3836,7 +3837,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3852,7 +3853,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_openat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3868,7 +3869,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdirat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3884,7 +3885,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknodat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3902,7 +3903,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchownat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3919,7 +3920,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futimesat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3935,7 +3936,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3951,7 +3952,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3967,7 +3968,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3985,7 +3986,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_linkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4002,7 +4003,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4018,7 +4019,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4034,7 +4035,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmodat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4049,7 +4050,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_faccessat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4067,7 +4068,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pselect6_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4087,7 +4088,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ppoll_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4102,7 +4103,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 337: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unshare_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4114,7 +4115,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4128,7 +4129,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4146,7 +4147,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_splice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4165,7 +4166,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sync_file_range2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4182,7 +4183,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tee_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4199,7 +4200,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vmsplice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4218,7 +4219,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_move_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4236,7 +4237,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcpu_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4254,7 +4255,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4273,7 +4274,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kexec_load_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4290,7 +4291,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimensat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4306,7 +4307,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4320,7 +4321,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4332,7 +4333,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 351: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4346,7 +4347,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fallocate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4363,7 +4364,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4378,7 +4379,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4393,7 +4394,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4408,7 +4409,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4420,7 +4421,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 357: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4433,7 +4434,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup3_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4447,7 +4448,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4459,7 +4460,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 360: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4474,7 +4475,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_preadv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4493,7 +4494,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwritev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4511,7 +4512,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4529,7 +4530,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4548,7 +4549,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4566,7 +4567,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4581,7 +4582,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4597,7 +4598,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4615,7 +4616,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prlimit64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4633,7 +4634,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4650,7 +4651,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4664,7 +4665,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4676,7 +4677,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 373: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syncfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4690,7 +4691,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4705,7 +4706,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setns_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4722,7 +4723,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4743,7 +4744,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4763,7 +4764,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kcmp_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4780,7 +4781,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_finit_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4795,7 +4796,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4811,7 +4812,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4829,7 +4830,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4846,7 +4847,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_seccomp_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4861,7 +4862,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrandom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4875,7 +4876,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_memfd_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4889,7 +4890,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bpf_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4906,7 +4907,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execveat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4921,7 +4922,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 388: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4933,7 +4934,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_membarrier_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4947,7 +4948,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4967,7 +4968,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_ARM_cacheflush_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4990,7 +4991,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	case 983045: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_ARM_set_tls_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5004,8 +5005,10 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
+	if (syscall_trace_on) syscall_trace_enter(cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		watch_syscall_return(cpu, ctx.retaddr);
 	}
 #endif
 }
@@ -12,6 +12,7 @@ extern "C" {
 #include "syscall_ppp_extern_enter.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 /**
  * @brief Called when a system call invocation is identified.
@@ -38,7 +39,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_read_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -53,7 +54,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_write_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -68,7 +69,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -81,7 +82,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 3: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_close_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -93,7 +94,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -106,7 +107,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newfstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -119,7 +120,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newlstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -133,7 +134,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_poll_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -148,7 +149,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lseek_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -166,7 +167,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mmap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -184,7 +185,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mprotect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -198,7 +199,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munmap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -210,7 +211,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 12: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_brk_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -224,7 +225,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -241,7 +242,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -262,7 +263,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -278,7 +279,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pread64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -295,7 +296,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwrite64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -311,7 +312,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -326,7 +327,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_writev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -340,7 +341,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_access_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -352,7 +353,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 22: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -367,7 +368,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_select_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -391,7 +392,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mremap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -408,7 +409,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -423,7 +424,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mincore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -438,7 +439,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_madvise_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -453,7 +454,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -468,7 +469,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -483,7 +484,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -496,7 +497,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 32: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -508,7 +509,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -526,7 +527,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nanosleep_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -539,7 +540,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getitimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -551,7 +552,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 37: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_alarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -564,7 +565,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setitimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -585,7 +586,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -601,7 +602,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socket_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -616,7 +617,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_connect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -631,7 +632,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -649,7 +650,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendto_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -670,7 +671,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvfrom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -688,7 +689,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -703,7 +704,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -717,7 +718,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shutdown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -731,7 +732,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bind_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -745,7 +746,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listen_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -759,7 +760,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -774,7 +775,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpeername_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -790,7 +791,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketpair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -808,7 +809,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setsockopt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -827,7 +828,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockopt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -846,7 +847,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clone_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -873,7 +874,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execve_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -886,7 +887,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 60: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -900,7 +901,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_wait4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -915,7 +916,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -927,7 +928,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 63: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newuname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -940,7 +941,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -955,7 +956,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semop_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -971,7 +972,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -985,7 +986,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 67: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmdt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -997,7 +998,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1012,7 +1013,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgsnd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1030,7 +1031,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		int64_t arg3 = get_s64(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgrcv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1047,7 +1048,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1062,7 +1063,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1076,7 +1077,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1088,7 +1089,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 74: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1099,7 +1100,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 75: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fdatasync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1111,7 +1112,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		int64_t arg1 = get_s64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1124,7 +1125,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1138,7 +1139,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1152,7 +1153,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcwd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1164,7 +1165,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 80: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1175,7 +1176,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 81: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1187,7 +1188,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rename_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1200,7 +1201,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1212,7 +1213,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 84: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rmdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1224,7 +1225,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_creat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1237,7 +1238,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_link_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1249,7 +1250,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 87: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1261,7 +1262,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1275,7 +1276,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1289,7 +1290,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chmod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1302,7 +1303,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1316,7 +1317,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1331,7 +1332,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1346,7 +1347,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1359,7 +1360,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 95: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1371,7 +1372,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1384,7 +1385,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrlimit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1397,7 +1398,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrusage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1409,7 +1410,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 99: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1420,7 +1421,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 100: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_times_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1434,7 +1435,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int64_t arg1 = get_s64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ptrace_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int64_t));
@@ -1455,7 +1456,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syslog_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1473,7 +1474,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 105: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1484,7 +1485,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 106: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1506,7 +1507,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1534,7 +1535,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1547,7 +1548,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1560,7 +1561,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1573,7 +1574,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1587,7 +1588,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1602,7 +1603,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1617,7 +1618,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1632,7 +1633,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1645,7 +1646,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 121: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1656,7 +1657,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 122: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1667,7 +1668,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 123: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1678,7 +1679,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 124: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1690,7 +1691,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1703,7 +1704,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capset_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1716,7 +1717,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1731,7 +1732,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1747,7 +1748,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1761,7 +1762,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1774,7 +1775,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1787,7 +1788,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1801,7 +1802,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1814,7 +1815,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 135: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_personality_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1826,7 +1827,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ustat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1839,7 +1840,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -1852,7 +1853,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1866,7 +1867,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1880,7 +1881,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpriority_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1894,7 +1895,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpriority_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1908,7 +1909,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1921,7 +1922,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1935,7 +1936,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1948,7 +1949,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 145: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1959,7 +1960,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 146: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1970,7 +1971,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 147: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1982,7 +1983,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1995,7 +1996,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2008,7 +2009,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munlock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2020,7 +2021,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 151: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlockall_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2043,7 +2044,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_modify_ldt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2057,7 +2058,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pivot_root_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2069,7 +2070,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 156: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2084,7 +2085,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2100,7 +2101,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_arch_prctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2112,7 +2113,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 159: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_adjtimex_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2124,7 +2125,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setrlimit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2136,7 +2137,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 161: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chroot_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2152,7 +2153,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 163: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_acct_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2164,7 +2165,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_settimeofday_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2180,7 +2181,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mount_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2196,7 +2197,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umount_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2209,7 +2210,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapon_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2221,7 +2222,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 168: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapoff_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2235,7 +2236,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_reboot_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2250,7 +2251,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sethostname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2263,7 +2264,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setdomainname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2275,7 +2276,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 172: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_iopl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2288,7 +2289,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioperm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2303,7 +2304,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_init_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2317,7 +2318,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_delete_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2332,7 +2333,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_quotactl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2353,7 +2354,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readahead_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2370,7 +2371,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2389,7 +2390,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2408,7 +2409,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2426,7 +2427,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2443,7 +2444,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2460,7 +2461,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2476,7 +2477,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2491,7 +2492,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llistxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2506,7 +2507,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flistxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2520,7 +2521,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_removexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2533,7 +2534,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2546,7 +2547,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2559,7 +2560,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tkill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2571,7 +2572,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 201: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_time_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2587,7 +2588,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futex_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2605,7 +2606,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2620,7 +2621,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2634,7 +2635,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_setup_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2646,7 +2647,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 207: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_destroy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2661,7 +2662,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int64_t arg2 = get_s64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_getevents_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2678,7 +2679,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		int64_t arg1 = get_s64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_submit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2693,7 +2694,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_cancel_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2708,7 +2709,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2721,7 +2722,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 213: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2736,7 +2737,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2753,7 +2754,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2766,7 +2767,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 218: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -2785,7 +2786,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semtimedop_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2802,7 +2803,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fadvise64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2818,7 +2819,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2834,7 +2835,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2849,7 +2850,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2861,7 +2862,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 225: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2872,7 +2873,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 226: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_delete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2884,7 +2885,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2897,7 +2898,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2910,7 +2911,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_getres_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2925,7 +2926,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2939,7 +2940,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 231: {
 		panda_noreturn = true;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_group_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2953,7 +2954,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_wait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2970,7 +2971,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2986,7 +2987,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tgkill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3000,7 +3001,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimes_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3017,7 +3018,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mbind_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3035,7 +3036,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3052,7 +3053,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3070,7 +3071,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3084,7 +3085,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 241: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3099,7 +3100,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3118,7 +3119,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3134,7 +3135,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_notify_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3148,7 +3149,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3164,7 +3165,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kexec_load_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3182,7 +3183,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_waitid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3201,7 +3202,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_add_key_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3219,7 +3220,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_request_key_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3237,7 +3238,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_keyctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3254,7 +3255,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3268,7 +3269,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3287,7 +3288,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3301,7 +3302,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3316,7 +3317,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_migrate_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3333,7 +3334,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_openat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3349,7 +3350,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdirat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3365,7 +3366,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknodat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3383,7 +3384,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchownat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3400,7 +3401,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futimesat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3416,7 +3417,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newfstatat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3432,7 +3433,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3448,7 +3449,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3466,7 +3467,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_linkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3483,7 +3484,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3499,7 +3500,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3515,7 +3516,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmodat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3530,7 +3531,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_faccessat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3548,7 +3549,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pselect6_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3568,7 +3569,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ppoll_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3583,7 +3584,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 272: {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unshare_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3595,7 +3596,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3609,7 +3610,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3627,7 +3628,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_splice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3646,7 +3647,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tee_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3663,7 +3664,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sync_file_range_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3680,7 +3681,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vmsplice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3699,7 +3700,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_move_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3718,7 +3719,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimensat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3737,7 +3738,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg3 = get_s32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3755,7 +3756,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3769,7 +3770,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3781,7 +3782,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 284: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3795,7 +3796,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fallocate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3812,7 +3813,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3827,7 +3828,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3842,7 +3843,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3859,7 +3860,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3874,7 +3875,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3886,7 +3887,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 291: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3899,7 +3900,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup3_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3913,7 +3914,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3925,7 +3926,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 294: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3940,7 +3941,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_preadv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3959,7 +3960,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwritev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3977,7 +3978,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3995,7 +3996,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4014,7 +4015,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4030,7 +4031,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4046,7 +4047,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4064,7 +4065,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prlimit64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4082,7 +4083,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4099,7 +4100,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4113,7 +4114,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4125,7 +4126,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 306: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syncfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4139,7 +4140,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4154,7 +4155,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setns_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4168,7 +4169,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcpu_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4186,7 +4187,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4207,7 +4208,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4227,7 +4228,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kcmp_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4244,7 +4245,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_finit_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4259,7 +4260,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4275,7 +4276,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4293,7 +4294,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4310,7 +4311,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_seccomp_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4325,7 +4326,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrandom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4339,7 +4340,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_memfd_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4355,7 +4356,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kexec_file_load_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4372,7 +4373,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bpf_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4389,7 +4390,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execveat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4404,7 +4405,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 323: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4416,7 +4417,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_membarrier_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4430,7 +4431,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4448,7 +4449,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_copy_file_range_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4469,7 +4470,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_preadv2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4490,7 +4491,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg3 = get_64(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwritev2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4509,7 +4510,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pkey_mprotect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4524,7 +4525,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint64_t arg0 = get_64(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pkey_alloc_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -4536,7 +4537,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 	case 331: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pkey_free_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4551,7 +4552,7 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4569,8 +4570,10 @@ void syscall_enter_switch_linux_x64(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
+	if (syscall_trace_on) syscall_trace_enter(cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		watch_syscall_return(cpu, ctx.retaddr);
 	}
 #endif
 }
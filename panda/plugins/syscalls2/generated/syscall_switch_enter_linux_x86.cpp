@@ -12,6 +12,7 @@ extern "C" {
 #include "syscall_ppp_extern_enter.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 /**
  * @brief Called when a system call invocation is identified.
@@ -41,7 +42,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 1: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -59,7 +60,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_read_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -74,7 +75,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_write_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -89,7 +90,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -102,7 +103,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 6: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_close_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -115,7 +116,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_waitpid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -129,7 +130,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_creat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -142,7 +143,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_link_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -154,7 +155,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 10: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -167,7 +168,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execve_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -180,7 +181,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 12: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -191,7 +192,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 13: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_time_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -204,7 +205,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -218,7 +219,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chmod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -232,7 +233,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -246,7 +247,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -260,7 +261,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lseek_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -282,7 +283,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mount_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -297,7 +298,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 22: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_oldumount_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -308,7 +309,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 23: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -324,7 +325,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 25: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -338,7 +339,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ptrace_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -352,7 +353,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 27: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_alarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -364,7 +365,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -382,7 +383,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -395,7 +396,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_access_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -407,7 +408,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 34: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -424,7 +425,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -437,7 +438,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rename_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -450,7 +451,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -462,7 +463,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 40: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rmdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -473,7 +474,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 41: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -484,7 +485,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 42: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -495,7 +496,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 43: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_times_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -506,7 +507,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 45: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_brk_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -517,7 +518,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 46: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -534,7 +535,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signal_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -556,7 +557,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 51: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_acct_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -568,7 +569,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umount_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -582,7 +583,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -597,7 +598,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -611,7 +612,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -623,7 +624,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 59: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_olduname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -634,7 +635,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 60: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -645,7 +646,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 61: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chroot_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -657,7 +658,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ustat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -670,7 +671,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -699,7 +700,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -717,7 +718,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 69: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ssetmask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -729,7 +730,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -742,7 +743,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -756,7 +757,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigsuspend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -769,7 +770,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 73: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigpending_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -781,7 +782,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sethostname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -794,7 +795,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setrlimit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -807,7 +808,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_getrlimit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -820,7 +821,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrusage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -833,7 +834,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -846,7 +847,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_settimeofday_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -859,7 +860,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -872,7 +873,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -884,7 +885,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 82: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_select_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -896,7 +897,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -909,7 +910,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -923,7 +924,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -936,7 +937,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 86: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_uselib_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -948,7 +949,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapon_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -963,7 +964,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_reboot_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -979,7 +980,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_readdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -992,7 +993,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 90: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_mmap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1004,7 +1005,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munmap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1017,7 +1018,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1030,7 +1031,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1043,7 +1044,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmod_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1057,7 +1058,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1071,7 +1072,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpriority_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1085,7 +1086,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpriority_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1099,7 +1100,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1112,7 +1113,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1126,7 +1127,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioperm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1140,7 +1141,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketcall_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1154,7 +1155,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syslog_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1169,7 +1170,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setitimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1183,7 +1184,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getitimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1196,7 +1197,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1209,7 +1210,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newlstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1222,7 +1223,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newfstat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1234,7 +1235,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 109: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_uname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1245,7 +1246,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 110: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_iopl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1261,7 +1262,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 113: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vm86old_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1275,7 +1276,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_wait4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1289,7 +1290,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 115: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapoff_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1300,7 +1301,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 116: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1316,7 +1317,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ipc_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1332,7 +1333,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 118: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1352,7 +1353,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clone_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1368,7 +1369,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setdomainname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1380,7 +1381,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 122: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newuname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1393,7 +1394,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_modify_ldt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1406,7 +1407,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 124: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_adjtimex_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1419,7 +1420,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mprotect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1434,7 +1435,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigprocmask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1449,7 +1450,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_init_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1463,7 +1464,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_delete_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1478,7 +1479,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_quotactl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1492,7 +1493,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 132: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1503,7 +1504,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 133: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchdir_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1515,7 +1516,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bdflush_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1529,7 +1530,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1542,7 +1543,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 136: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_personality_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1553,7 +1554,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 138: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1564,7 +1565,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 139: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1579,7 +1580,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llseek_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1596,7 +1597,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1613,7 +1614,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_select_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1629,7 +1630,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1643,7 +1644,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1658,7 +1659,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1673,7 +1674,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_writev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1686,7 +1687,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 147: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1697,7 +1698,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 148: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fdatasync_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1708,7 +1709,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 149: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1720,7 +1721,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1733,7 +1734,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munlock_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1745,7 +1746,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 152: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlockall_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1762,7 +1763,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1775,7 +1776,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1789,7 +1790,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1802,7 +1803,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 157: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1818,7 +1819,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 159: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1829,7 +1830,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 160: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1841,7 +1842,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -1854,7 +1855,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nanosleep_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1870,7 +1871,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mremap_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1887,7 +1888,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1902,7 +1903,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1916,7 +1917,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vm86_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1930,7 +1931,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_poll_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1945,7 +1946,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1960,7 +1961,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1977,7 +1978,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2000,7 +2001,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2017,7 +2018,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2032,7 +2033,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2047,7 +2048,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2063,7 +2064,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2077,7 +2078,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2092,7 +2093,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pread64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2109,7 +2110,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwrite64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2125,7 +2126,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown16_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2139,7 +2140,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcwd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2152,7 +2153,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capget_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2165,7 +2166,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capset_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2178,7 +2179,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2193,7 +2194,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2213,7 +2214,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrlimit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2230,7 +2231,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mmap_pgoff_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2247,7 +2248,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2260,7 +2261,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2273,7 +2274,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2286,7 +2287,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lstat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2299,7 +2300,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2313,7 +2314,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2347,7 +2348,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2360,7 +2361,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2373,7 +2374,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2386,7 +2387,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2400,7 +2401,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2415,7 +2416,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2430,7 +2431,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2445,7 +2446,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2460,7 +2461,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2475,7 +2476,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2488,7 +2489,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 213: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2499,7 +2500,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 214: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2510,7 +2511,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 215: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2521,7 +2522,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 216: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2533,7 +2534,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pivot_root_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2547,7 +2548,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mincore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2562,7 +2563,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_madvise_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2577,7 +2578,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2592,7 +2593,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2612,7 +2613,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readahead_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2629,7 +2630,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2648,7 +2649,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2667,7 +2668,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2685,7 +2686,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2702,7 +2703,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2719,7 +2720,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2735,7 +2736,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2750,7 +2751,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llistxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2765,7 +2766,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flistxattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2779,7 +2780,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_removexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2792,7 +2793,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2805,7 +2806,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2818,7 +2819,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tkill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2833,7 +2834,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2852,7 +2853,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futex_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2870,7 +2871,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2885,7 +2886,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -2898,7 +2899,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 243: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_thread_area_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2909,7 +2910,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 244: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_thread_area_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2921,7 +2922,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_setup_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2933,7 +2934,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 246: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_destroy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2948,7 +2949,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_getevents_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2965,7 +2966,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_submit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2980,7 +2981,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_cancel_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2996,7 +2997,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fadvise64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3010,7 +3011,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 252: {
 		panda_noreturn = true;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_group_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3023,7 +3024,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg0 = get_64(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
@@ -3036,7 +3037,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 254: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3050,7 +3051,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3067,7 +3068,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_wait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3085,7 +3086,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3100,7 +3101,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 258: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3113,7 +3114,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3129,7 +3130,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3144,7 +3145,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3156,7 +3157,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 262: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3167,7 +3168,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 263: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_delete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3179,7 +3180,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3192,7 +3193,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3205,7 +3206,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_getres_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3220,7 +3221,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3236,7 +3237,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3251,7 +3252,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3266,7 +3267,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tgkill_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3280,7 +3281,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimes_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3295,7 +3296,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fadvise64_64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3314,7 +3315,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mbind_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3334,7 +3335,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3351,7 +3352,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3367,7 +3368,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3381,7 +3382,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 278: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3396,7 +3397,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3415,7 +3416,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3431,7 +3432,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_notify_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3445,7 +3446,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3461,7 +3462,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kexec_load_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3479,7 +3480,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_waitid_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3498,7 +3499,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_add_key_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3516,7 +3517,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_request_key_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3534,7 +3535,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_keyctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3551,7 +3552,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3565,7 +3566,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3584,7 +3585,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3598,7 +3599,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3613,7 +3614,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_migrate_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3630,7 +3631,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_openat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3646,7 +3647,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdirat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3662,7 +3663,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknodat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3680,7 +3681,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchownat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3697,7 +3698,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futimesat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3713,7 +3714,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatat64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3729,7 +3730,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3745,7 +3746,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3763,7 +3764,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_linkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3780,7 +3781,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3796,7 +3797,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlinkat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3812,7 +3813,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmodat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3827,7 +3828,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_faccessat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3845,7 +3846,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pselect6_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3865,7 +3866,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ppoll_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3880,7 +3881,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 310: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unshare_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3892,7 +3893,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3906,7 +3907,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3924,7 +3925,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_splice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3943,7 +3944,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg1 = get_64(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sync_file_range_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3960,7 +3961,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tee_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3977,7 +3978,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vmsplice_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -3996,7 +3997,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_move_pages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4014,7 +4015,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcpu_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4032,7 +4033,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4051,7 +4052,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimensat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4067,7 +4068,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4081,7 +4082,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4093,7 +4094,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 323: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4107,7 +4108,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint64_t arg2 = get_64(cpu, 2);
 		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fallocate_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4124,7 +4125,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4139,7 +4140,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4154,7 +4155,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4169,7 +4170,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4181,7 +4182,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 329: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4194,7 +4195,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup3_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4208,7 +4209,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4220,7 +4221,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 332: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4235,7 +4236,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_preadv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4254,7 +4255,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwritev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4272,7 +4273,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4290,7 +4291,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4309,7 +4310,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4325,7 +4326,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4341,7 +4342,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint64_t arg2 = get_64(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4359,7 +4360,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prlimit64_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4377,7 +4378,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4394,7 +4395,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4408,7 +4409,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4420,7 +4421,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 344: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syncfs_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4434,7 +4435,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4449,7 +4450,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setns_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4466,7 +4467,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4487,7 +4488,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4507,7 +4508,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kcmp_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4524,7 +4525,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_finit_module_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4539,7 +4540,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4555,7 +4556,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4573,7 +4574,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4590,7 +4591,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_seccomp_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4605,7 +4606,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrandom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4619,7 +4620,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_memfd_create_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4633,7 +4634,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bpf_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4650,7 +4651,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execveat_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4667,7 +4668,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socket_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4683,7 +4684,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg1 = get_s32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketpair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4699,7 +4700,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bind_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4714,7 +4715,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_connect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4728,7 +4729,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listen_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4743,7 +4744,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept4_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4761,7 +4762,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockopt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4780,7 +4781,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg2 = get_s32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setsockopt_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4797,7 +4798,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockname_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4812,7 +4813,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpeername_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4830,7 +4831,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendto_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4848,7 +4849,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4866,7 +4867,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvfrom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4884,7 +4885,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmsg_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4898,7 +4899,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shutdown_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4910,7 +4911,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 374: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4922,7 +4923,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_membarrier_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4936,7 +4937,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4954,7 +4955,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_copy_file_range_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -4975,7 +4976,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_preadv2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4996,7 +4997,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwritev2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5015,7 +5016,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pkey_mprotect_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5030,7 +5031,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pkey_alloc_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5042,7 +5043,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	case 382: {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pkey_free_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -5057,7 +5058,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -5073,7 +5074,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		int32_t arg0 = get_s32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_arch_prctl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
@@ -5088,8 +5089,10 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
+	if (syscall_trace_on) syscall_trace_enter(cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		watch_syscall_return(cpu, ctx.retaddr);
 	}
 #endif
 }
@@ -12,6 +12,7 @@ extern "C" {
 #include "syscall_ppp_extern_enter.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 /**
  * @brief Called when a system call invocation is identified.
@@ -41,7 +42,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAcceptConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -64,7 +65,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheck_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -92,7 +93,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -123,7 +124,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByType_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -159,7 +160,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg13 = get_32(cpu, 13);
 		uint32_t arg14 = get_32(cpu, 14);
 		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -195,7 +196,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -231,7 +232,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg13 = get_32(cpu, 13);
 		uint32_t arg14 = get_32(cpu, 14);
 		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -273,7 +274,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg14 = get_32(cpu, 14);
 		uint32_t arg15 = get_32(cpu, 15);
 		uint32_t arg16 = get_32(cpu, 16);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -302,7 +303,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -320,7 +321,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustGroupsToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -341,7 +342,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -358,7 +359,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertResumeThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -370,7 +371,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 12: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -381,7 +382,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 13: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -394,7 +395,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -410,7 +411,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUuids_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -429,7 +430,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -446,7 +447,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -459,7 +460,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -473,7 +474,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCallbackReturn_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -487,7 +488,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelIoFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -500,7 +501,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -512,7 +513,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 23: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClearEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -523,7 +524,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 24: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClose_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -536,7 +537,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -549,7 +550,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 26: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompleteConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -567,7 +568,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -586,7 +587,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtContinue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -600,7 +601,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDirectoryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -617,7 +618,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -634,7 +635,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -657,7 +658,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -681,7 +682,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -697,7 +698,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -716,7 +717,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -740,7 +741,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMailslotFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -761,7 +762,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -788,7 +789,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg11 = get_32(cpu, 11);
 		uint32_t arg12 = get_32(cpu, 12);
 		uint32_t arg13 = get_32(cpu, 13);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -815,7 +816,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePagingFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -833,7 +834,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -855,7 +856,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -881,7 +882,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -906,7 +907,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -927,7 +928,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -945,7 +946,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -966,7 +967,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -987,7 +988,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1013,7 +1014,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg10 = get_32(cpu, 10);
 		uint32_t arg11 = get_32(cpu, 11);
 		uint32_t arg12 = get_32(cpu, 12);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1040,7 +1041,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateWaitablePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1056,7 +1057,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDelayExecution_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1068,7 +1069,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 51: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1079,7 +1080,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 52: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1090,7 +1091,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 53: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1103,7 +1104,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1117,7 +1118,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1138,7 +1139,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeviceIoControlFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1158,7 +1159,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 57: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDisplayString_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1175,7 +1176,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1197,7 +1198,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1218,7 +1219,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1239,7 +1240,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1256,7 +1257,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtExtendSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1273,7 +1274,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFilterToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1291,7 +1292,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFindAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1305,7 +1306,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushBuffersFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1319,7 +1320,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushInstructionCache_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1332,7 +1333,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 67: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1346,7 +1347,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1367,7 +1368,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1383,7 +1384,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1406,7 +1407,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFsControlFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1427,7 +1428,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetContextThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1440,7 +1441,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetDevicePowerState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1455,7 +1456,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1475,7 +1476,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetWriteWatch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1492,7 +1493,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 78: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1504,7 +1505,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1518,7 +1519,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1531,7 +1532,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 81: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitializeRegistry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1545,7 +1546,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitiatePowerAction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1565,7 +1566,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtListenPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1577,7 +1578,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 85: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadDriver_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1589,7 +1590,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1603,7 +1604,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1625,7 +1626,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1648,7 +1649,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1662,7 +1663,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 90: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakeTemporaryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1675,7 +1676,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1690,7 +1691,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1712,7 +1713,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapViewOfSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1740,7 +1741,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1768,7 +1769,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1799,7 +1800,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
 		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1823,7 +1824,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenDirectoryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1838,7 +1839,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1853,7 +1854,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1871,7 +1872,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1889,7 +1890,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1904,7 +1905,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1919,7 +1920,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1934,7 +1935,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1958,7 +1959,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
 		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1983,7 +1984,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1999,7 +2000,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2014,7 +2015,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2029,7 +2030,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2044,7 +2045,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2060,7 +2061,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2077,7 +2078,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2093,7 +2094,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2108,7 +2109,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPlugPlayControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2125,7 +2126,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPowerInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2142,7 +2143,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeCheck_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2159,7 +2160,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2179,7 +2180,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2199,7 +2200,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtProtectVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2215,7 +2216,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPulseEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2231,7 +2232,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2247,7 +2248,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryAttributesFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2260,7 +2261,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultLocale_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2272,7 +2273,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 124: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2293,7 +2294,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2320,7 +2321,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2345,7 +2346,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEaFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2368,7 +2369,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2384,7 +2385,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2400,7 +2401,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2419,7 +2420,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2438,7 +2439,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2457,7 +2458,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2476,7 +2477,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2495,7 +2496,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2514,7 +2515,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2529,7 +2530,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 137: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2541,7 +2542,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIntervalProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2557,7 +2558,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2577,7 +2578,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2597,7 +2598,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2616,7 +2617,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2632,7 +2633,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2645,7 +2646,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2665,7 +2666,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2688,7 +2689,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2707,7 +2708,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySecurityObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2726,7 +2727,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2743,7 +2744,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2759,7 +2760,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2776,7 +2777,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2790,7 +2791,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 152: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemTime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2805,7 +2806,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2822,7 +2823,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimerResolution_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2840,7 +2841,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2861,7 +2862,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2881,7 +2882,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2900,7 +2901,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueueApcThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2917,7 +2918,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseException_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2935,7 +2936,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseHardError_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2959,7 +2960,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2986,7 +2987,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFileScatter_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3010,7 +3011,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadRequestData_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3030,7 +3031,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3045,7 +3046,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 165: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3057,7 +3058,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3071,7 +3072,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseSemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3088,7 +3089,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3105,7 +3106,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplaceKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3119,7 +3120,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3134,7 +3135,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3152,7 +3153,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3168,7 +3169,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3181,7 +3182,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3195,7 +3196,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3209,7 +3210,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3223,7 +3224,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetWriteWatch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3238,7 +3239,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRestoreKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3252,7 +3253,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3265,7 +3266,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3279,7 +3280,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveMergedKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3300,7 +3301,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSecureConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3323,7 +3324,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3339,7 +3340,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetContextThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3351,7 +3352,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 187: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3363,7 +3364,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultLocale_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3375,7 +3376,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 189: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3389,7 +3390,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEaFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3404,7 +3405,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3416,7 +3417,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 192: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3427,7 +3428,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 193: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3442,7 +3443,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3460,7 +3461,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3477,7 +3478,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3494,7 +3495,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3511,7 +3512,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3528,7 +3529,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3545,7 +3546,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3560,7 +3561,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIntervalProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3577,7 +3578,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLdtEntries_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3593,7 +3594,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 203: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3604,7 +3605,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 204: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3618,7 +3619,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3634,7 +3635,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSecurityObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3648,7 +3649,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3662,7 +3663,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3677,7 +3678,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemPowerState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3691,7 +3692,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemTime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3704,7 +3705,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetThreadExecutionState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3722,7 +3723,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3741,7 +3742,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimerResolution_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3754,7 +3755,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 214: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetUuidSeed_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3770,7 +3771,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3790,7 +3791,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3805,7 +3806,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 217: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtShutdownSystem_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3819,7 +3820,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3833,7 +3834,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 219: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStartProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3844,7 +3845,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 220: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStopProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3856,7 +3857,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3873,7 +3874,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSystemDebugControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3890,7 +3891,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3903,7 +3904,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3916,7 +3917,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3933,7 +3934,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 227: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadDriver_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3944,7 +3945,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 228: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3959,7 +3960,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3977,7 +3978,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3992,7 +3993,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnmapViewOfSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4005,7 +4006,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtVdmControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4021,7 +4022,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4038,7 +4039,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForSingleObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4051,7 +4052,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 235: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitHighEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4062,7 +4063,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	case 236: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitLowEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4081,7 +4082,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4108,7 +4109,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFileGather_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4132,7 +4133,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteRequestData_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4152,7 +4153,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4175,8 +4176,10 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
+	if (syscall_trace_on) syscall_trace_enter(cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		watch_syscall_return(cpu, ctx.retaddr);
 	}
 #endif
 }
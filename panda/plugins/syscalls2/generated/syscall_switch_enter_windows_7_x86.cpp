@@ -12,6 +12,7 @@ extern "C" {
 #include "syscall_ppp_extern_enter.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 /**
  * @brief Called when a system call invocation is identified.
@@ -41,7 +42,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAcceptConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -64,7 +65,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheck_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -92,7 +93,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -123,7 +124,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByType_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -159,7 +160,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg13 = get_32(cpu, 13);
 		uint32_t arg14 = get_32(cpu, 14);
 		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -195,7 +196,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -231,7 +232,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg13 = get_32(cpu, 13);
 		uint32_t arg14 = get_32(cpu, 14);
 		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -273,7 +274,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg14 = get_32(cpu, 14);
 		uint32_t arg15 = get_32(cpu, 15);
 		uint32_t arg16 = get_32(cpu, 16);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -302,7 +303,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -316,7 +317,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddBootEntry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -329,7 +330,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddDriverEntry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -346,7 +347,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustGroupsToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -367,7 +368,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -384,7 +385,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertResumeThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -396,7 +397,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 14: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -407,7 +408,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 15: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -420,7 +421,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateReserveObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -435,7 +436,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -451,7 +452,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUuids_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -470,7 +471,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -494,7 +495,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -515,7 +516,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCancelMessage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -538,7 +539,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -561,7 +562,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreatePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -579,7 +580,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -598,7 +599,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -614,7 +615,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -629,7 +630,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -644,7 +645,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -659,7 +660,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -674,7 +675,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -689,7 +690,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -703,7 +704,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -717,7 +718,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -735,7 +736,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -756,7 +757,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -776,7 +777,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcQueryInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -796,7 +797,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -814,7 +815,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -834,7 +835,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -855,7 +856,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcSetInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -870,7 +871,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtApphelpCacheControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -883,7 +884,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -896,7 +897,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -910,7 +911,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCallbackReturn_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -924,7 +925,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelIoFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -938,7 +939,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelIoFileEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -953,7 +954,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -967,7 +968,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -979,7 +980,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 49: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClearEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -990,7 +991,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 50: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClose_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1003,7 +1004,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1017,7 +1018,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCommitComplete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1030,7 +1031,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCommitEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1043,7 +1044,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCommitTransaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1056,7 +1057,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompactKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1070,7 +1071,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompareTokens_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1083,7 +1084,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 57: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompleteConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1094,7 +1095,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 58: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompressKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1112,7 +1113,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1131,7 +1132,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtContinue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1146,7 +1147,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDebugObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1162,7 +1163,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDirectoryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1182,7 +1183,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1204,7 +1205,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1221,7 +1222,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1244,7 +1245,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1268,7 +1269,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1284,7 +1285,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1299,7 +1300,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobSet_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1318,7 +1319,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1338,7 +1339,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKeyedEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1359,7 +1360,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKeyTransacted_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1384,7 +1385,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMailslotFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1405,7 +1406,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1432,7 +1433,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg11 = get_32(cpu, 11);
 		uint32_t arg12 = get_32(cpu, 12);
 		uint32_t arg13 = get_32(cpu, 13);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1459,7 +1460,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePagingFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1477,7 +1478,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1495,7 +1496,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1516,7 +1517,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1542,7 +1543,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcessEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1569,7 +1570,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1597,7 +1598,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProfileEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1623,7 +1624,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateResourceManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1646,7 +1647,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1667,7 +1668,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		int32_t arg3 = get_s32(cpu, 3);
 		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1685,7 +1686,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1706,7 +1707,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1734,7 +1735,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateThreadEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1758,7 +1759,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1784,7 +1785,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg10 = get_32(cpu, 10);
 		uint32_t arg11 = get_32(cpu, 11);
 		uint32_t arg12 = get_32(cpu, 12);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1816,7 +1817,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTransaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1841,7 +1842,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTransactionManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1867,7 +1868,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateUserProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1892,7 +1893,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateWaitablePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1916,7 +1917,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateWorkerFactory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1937,7 +1938,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDebugActiveProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1951,7 +1952,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDebugContinue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1965,7 +1966,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDelayExecution_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1977,7 +1978,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 99: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1988,7 +1989,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 100: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteBootEntry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -1999,7 +2000,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 101: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteDriverEntry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2010,7 +2011,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 102: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2021,7 +2022,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 103: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2034,7 +2035,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2047,7 +2048,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 105: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2059,7 +2060,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2080,7 +2081,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeviceIoControlFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2105,7 +2106,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 109: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDisplayString_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2116,7 +2117,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 110: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDrawText_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2133,7 +2134,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2155,7 +2156,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2177,7 +2178,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateBootEntries_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2190,7 +2191,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2207,7 +2208,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2225,7 +2226,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2242,7 +2243,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2262,7 +2263,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2279,7 +2280,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtExtendSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2296,7 +2297,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFilterToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2314,7 +2315,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFindAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2328,7 +2329,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushBuffersFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2341,7 +2342,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2355,7 +2356,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushInstructionCache_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2368,7 +2369,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 126: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2387,7 +2388,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2408,7 +2409,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2424,7 +2425,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2438,7 +2439,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 132: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreezeRegistry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2450,7 +2451,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreezeTransactions_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2471,7 +2472,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFsControlFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2492,7 +2493,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetContextThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2510,7 +2511,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetDevicePowerState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2524,7 +2525,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2541,7 +2542,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNextProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2561,7 +2562,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNextThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2581,7 +2582,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2602,7 +2603,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2622,7 +2623,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2642,7 +2643,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetWriteWatch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2659,7 +2660,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 145: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2671,7 +2672,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2685,7 +2686,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2700,7 +2701,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitializeNlsFiles_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2713,7 +2714,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 149: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitializeRegistry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2727,7 +2728,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitiatePowerAction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2742,7 +2743,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtIsProcessInJob_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2765,7 +2766,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtListenPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2777,7 +2778,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 155: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadDriver_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2789,7 +2790,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2803,7 +2804,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2819,7 +2820,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKeyEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2842,7 +2843,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2863,7 +2864,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockProductActivationKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2875,7 +2876,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 161: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockRegistryKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2889,7 +2890,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2903,7 +2904,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 163: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakePermanentObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2914,7 +2915,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 164: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakeTemporaryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2930,7 +2931,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapCMFModule_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2948,7 +2949,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2963,7 +2964,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -2985,7 +2986,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapViewOfSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3005,7 +3006,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 169: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtModifyBootEntry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3016,7 +3017,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 170: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtModifyDriverEntry_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3035,7 +3036,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3063,7 +3064,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3094,7 +3095,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
 		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3123,7 +3124,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeSession_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3143,7 +3144,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenDirectoryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3160,7 +3161,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3177,7 +3178,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3192,7 +3193,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3210,7 +3211,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3228,7 +3229,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3243,7 +3244,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3258,7 +3259,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3274,7 +3275,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3290,7 +3291,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyedEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3306,7 +3307,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyTransacted_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3324,7 +3325,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3341,7 +3342,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3365,7 +3366,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
 		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3390,7 +3391,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3407,7 +3408,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3423,7 +3424,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3439,7 +3440,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3457,7 +3458,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenResourceManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3474,7 +3475,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3489,7 +3490,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3504,7 +3505,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSession_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3519,7 +3520,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3535,7 +3536,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3552,7 +3553,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3570,7 +3571,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3587,7 +3588,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3604,7 +3605,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTransaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3624,7 +3625,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTransactionManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3642,7 +3643,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPlugPlayControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3659,7 +3660,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPowerInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3675,7 +3676,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrepareComplete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3688,7 +3689,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrepareEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3701,7 +3702,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrePrepareComplete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3714,7 +3715,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3728,7 +3729,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeCheck_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3745,7 +3746,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3765,7 +3766,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3784,7 +3785,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPropagationComplete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3800,7 +3801,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPropagationFailed_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3817,7 +3818,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtProtectVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3833,7 +3834,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPulseEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3846,7 +3847,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryAttributesFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3859,7 +3860,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3872,7 +3873,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryBootOptions_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3885,7 +3886,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDebugFilterState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3898,7 +3899,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultLocale_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3910,7 +3911,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 222: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3931,7 +3932,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg8 = get_32(cpu, 8);
 		uint32_t arg9 = get_32(cpu, 9);
 		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3958,7 +3959,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3976,7 +3977,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -3996,7 +3997,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEaFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4019,7 +4020,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4035,7 +4036,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4051,7 +4052,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationAtom_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4070,7 +4071,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4089,7 +4090,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4108,7 +4109,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4127,7 +4128,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4146,7 +4147,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4165,7 +4166,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4184,7 +4185,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4203,7 +4204,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4222,7 +4223,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationTransaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4241,7 +4242,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4260,7 +4261,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4275,7 +4276,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 241: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4287,7 +4288,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIntervalProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4303,7 +4304,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4322,7 +4323,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4341,7 +4342,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryLicenseValue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4361,7 +4362,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4381,7 +4382,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4400,7 +4401,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4416,7 +4417,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4431,7 +4432,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4446,7 +4447,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4471,7 +4472,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4494,7 +4495,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4514,7 +4515,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4534,7 +4535,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySecurityObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4553,7 +4554,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4570,7 +4571,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4586,7 +4587,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4604,7 +4605,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4622,7 +4623,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4641,7 +4642,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4657,7 +4658,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 263: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemTime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4672,7 +4673,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4689,7 +4690,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimerResolution_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4707,7 +4708,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4728,7 +4729,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4748,7 +4749,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4767,7 +4768,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueueApcThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4787,7 +4788,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueueApcThreadEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4805,7 +4806,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseException_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4823,7 +4824,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseHardError_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4847,7 +4848,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4874,7 +4875,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFileScatter_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4894,7 +4895,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4911,7 +4912,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadRequestData_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4931,7 +4932,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4947,7 +4948,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRecoverEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4959,7 +4960,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 279: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRecoverResourceManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4970,7 +4971,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 280: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRecoverTransactionManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -4985,7 +4986,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5000,7 +5001,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 282: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5014,7 +5015,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5029,7 +5030,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseMutant_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5043,7 +5044,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		int32_t arg1 = get_s32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseSemaphore_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5056,7 +5057,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 286: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5071,7 +5072,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5091,7 +5092,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5108,7 +5109,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveProcessDebug_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5121,7 +5122,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRenameKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5134,7 +5135,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRenameTransactionManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5148,7 +5149,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplaceKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5163,7 +5164,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplacePartitionUnit_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5177,7 +5178,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5192,7 +5193,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5210,7 +5211,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5226,7 +5227,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5239,7 +5240,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5253,7 +5254,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5267,7 +5268,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5281,7 +5282,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetWriteWatch_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5296,7 +5297,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRestoreKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5309,7 +5310,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 303: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5321,7 +5322,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5334,7 +5335,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollbackComplete_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5347,7 +5348,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollbackEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5360,7 +5361,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollbackTransaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5373,7 +5374,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5386,7 +5387,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5400,7 +5401,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKeyEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5415,7 +5416,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveMergedKeys_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5436,7 +5437,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSecureConnectPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5461,7 +5462,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetBootEntryOrder_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5474,7 +5475,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetBootOptions_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5487,7 +5488,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetContextThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5501,7 +5502,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDebugFilterState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5514,7 +5515,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 318: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5526,7 +5527,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultLocale_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5538,7 +5539,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 320: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5550,7 +5551,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5565,7 +5566,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEaFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5580,7 +5581,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5592,7 +5593,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 324: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEventBoostPriority_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5603,7 +5604,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 325: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5614,7 +5615,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 326: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5629,7 +5630,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationDebugObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5647,7 +5648,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationEnlistment_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5665,7 +5666,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5683,7 +5684,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5700,7 +5701,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5717,7 +5718,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5734,7 +5735,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5751,7 +5752,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationResourceManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5768,7 +5769,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5785,7 +5786,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationToken_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5802,7 +5803,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationTransaction_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5819,7 +5820,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5836,7 +5837,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5851,7 +5852,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIntervalProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5867,7 +5868,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIoCompletion_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5887,7 +5888,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIoCompletionEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5908,7 +5909,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLdtEntries_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5924,7 +5925,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 344: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5935,7 +5936,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 345: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5949,7 +5950,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5965,7 +5966,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSecurityObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5979,7 +5980,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -5995,7 +5996,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6012,7 +6013,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemInformation_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6027,7 +6028,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemPowerState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6041,7 +6042,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemTime_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6054,7 +6055,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetThreadExecutionState_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6072,7 +6073,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg4 = get_32(cpu, 4);
 		int32_t arg5 = get_s32(cpu, 5);
 		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimer_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6092,7 +6093,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimerEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6108,7 +6109,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimerResolution_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6121,7 +6122,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 357: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetUuidSeed_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6137,7 +6138,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetValueKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6157,7 +6158,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6172,7 +6173,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 360: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtShutdownSystem_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6184,7 +6185,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6199,7 +6200,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6214,7 +6215,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSinglePhaseReject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6226,7 +6227,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 364: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStartProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6237,7 +6238,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 365: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStopProfile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6248,7 +6249,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 366: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6260,7 +6261,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6277,7 +6278,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSystemDebugControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6294,7 +6295,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateJobObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6307,7 +6308,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateProcess_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6320,7 +6321,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateThread_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6352,7 +6353,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTraceControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6371,7 +6372,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTraceEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6388,7 +6389,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTranslateFilePath_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6402,7 +6403,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 378: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUmsThreadYield_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6413,7 +6414,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 379: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadDriver_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6424,7 +6425,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 380: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKey_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6436,7 +6437,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKey2_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6449,7 +6450,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKeyEx_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6465,7 +6466,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6483,7 +6484,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6498,7 +6499,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnmapViewOfSection_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6511,7 +6512,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtVdmControl_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6526,7 +6527,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForDebugEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6543,7 +6544,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6561,7 +6562,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6580,7 +6581,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6597,7 +6598,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
 		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForSingleObject_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6611,7 +6612,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
 		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6623,7 +6624,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 393: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitHighEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6634,7 +6635,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 394: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitLowEventPair_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6645,7 +6646,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	case 395: {
 		panda_noreturn = false;
 		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6664,7 +6665,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFile_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6691,7 +6692,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg6 = get_32(cpu, 6);
 		uint32_t arg7 = get_32(cpu, 7);
 		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFileGather_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6715,7 +6716,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
 		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteRequestData_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6735,7 +6736,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 		uint32_t arg2 = get_32(cpu, 2);
 		uint32_t arg3 = get_32(cpu, 3);
 		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (syscall_trace_on || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteVirtualMemory_return)))) {
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
@@ -6758,8 +6759,10 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
+	if (syscall_trace_on) syscall_trace_enter(cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		watch_syscall_return(cpu, ctx.retaddr);
 	}
 #endif
 }
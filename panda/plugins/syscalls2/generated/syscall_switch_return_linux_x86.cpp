@@ -11,6 +11,7 @@ extern "C" {
 #include "syscalls_ext_typedefs.h"
 #include "syscall_ppp_extern_return.h"
 }
+#include "syscall_trace.h"
 
 void syscall_return_switch_linux_x86(CPUState *cpu, target_ptr_t pc, const syscall_ctx_t *ctx) {
 #if defined(TARGET_I386) && !defined(TARGET_X86_64)
@@ -4081,6 +4082,7 @@ void syscall_return_switch_linux_x86(CPUState *cpu, target_ptr_t pc, const sysca
 	}
 	PPP_RUN_CB(on_all_sys_return, cpu, pc, ctx->no);
 	PPP_RUN_CB(on_all_sys_return2, cpu, pc, call, ctx);
+	if (syscall_trace_on) syscall_trace_return(cpu, pc, call, ctx);
 #endif
 }
 
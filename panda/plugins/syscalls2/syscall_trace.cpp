@@ -0,0 +1,312 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#define __STDC_FORMAT_MACROS
+
+#include "panda/plugin.h"
+#include "panda/plog-cc-bridge.h"
+
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+#include "syscalls2.h"
+#include "syscalls2_info.h"
+
+extern "C" {
+#include "syscalls_ext_typedefs.h"
+}
+
+#include "syscall_trace.h"
+
+extern const syscall_info_t *syscall_info;
+extern const syscall_meta_t *syscall_meta;
+target_long get_syscall_retval(CPUState *cpu);
+
+bool syscall_trace_on = false;
+
+// Single producer (the emulation thread), single consumer (the writer
+// thread, or the emulation thread itself for the pandalog). Records are
+// filled in place in the slot they'll be read from. For the pandalog each
+// record is written as soon as it's published, so its entries stay in
+// instr order with everything else in the log.
+static std::vector<syscall_trace_record_t> ring;
+static uint64_t ring_mask;
+static std::atomic<uint64_t> ring_head(0);     // next slot to fill
+static std::atomic<uint64_t> ring_tail(0);     // next slot to write out
+static uint64_t ring_stalls = 0;
+
+static uint32_t trace_strlen;
+static uint32_t trace_buflen;
+
+static FILE *trace_file = NULL;
+static bool trace_pandalog = false;
+static std::thread trace_writer;
+static std::atomic<bool> trace_stop(false);
+
+// Packed SyscallTrace entries reuse these across calls
+static Panda__SyscallTraceData trace_data[GLOBAL_MAX_SYSCALL_ARGS];
+static Panda__SyscallTraceData *trace_data_ptrs[GLOBAL_MAX_SYSCALL_ARGS];
+static std::vector<unsigned char> trace_buf;
+
+static inline bool is_str(const syscall_info_t *call, int i) {
+    return call->argt[i] == SYSCALL_ARG_STR;
+}
+
+static inline bool is_ptr(const syscall_info_t *call, int i) {
+    return call->argt[i] == SYSCALL_ARG_PTR;
+}
+
+/**
+ * @brief Reads up to limit bytes of guest memory at addr into the record's
+ * data, a page at a time, stopping after a NUL if nul_term. Unmapped memory
+ * ends the read.
+ */
+static void read_arg_data(CPUState *cpu, syscall_trace_record_t *rec, int i,
+                          target_ptr_t addr, uint32_t limit, bool nul_term) {
+    uint32_t room = SYSCALL_TRACE_DATA - rec->data_len;
+    uint32_t want = limit < room ? limit : room;
+    uint8_t *dst = rec->data + rec->data_len;
+    uint32_t got = 0;
+    bool done = false;
+
+    while (got < want && !done) {
+        uint32_t n = TARGET_PAGE_SIZE - ((addr + got) & ~TARGET_PAGE_MASK);
+        if (n > want - got) n = want - got;
+        if (panda_virtual_memory_read(cpu, addr + got, dst + got, n) != 0) break;
+        if (nul_term) {
+            uint8_t *nul = (uint8_t *)memchr(dst + got, 0, n);
+            if (nul) {
+                n = nul - (dst + got);
+                done = true;
+            }
+        }
+        got += n;
+    }
+
+    rec->data_off[i] = rec->data_len;
+    rec->data_size[i] = got;
+    if (nul_term ? (!done && got == want) : want < limit) {
+        // a string cut before its NUL, or a buffer cut short by the space
+        // left in the record
+        rec->truncated |= 1u << i;
+    }
+    rec->data_len += got;
+}
+
+static void fill_args(syscall_trace_record_t *rec, const syscall_info_t *call,
+                      const syscall_ctx_t *ctx) {
+    rec->nargs = call ? call->nargs : 0;
+    for (int i = 0; i < rec->nargs; i++) {
+        uint64_t v = 0;
+        switch (call->argsz[i]) {
+            case 2: { uint16_t x; memcpy(&x, ctx->args[i], 2); v = x; } break;
+            case 4: { uint32_t x; memcpy(&x, ctx->args[i], 4); v = x; } break;
+            default: memcpy(&v, ctx->args[i], 8); break;
+        }
+        if (call->argt[i] == SYSCALL_ARG_S32) v = (int64_t)(int32_t)v;
+        if (call->argt[i] == SYSCALL_ARG_S16) v = (int64_t)(int16_t)v;
+        rec->args[i] = v;
+    }
+}
+
+static void write_pandalog_record(const syscall_trace_record_t *rec) {
+    Panda__SyscallTrace st = PANDA__SYSCALL_TRACE__INIT;
+    st.no = rec->no;
+    st.is_return = rec->is_return;
+    st.asid = rec->asid;
+    st.retaddr = rec->retaddr;
+    st.n_args = rec->nargs;
+    st.args = (uint64_t *)rec->args;
+    if (rec->is_return) {
+        st.has_retval = 1;
+        st.retval = rec->retval;
+    }
+    if (syscall_info != NULL && syscall_meta != NULL &&
+            rec->no >= 0 && (uint32_t)rec->no <= syscall_meta->max_generic) {
+        st.name = (char *)syscall_info[rec->no].name;
+    }
+    size_t nd = 0;
+    for (int i = 0; i < rec->nargs; i++) {
+        if (rec->data_size[i] == 0) continue;
+        Panda__SyscallTraceData *d = &trace_data[nd];
+        panda__syscall_trace_data__init(d);
+        d->arg = i;
+        d->data.len = rec->data_size[i];
+        d->data.data = (uint8_t *)rec->data + rec->data_off[i];
+        if (rec->truncated & (1u << i)) {
+            d->has_truncated = 1;
+            d->truncated = 1;
+        }
+        trace_data_ptrs[nd++] = d;
+    }
+    st.n_data = nd;
+    st.data = trace_data_ptrs;
+
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.pc = rec->pc;
+    ple.instr = rec->instr;
+    ple.syscall_trace = &st;
+
+    size_t n = panda__log_entry__get_packed_size(&ple);
+    if (n > trace_buf.size()) trace_buf.resize(2 * n);
+    panda__log_entry__pack(&ple, trace_buf.data());
+    pandalog_cc_write_packed(trace_buf.data(), n, rec->instr);
+}
+
+static void write_file_record(const syscall_trace_record_t *rec) {
+    fwrite(rec, offsetof(syscall_trace_record_t, data), 1, trace_file);
+    fwrite(rec->data, rec->data_len, 1, trace_file);
+}
+
+/**
+ * @brief Writes out every record published so far. Only one thread may
+ * drain the ring.
+ */
+static uint64_t drain(void) {
+    uint64_t tail = ring_tail.load(std::memory_order_relaxed);
+    uint64_t head = ring_head.load(std::memory_order_acquire);
+    for (uint64_t i = tail; i != head; i++) {
+        const syscall_trace_record_t *rec = &ring[i & ring_mask];
+        if (trace_pandalog) write_pandalog_record(rec);
+        else write_file_record(rec);
+    }
+    ring_tail.store(head, std::memory_order_release);
+    return head - tail;
+}
+
+static void writer_thread(void) {
+    while (true) {
+        bool stopping = trace_stop.load(std::memory_order_acquire);
+        if (drain() == 0) {
+            if (stopping) break;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+    fflush(trace_file);
+}
+
+/**
+ * @brief Returns the slot for the next record, waiting for a drain if the
+ * ring is full. The pandalog never lets it fill.
+ */
+static syscall_trace_record_t *next_slot(void) {
+    uint64_t head = ring_head.load(std::memory_order_relaxed);
+    if (head - ring_tail.load(std::memory_order_acquire) == ring.size()) {
+        ring_stalls++;
+        while (head - ring_tail.load(std::memory_order_acquire) == ring.size()) {
+            std::this_thread::yield();
+        }
+    }
+    return &ring[head & ring_mask];
+}
+
+static inline void publish(void) {
+    ring_head.store(ring_head.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+    if (trace_pandalog) drain();
+}
+
+static syscall_trace_record_t *start_record(target_ptr_t pc, const syscall_ctx_t *ctx,
+                                            bool is_return) {
+    syscall_trace_record_t *rec = next_slot();
+    rec->instr = rr_get_guest_instr_count();
+    rec->pc = pc;
+    rec->asid = ctx->asid;
+    rec->retaddr = ctx->retaddr;
+    rec->retval = 0;
+    rec->no = ctx->no;
+    rec->is_return = is_return;
+    rec->data_len = 0;
+    rec->truncated = 0;
+    memset(rec->data_size, 0, sizeof(rec->data_size));
+    return rec;
+}
+
+void syscall_trace_enter(CPUState *cpu, target_ptr_t pc,
+                         const syscall_info_t *call, const syscall_ctx_t *ctx) {
+    syscall_trace_record_t *rec = start_record(pc, ctx, false);
+    fill_args(rec, call, ctx);
+    for (int i = 0; i < rec->nargs; i++) {
+        if (is_str(call, i) && rec->args[i] != 0) {
+            read_arg_data(cpu, rec, i, rec->args[i], trace_strlen, true);
+        }
+    }
+    publish();
+}
+
+void syscall_trace_return(CPUState *cpu, target_ptr_t pc,
+                          const syscall_info_t *call, const syscall_ctx_t *ctx) {
+    syscall_trace_record_t *rec = start_record(pc, ctx, true);
+    rec->retval = get_syscall_retval(cpu);
+    fill_args(rec, call, ctx);
+    // buffers are usually filled in by the call, so read them now
+    for (int i = 0; i < rec->nargs; i++) {
+        if (is_ptr(call, i) && rec->args[i] != 0) {
+            read_arg_data(cpu, rec, i, rec->args[i], trace_buflen, false);
+        }
+    }
+    publish();
+}
+
+bool syscall_trace_init(const char *dest, uint32_t ring_records,
+                        uint32_t strlen_limit, uint32_t buflen_limit) {
+    if (0 == strcmp(dest, "pandalog")) {
+        if (!pandalog) {
+            std::cerr << PANDA_MSG "ERROR trace=pandalog needs -pandalog" << std::endl;
+            return false;
+        }
+        trace_pandalog = true;
+    } else {
+        trace_file = fopen(dest, "wb");
+        if (trace_file == NULL) {
+            std::cerr << PANDA_MSG "ERROR couldn't open trace file " << dest << std::endl;
+            return false;
+        }
+        uint32_t version = SYSCALL_TRACE_VERSION;
+        uint32_t header_size = offsetof(syscall_trace_record_t, data);
+        fwrite(SYSCALL_TRACE_MAGIC, 8, 1, trace_file);
+        fwrite(&version, sizeof(version), 1, trace_file);
+        fwrite(&header_size, sizeof(header_size), 1, trace_file);
+    }
+
+    uint64_t n = 1;
+    while (n < ring_records) n <<= 1;
+    ring.resize(n);
+    ring_mask = n - 1;
+    trace_strlen = strlen_limit;
+    trace_buflen = buflen_limit;
+
+    if (trace_file != NULL) {
+        trace_writer = std::thread(writer_thread);
+    }
+    syscall_trace_on = true;
+    return true;
+}
+
+void syscall_trace_close(void) {
+    if (!syscall_trace_on) return;
+    syscall_trace_on = false;
+    if (trace_pandalog) {
+        drain();
+    } else {
+        trace_stop.store(true, std::memory_order_release);
+        trace_writer.join();
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+    if (ring_stalls) {
+        std::cerr << PANDA_MSG "syscall trace stalled " << ring_stalls
+                  << " times on a full ring" << std::endl;
+    }
+    std::vector<syscall_trace_record_t>().swap(ring);
+}
+
+/* vim:set tabstop=4 softtabstop=4 expandtab: */
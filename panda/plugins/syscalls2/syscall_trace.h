@@ -0,0 +1,62 @@
+/*!
+ * @file syscall_trace.h
+ * @brief Syscall trace mode: every system call entry and return decoded
+ * once into a fixed-size record, streamed out through a ring buffer.
+ *
+ * The enter/return switches already read every argument into the
+ * syscall_ctx_t; in trace mode they hand that context to
+ * syscall_trace_enter/syscall_trace_return, which fill a record in place
+ * in a preallocated single-producer ring (strings are read at entry,
+ * buffers at return, both up to a limit). Nothing is allocated per call.
+ *
+ * With trace=<file> a consumer thread drains the ring into a binary file:
+ *
+ *   char magic[8]                   SYSCALL_TRACE_MAGIC
+ *   u32 version                     SYSCALL_TRACE_VERSION
+ *   u32 header_size                 offsetof(syscall_trace_record_t, data)
+ *   records, each header_size bytes of syscall_trace_record_t followed by
+ *   its data_len bytes of data
+ *
+ * With trace=pandalog each record is written as a SyscallTrace pandalog
+ * entry (see syscalls2.proto) as soon as it's filled, on the emulation
+ * thread since the pandalog isn't thread safe, so that pandalog instrs
+ * stay in order.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define SYSCALL_TRACE_MAGIC "PANDASCT"
+#define SYSCALL_TRACE_VERSION 1
+// bytes of string/buffer contents one record can hold
+#define SYSCALL_TRACE_DATA 1024
+
+typedef struct syscall_trace_record {
+    uint64_t instr;
+    uint64_t pc;
+    uint64_t asid;
+    uint64_t retaddr;
+    int64_t retval;                     // return records only
+    int32_t no;
+    uint8_t is_return;
+    uint8_t nargs;
+    uint16_t data_len;
+    uint64_t args[GLOBAL_MAX_SYSCALL_ARGS];
+    // contents of string/pointer args: data[data_off[i] .. +data_size[i]]
+    uint16_t data_off[GLOBAL_MAX_SYSCALL_ARGS];
+    uint16_t data_size[GLOBAL_MAX_SYSCALL_ARGS];
+    uint32_t truncated;                 // bit i: arg i's data hit the limit
+    uint8_t data[SYSCALL_TRACE_DATA];
+} syscall_trace_record_t;
+
+extern bool syscall_trace_on;
+
+// dest is a file name or "pandalog"; false if the trace can't be started
+bool syscall_trace_init(const char *dest, uint32_t ring_records,
+                        uint32_t strlen_limit, uint32_t buflen_limit);
+void syscall_trace_enter(CPUState *cpu, target_ptr_t pc,
+                         const syscall_info_t *call, const syscall_ctx_t *ctx);
+void syscall_trace_return(CPUState *cpu, target_ptr_t pc,
+                          const syscall_info_t *call, const syscall_ctx_t *ctx);
+void syscall_trace_close(void);
@@ -32,12 +32,16 @@ PANDAENDCOMMENT */
 #include <vector>
 #include <iostream>
 #include <sstream>
+#include <set>
+#include <unordered_set>
+#include <utility>
 
 #include "syscalls2.h"
 #include "syscalls2_info.h"
 
 bool translate_callback(CPUState *cpu, target_ulong pc);
 int exec_callback(CPUState *cpu, target_ulong pc);
+void reset_code_cache(CPUState *cpu, target_ulong pc);
 
 extern "C" {
 bool init_plugin(void *);
@@ -55,6 +59,8 @@ void registerExecPreCallback(void (*callback)(CPUState*, target_ulong));
 #include "generated/syscall_ppp_register_return.cpp"
 }
 
+#include "syscall_trace.h"
+
 // Forward declarations
 int32_t get_s32_generic(CPUState *cpu, uint32_t argnum);
 int64_t get_s64_generic(CPUState *cpu, uint32_t argnum);
@@ -597,20 +603,59 @@ static inline std::string context_map_t_dump(context_map_t &cm) {
 }
 #endif
 
-#if defined(TARGET_PPC)
-#else
 /**
- * @brief Checks if the translation block that is about to be executed
- * matches the return address of an executing system call.
+ * @brief Every address a system call has been registered to return to.
+ * Instructions at these addresses are translated with an insn_exec call
+ * that checks running_syscalls; all other code runs uninstrumented, so
+ * ordinary blocks pay nothing for return tracking. Addresses are never
+ * removed: a return site is used over and over, and dropping it would
+ * mean retranslating it for every system call.
+ */
+static std::unordered_set<target_ptr_t> return_pcs;
+
+/**
+ * @brief The (asid, address) pairs whose translation is known to have the
+ * return check. Other processes may have different code at a pc that is
+ * already in return_pcs, translated before it got there, so each process
+ * invalidates its own translation the first time it returns to a pc.
+ */
+static std::set<std::pair<target_ptr_t, target_ptr_t>> return_sites;
+
+// Discard any translated code for the instruction at addr so that its next
+// translation picks up the return check.
+static void invalidate_addr(CPUState *cpu, target_ulong addr) {
+    hwaddr phys = panda_virt_to_phys(cpu, addr);
+    if (phys == (hwaddr)-1) {
+        // not mapped right now; we can't find its translations, drop them all
+        panda_do_flush_tb();
+    } else {
+        tb_invalidate_phys_addr(&address_space_memory, phys);
+    }
+}
+
+/**
+ * @brief Called by the enter switch when a system call that will return
+ * has been added to running_syscalls.
+ */
+void watch_syscall_return(CPUState *cpu, target_ptr_t retaddr) {
+    return_pcs.insert(retaddr);
+    if (return_sites.emplace(panda_current_asid(cpu), retaddr).second) {
+        invalidate_addr(cpu, retaddr);
+    }
+}
+
+/**
+ * @brief Runs before the instruction at a known return address: if a
+ * system call of the current process returns here, finish it.
  */
-static void tb_check_syscall_return(CPUState *cpu, TranslationBlock *tb) {
-    auto k = std::make_pair(tb->pc, panda_current_asid(cpu));
+static void check_syscall_return(CPUState *cpu, target_ulong pc) {
+    auto k = std::make_pair(pc, panda_current_asid(cpu));
     auto ctxi = running_syscalls.find(k);
     int UNUSED(no) = -1;
     if (ctxi != running_syscalls.end()) {
         syscall_ctx_t *ctx = &ctxi->second;
         no = ctx->no;
-        syscalls_profile->return_switch(cpu, tb->pc, ctx);
+        syscalls_profile->return_switch(cpu, pc, ctx);
         running_syscalls.erase(ctxi);
     }
 #if defined(SYSCALL_RETURN_DEBUG)
@@ -624,24 +669,24 @@ static void tb_check_syscall_return(CPUState *cpu, TranslationBlock *tb) {
 #endif
     return;
 }
-#endif
 
 #ifdef DEBUG
 static std::map<target_ulong,target_ulong> syscallCounter;
 static uint32_t impossibleToReadPCs = 0;
 #endif
 
-// Check if the instruction is sysenter (0F 34),
-// syscall (0F 05) or int 0x80 (CD 80)
-int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
 #if defined(TARGET_I386)
-    unsigned char buf[2] = {};
-
-    int res = panda_virtual_memory_rw(cpu, pc, buf, 2, 0);
-    if(res <0){
-        return -1;
-    }
+#define SYSCALL_INSN_BYTES 2
+#elif defined(TARGET_ARM)
+#define SYSCALL_INSN_BYTES 4
+#else
+#define SYSCALL_INSN_BYTES 1
+#endif
 
+// Check if the instruction in buf is sysenter (0F 34),
+// syscall (0F 05) or int 0x80 (CD 80)
+static bool isSyscallInsn(CPUState *cpu, const unsigned char *buf) {
+#if defined(TARGET_I386)
     // Check if the instruction is syscall (0F 05)
     if (buf[0]== 0x0F && buf[1] == 0x05) {
         return true;
@@ -668,12 +713,9 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
         return false;
     }
 #elif defined(TARGET_ARM)
-    unsigned char buf[4] = {};
-
     // Check for ARM mode syscall
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
     if(env->thumb == 0) {
-        panda_virtual_memory_rw(cpu, pc, buf, 4, 0);
         // EABI
         if ( ((buf[3] & 0x0F) ==  0x0F)  && (buf[2] == 0) && (buf[1] == 0) && (buf[0] == 0) ) {
             return true;
@@ -685,7 +727,6 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
 #endif
     }
     else {
-        panda_virtual_memory_rw(cpu, pc, buf, 2, 0);
         // check for Thumb mode syscall
         if (buf[1] == 0xDF && buf[0] == 0){
             return true;
@@ -697,9 +738,66 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
 #endif
 }
 
+// Bytes isSyscallInsn looks at for the current instruction set
+static inline uint32_t syscallInsnLen(CPUState *cpu) {
+#if defined(TARGET_ARM)
+    // a Thumb syscall is only 2 bytes long
+    CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+    return env->thumb ? 2 : 4;
+#else
+    return SYSCALL_INSN_BYTES;
+#endif
+}
+
+int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
+    unsigned char buf[SYSCALL_INSN_BYTES] = {};
+    if (panda_virtual_memory_rw(cpu, pc, buf, syscallInsnLen(cpu), 0) < 0) {
+        return -1;
+    }
+    return isSyscallInsn(cpu, buf);
+}
+
+/**
+ * @brief Guest code of the block being translated. insn_translate runs for
+ * every instruction, so rather than reading guest memory for each one the
+ * code is read in one go, up to the end of the page, the first time it's
+ * needed in a block.
+ */
+static struct {
+    target_ulong start;
+    uint32_t len;
+    unsigned char bytes[128];
+} code_cache;
+
+void reset_code_cache(CPUState *cpu, target_ulong pc) {
+    code_cache.len = 0;
+}
+
+static const unsigned char *code_bytes(CPUState *cpu, target_ulong pc,
+                                       uint32_t need) {
+    if (pc >= code_cache.start
+        && pc + need <= code_cache.start + code_cache.len) {
+        return &code_cache.bytes[pc - code_cache.start];
+    }
+    target_ulong page_end = (pc & TARGET_PAGE_MASK) + TARGET_PAGE_SIZE;
+    uint32_t len = MIN(sizeof(code_cache.bytes), page_end - pc);
+    // an instruction that straddles the page boundary is read on its own
+    len = MAX(len, need);
+    code_cache.len = 0;
+    if (panda_virtual_memory_rw(cpu, pc, code_cache.bytes, len, 0) < 0) {
+        return NULL;
+    }
+    code_cache.start = pc;
+    code_cache.len = len;
+    return code_cache.bytes;
+}
+
 // This will only be called for instructions where the
-// translate_callback returned true
+// translate_callback returned true: system calls and return sites
 int exec_callback(CPUState *cpu, target_ulong pc) {
+    if (!running_syscalls.empty() && return_pcs.count(pc)) {
+        check_syscall_return(cpu, pc);
+    }
     int res = isCurrentInstructionASyscall(cpu,pc);
 #if defined(SYSCALL_RETURN_DEBUG) && defined(TARGET_I386)
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
@@ -734,7 +832,11 @@ int exec_callback(CPUState *cpu, target_ulong pc) {
 }
 
 bool translate_callback(CPUState* cpu, target_ulong pc){
-    return isCurrentInstructionASyscall(cpu, pc) == 1;
+    if (return_pcs.count(pc)) {
+        return true;
+    }
+    const unsigned char *buf = code_bytes(cpu, pc, syscallInsnLen(cpu));
+    return buf != NULL && isSyscallInsn(cpu, buf);
 }
 
 
@@ -827,14 +929,29 @@ bool init_plugin(void *self) {
     panda_register_callback(self, PANDA_CB_INSN_TRANSLATE, pcb);
     pcb.insn_exec = exec_callback;
     panda_register_callback(self, PANDA_CB_INSN_EXEC, pcb);
-    pcb.before_block_exec = tb_check_syscall_return;
-    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
+    pcb.before_block_translate = reset_code_cache;
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_TRANSLATE, pcb);
+
+    // trace every system call; records need the argument types, so this
+    // implies load-info
+    const char *trace = panda_parse_string_opt(plugin_args, "trace", NULL,
+            "Trace all system calls to this file, or to the pandalog with trace=pandalog.");
+    uint32_t trace_ring = panda_parse_uint32_opt(plugin_args, "trace_ring", 4096,
+            "Trace records buffered before output.");
+    uint32_t trace_strlen = panda_parse_uint32_opt(plugin_args, "trace_strlen", 256,
+            "Bytes of each string argument to trace.");
+    uint32_t trace_buflen = panda_parse_uint32_opt(plugin_args, "trace_buflen", 64,
+            "Bytes of each buffer argument to trace, read at return.");
 
     // load system call info
-    if (panda_parse_bool_opt(plugin_args, "load-info", "Load systemcall information for the selected os.")) {
+    if (panda_parse_bool_opt(plugin_args, "load-info", "Load systemcall information for the selected os.") || trace) {
         if (load_syscall_info() < 0) return false;
     }
 
+    if (trace && !syscall_trace_init(trace, trace_ring, trace_strlen, trace_buflen)) {
+        return false;
+    }
+
 #if defined(SYSCALL_RETURN_DEBUG)
     assert((syscall_info != NULL) && "syscall return debugging requires loading syscall info");
 #endif
@@ -850,6 +967,7 @@ bool init_plugin(void *self) {
 
 void uninit_plugin(void *self) {
     //(void) self;
+    syscall_trace_close();
 #ifdef DEBUG
     std::cout << PANDA_MSG "DEBUG syscall count per asid:";
     for(const auto &asid_count : syscallCounter){
@@ -4,6 +4,8 @@ typedef struct CPUState CPUState;
 typedef struct syscall_ctx syscall_ctx_t;
 typedef std::map<std::pair<target_ptr_t, target_ptr_t>, syscall_ctx_t> context_map_t;
 extern context_map_t running_syscalls;
+// have the instruction at retaddr check running_syscalls when it executes
+void watch_syscall_return(CPUState *cpu, target_ptr_t retaddr);
 
 // grep -hE '^.*syscall_(enter|return)_switch_[^(]*\(' *.cpp | sed 's/ {$/;/' >> syscalls2.h
 void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc);
@@ -3,59 +3,49 @@ extern "C" {
 }
 
 #include <cassert>
+#include <cstring>
 
-#include <map>
+#include <algorithm>
 #include <vector>
 #include <set>
-#include <unordered_set>
-#include <unordered_map>
-#include <functional>
 
 #include "label_set.h"
 
-template<typename T>
+// Bump allocator for label sets.  Label sets are never freed individually, so
+// we just carve them out of ever larger mmaped blocks.
 class ArenaAlloc {
 private:
     uint8_t *next = NULL;
+    uint8_t *limit = NULL;
     std::vector<std::pair<uint8_t *, size_t>> blocks;
     size_t next_block_size = 1 << 15;
+    uint64_t used = 0;
 
-    void alloc_block() {
+    void alloc_block(size_t min_size) {
+        while (next_block_size < min_size) next_block_size <<= 1;
         //printf("taint2: allocating block of size %lu\n", next_block_size);
         next = (uint8_t *)mmap(NULL, next_block_size, PROT_READ | PROT_WRITE,
                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-        assert(next);
+        assert(next != MAP_FAILED);
+        limit = next + next_block_size;
         blocks.push_back(std::make_pair(next, next_block_size));
         next_block_size <<= 1;
     }
 
-    T *alloc_imp() {
-        assert(blocks.size() > 0);
-        std::pair<uint8_t *, size_t>& block = blocks.back();
-        if (next + sizeof(T) > block.first + block.second) {
-            alloc_block();
-            assert(next != NULL);
+public:
+    void *alloc(size_t bytes) {
+        bytes = (bytes + 7) & ~(size_t)7;
+        if (next + bytes > limit) {
+            alloc_block(bytes);
         }
 
-        T *result = new(next) T;
-        next += sizeof(T);
+        void *result = next;
+        next += bytes;
+        used += bytes;
         return result;
     }
 
-public:
-    ArenaAlloc() {
-        alloc_block();
-    }
-
-    const T *alloc() {
-        return alloc_imp();
-    }
-
-    const T *alloc(T &old) {
-        T *result = alloc_imp();
-        result->swap(old);
-        return result;
-    }
+    uint64_t bytes_used() const { return used; }
 
     ~ArenaAlloc() {
         for (auto&& block : blocks) {
@@ -64,61 +54,136 @@ public:
     }
 };
 
-static ArenaAlloc<std::set<uint32_t>> LSA;
-
-namespace std {
-template<>
-class hash<set<uint32_t>> {
-  public:
-    size_t operator()(const set<uint32_t> &labels) const {
-        uint64_t result = 0;
-        for (uint32_t l : labels) {
-            result ^= l;
-            result = result << 11 | result >> 53;
+static inline uint64_t mix64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+static inline uint64_t hash_labels(const TaintLabel *labels, uint32_t card) {
+    uint64_t result = card;
+    for (uint32_t i = 0; i < card; i++) {
+        result = mix64(result ^ labels[i]);
+    }
+    return result;
+}
+
+// Open-addressing hash table holding every label set ever created.  This is
+// what makes label sets unique: a set is only allocated if no set with the
+// same contents exists yet.
+class LabelSetTable {
+private:
+    ArenaAlloc arena;
+    std::vector<LabelSetP> slots;
+    std::vector<LabelSetP> by_id;
+    uint32_t count = 0;
+
+    void grow() {
+        std::vector<LabelSetP> old(slots.size() * 2, nullptr);
+        old.swap(slots);
+        size_t mask = slots.size() - 1;
+        for (LabelSetP ls : old) {
+            if (!ls) continue;
+            size_t i = ls->hash & mask;
+            while (slots[i]) i = (i + 1) & mask;
+            slots[i] = ls;
+        }
+    }
+
+public:
+    LabelSetTable() : slots(1 << 12, nullptr), by_id(1, nullptr) {}
+
+    LabelSetP intern(const TaintLabel *labels, uint32_t card) {
+        uint64_t hash = hash_labels(labels, card);
+        size_t mask = slots.size() - 1;
+        size_t i = hash & mask;
+        for (; slots[i]; i = (i + 1) & mask) {
+            LabelSetP ls = slots[i];
+            if (ls->hash == hash && ls->card == card &&
+                    memcmp(ls->begin(), labels, card * sizeof(TaintLabel)) == 0) {
+                return ls;
+            }
         }
+
+        LabelSet *result = (LabelSet *)arena.alloc(
+                sizeof(LabelSet) + card * sizeof(TaintLabel));
+        result->id = ++count;
+        result->card = card;
+        result->hash = hash;
+        memcpy(result + 1, labels, card * sizeof(TaintLabel));
+        slots[i] = result;
+        by_id.push_back(result);
+
+        // keep the load factor at or below 1/2
+        if (2 * count > slots.size()) grow();
         return result;
     }
-};
 
-template<>
-class hash<pair<LabelSetP, LabelSetP>> {
-  public:
-    size_t operator()(const pair<LabelSetP, LabelSetP> &labels) const {
-        return hash<LabelSetP>()(labels.first) ^
-            (hash<LabelSetP>()(labels.second) << (sizeof(LabelSetP) / 2));
+    // make room for n more sets without growing along the way
+    void reserve(uint32_t n) {
+        while (2 * ((size_t)count + n) > slots.size()) grow();
+        by_id.reserve(by_id.size() + n);
     }
+
+    LabelSetP lookup(uint32_t id) const { return by_id[id]; }
+
+    uint64_t size() const { return count; }
+    uint64_t arena_bytes() const { return arena.bytes_used(); }
 };
-}
 
-static std::unordered_set<std::set<uint32_t>> label_sets;
-LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
-    static std::unordered_map<std::pair<LabelSetP, LabelSetP>, LabelSetP> memoized_unions;
+static LabelSetTable label_sets;
+
+// Direct-mapped memo of recent unions.  Unlike an unbounded map this has a
+// fixed footprint; a collision just evicts the older entry.
+#define UNION_CACHE_BITS 16
+struct UnionCacheEntry {
+    LabelSetP min;
+    LabelSetP max;
+    LabelSetP result;
+};
+static UnionCacheEntry union_cache[1 << UNION_CACHE_BITS];
+
+static uint64_t union_calls = 0;
+static uint64_t union_cache_hits = 0;
 
+LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
     if (ls1 == ls2) {
         return ls1;
     } else if (ls1 && ls2) {
-        LabelSetP min = std::min(ls1, ls2);
-        LabelSetP max = std::max(ls1, ls2);
-        std::pair<LabelSetP, LabelSetP> minmax(min, max);
-
-        {
-            auto it = memoized_unions.find(minmax);
-            if (it != memoized_unions.end()) {
-                return it->second;
-            }
+        LabelSetP min = ls1->id < ls2->id ? ls1 : ls2;
+        LabelSetP max = ls1->id < ls2->id ? ls2 : ls1;
+        union_calls++;
+
+        UnionCacheEntry &entry = union_cache[
+            mix64((uint64_t)min->id << 32 | max->id) &
+            ((1 << UNION_CACHE_BITS) - 1)];
+        if (entry.min == min && entry.max == max) {
+            union_cache_hits++;
+            return entry.result;
         }
 
-        std::set<uint32_t> temp(*min);
-        for (auto l : *max) {
-            temp.insert(l);
+        static std::vector<TaintLabel> temp;
+        temp.resize(min->card + max->card);
+        auto temp_end = std::set_union(min->begin(), min->end(),
+                max->begin(), max->end(), temp.begin());
+        uint32_t card = temp_end - temp.begin();
+
+        // if one set contains the other, no need to go to the intern table
+        LabelSetP result;
+        if (card == max->card) {
+            result = max;
+        } else if (card == min->card) {
+            result = min;
+        } else {
+            result = label_sets.intern(temp.data(), card);
         }
 
-        // insert returns a pair <iterator, bool>; second is whether it happened
-        // first is iterator to new/existing element
-        auto it = label_sets.insert(temp).first;
-        const std::set<uint32_t> *result = &(*it);
-
-        memoized_unions.insert(std::make_pair(minmax, result));
+        entry.min = min;
+        entry.max = max;
+        entry.result = result;
         return result;
     } else if (ls1) {
         return ls1;
@@ -127,13 +192,39 @@ LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
     } else return nullptr;
 }
 
-LabelSetP label_set_singleton(uint32_t label) {
-    std::set<uint32_t> temp;
-    temp.insert(label);
-    return LSA.alloc(temp);
+LabelSetP label_set_singleton(TaintLabel label) {
+    return label_sets.intern(&label, 1);
+}
+
+void label_set_singletons(TaintLabel first, uint32_t n, LabelSetP *out) {
+    label_sets.reserve(n);
+    for (uint32_t i = 0; i < n; i++) {
+        TaintLabel l = first + i;
+        out[i] = label_sets.intern(&l, 1);
+    }
+}
+
+LabelSetP label_set_from_id(uint32_t id) {
+    return label_sets.lookup(id);
+}
+
+void label_set_iter(LabelSetP ls, void (*leaf)(TaintLabel, void *), void *user) {
+    if (!ls) return;
+    for (TaintLabel l : *ls) {
+        leaf(l, user);
+    }
+}
+
+std::set<TaintLabel> label_set_render_set(LabelSetP ls) {
+    if (ls) return std::set<TaintLabel>(ls->begin(), ls->end());
+    else return std::set<TaintLabel>();
 }
 
-std::set<uint32_t> label_set_render_set(LabelSetP ls) {
-    if (ls) return *ls;
-    else return std::set<uint32_t>();
+LabelSetStats label_set_stats() {
+    LabelSetStats stats;
+    stats.num_sets = label_sets.size();
+    stats.arena_bytes = label_sets.arena_bytes();
+    stats.union_calls = union_calls;
+    stats.union_cache_hits = union_cache_hits;
+    return stats;
 }
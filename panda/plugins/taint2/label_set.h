@@ -15,19 +15,53 @@ PANDAENDCOMMENT */
 #ifndef __LABEL_SET_H_
 #define __LABEL_SET_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <set>
 
 typedef uint32_t TaintLabel;
 
+// An immutable, hash-consed set of taint labels.  The labels are stored sorted
+// in a flat array placed directly after this header in the label set arena, so
+// each set is one contiguous allocation.  Sets are interned: two label sets with
+// the same contents are always the same object, so pointer equality (or id
+// equality) is set equality.  Never construct one of these directly; use
+// label_set_singleton and label_set_union.
+struct LabelSet {
+    uint32_t id;    // dense id handed out at interning time, starting at 1
+    uint32_t card;  // number of labels in the set
+    uint64_t hash;  // hash of the label contents
+
+    size_t size() const { return card; }
+    const TaintLabel *begin() const {
+        return reinterpret_cast<const TaintLabel *>(this + 1);
+    }
+    const TaintLabel *end() const { return begin() + card; }
+};
+
 extern "C" {
-typedef const std::set<TaintLabel> *LabelSetP;
+typedef const LabelSet *LabelSetP;
 LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2);
 LabelSetP label_set_singleton(TaintLabel label);
 }
 
+// Singletons {first}, {first+1}, ... {first+n-1} into out[0..n-1].
+void label_set_singletons(TaintLabel first, uint32_t n, LabelSetP *out);
+
+// Label sets by id; id 0 is the empty set (NULL).
+inline uint32_t label_set_id(LabelSetP ls) { return ls ? ls->id : 0; }
+LabelSetP label_set_from_id(uint32_t id);
+
 void label_set_iter(LabelSetP ls, void (*leaf)(TaintLabel, void *), void *user);
 std::set<TaintLabel> label_set_render_set(LabelSetP ls);
 
+// Statistics about the label set engine, mostly useful for benchmarking.
+struct LabelSetStats {
+    uint64_t num_sets;          // distinct label sets interned
+    uint64_t arena_bytes;       // bytes handed out from the label set arena
+    uint64_t union_calls;       // label_set_union calls with two non-NULL sets
+    uint64_t union_cache_hits;  // ... of which were answered by the cache
+};
+LabelSetStats label_set_stats();
 
 #endif
@@ -21,6 +21,7 @@ PANDAENDCOMMENT */
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/Support/raw_ostream.h>
@@ -45,11 +46,13 @@ PANDAENDCOMMENT */
 #include "llvm_taint_lib.h"
 #include "taint_ops.h"
 #include "taint2.h"
+#include "taint_trace.h"
 
 extern "C" {
 #include "libgen.h"
 
 extern bool tainted_pointer;
+extern bool detaint_cb0_bytes;
 
 PPP_PROT_REG_CB(on_branch2);
 PPP_CB_BOILERPLATE(on_branch2);
@@ -107,6 +110,7 @@ static void taint_branch_run(Shad *shad, uint64_t src, uint64_t size)
 {
     // this arg should be the register number
     Addr a = make_laddr(src / MAXREGSIZE, 0);
+    TAINT_TRACE(TT_BRANCH, nullptr, 0, 0, shad, src, size);
     PPP_RUN_CB(on_branch2, a, size);
 }
 
@@ -197,11 +201,11 @@ bool PandaTaintFunctionPass::doInitialization(Module &M) {
     assert(instrT);
     PTV.instrT = PointerType::getUnqual(instrT);
 
-    PTV.llvConst = const_struct_ptr(ctx, shadP, &shad->llv);
-    PTV.memConst = const_struct_ptr(ctx, shadP, &shad->ram);
-    PTV.grvConst = const_struct_ptr(ctx, shadP, &shad->grv);
-    PTV.gsvConst = const_struct_ptr(ctx, shadP, &shad->gsv);
-    PTV.retConst = const_struct_ptr(ctx, shadP, &shad->ret);
+    PTV.llvConst = const_struct_ptr(ctx, shadP, shad->llv);
+    PTV.memConst = const_struct_ptr(ctx, shadP, shad->ram);
+    PTV.grvConst = const_struct_ptr(ctx, shadP, shad->grv);
+    PTV.gsvConst = const_struct_ptr(ctx, shadP, shad->gsv);
+    PTV.retConst = const_struct_ptr(ctx, shadP, shad->ret);
 
     PTV.dataLayout = new DataLayout(&M);
 
@@ -287,6 +291,7 @@ bool PandaTaintFunctionPass::runOnFunction(Function &F) {
         for (Instruction *I : insts) {
             PTV.visit(I);
         }
+        PTV.optimizeTaintOps(BB);
     }
 #ifdef TAINT2_DEBUG
     //F.dump();
@@ -754,6 +759,286 @@ void PandaTaintVisitor::insertTaintQueryNonConstPc(Instruction &I, Value *new_pc
     inlineCallBefore(I, copyRegToPcF, args);
 }
 
+/*
+ * Taint op optimizer.
+ *
+ * The visitor emits one taint op per LLVM instruction and never looks at the
+ * ops around it.  Once a block has been instrumented we make two passes over
+ * the ops that were inserted into it:
+ *
+ *  - a backward pass drops ops whose destination bytes are overwritten by a
+ *    later op in the block before anything reads them (this also takes care
+ *    of compute chains that keep recomputing the same destination);
+ *  - a forward pass coalesces adjacent deletes and adjacent copies between
+ *    contiguous ranges into a single bulk op, and drops an op that exactly
+ *    repeats the one before it.
+ *
+ * Only ops whose shadow addresses and sizes are compile time constants are
+ * touched.  Any call we don't understand (guest helpers, which may longjmp
+ * out of the block, frame push/pop, host copies, pointer ops, branch and pc
+ * queries) is a barrier for both passes.  Ops have to stay out of line for
+ * this to work, so the optimizer is a no-op when taint ops are inlined, and
+ * it is skipped when someone tracks taint state changes, since every elided
+ * op would be a missing on_taint_change report.
+ */
+bool optimize_taint_ops = false;
+
+namespace {
+
+// Sorted, disjoint list of [lo, hi) byte ranges within one shadow.
+struct ByteRanges {
+    vector<pair<uint64_t, uint64_t>> r;
+
+    bool covers(uint64_t lo, uint64_t hi) const {
+        for (auto &p : r) {
+            if (p.first <= lo && hi <= p.second) return true;
+        }
+        return false;
+    }
+
+    void add(uint64_t lo, uint64_t hi) {
+        vector<pair<uint64_t, uint64_t>> out;
+        for (auto &p : r) {
+            if (p.second < lo || hi < p.first) {
+                out.push_back(p);
+            } else {
+                lo = std::min(lo, p.first);
+                hi = std::max(hi, p.second);
+            }
+        }
+        out.push_back(std::make_pair(lo, hi));
+        std::sort(out.begin(), out.end());
+        r.swap(out);
+    }
+
+    void remove(uint64_t lo, uint64_t hi) {
+        vector<pair<uint64_t, uint64_t>> out;
+        for (auto &p : r) {
+            if (p.second <= lo || hi <= p.first) {
+                out.push_back(p);
+                continue;
+            }
+            if (p.first < lo) out.push_back(std::make_pair(p.first, lo));
+            if (hi < p.second) out.push_back(std::make_pair(hi, p.second));
+        }
+        r.swap(out);
+    }
+};
+
+} // namespace
+
+static bool const_arg(CallInst *CI, unsigned i, uint64_t &out) {
+    ConstantInt *C = dyn_cast<ConstantInt>(CI->getArgOperand(i));
+    if (!C) return false;
+    out = C->getZExtValue();
+    return true;
+}
+
+static ShadRange shad_range(CallInst *CI, unsigned shad, unsigned addr,
+        unsigned size) {
+    ShadRange sr = { CI->getArgOperand(shad), 0, 0, false };
+    uint64_t a, n;
+    if (const_arg(CI, addr, a) && const_arg(CI, size, n)) {
+        sr.lo = a;
+        sr.hi = a + n;
+        sr.known = true;
+    }
+    return sr;
+}
+
+// Copies whose update_cb just rewrites the masks Shad::copy already copied
+// can be merged into bulk copies with no instruction attached.
+static bool cb_neutral(Value *instr) {
+    if (isa<ConstantPointerNull>(instr)) return true;
+    ConstantExpr *CE = dyn_cast<ConstantExpr>(instr);
+    if (!CE || CE->getOpcode() != Instruction::IntToPtr) return false;
+    ConstantInt *CI = dyn_cast<ConstantInt>(CE->getOperand(0));
+    if (!CI) return false;
+    Instruction *I = (Instruction *)CI->getZExtValue();
+    if (!I) return true;
+    if (detaint_cb0_bytes) return false;
+    return isa<LoadInst>(I) || isa<StoreInst>(I);
+}
+
+static bool overlaps(const ShadRange &a, const ShadRange &b) {
+    if (a.shad != b.shad) return false;
+    if (!a.known || !b.known) return true;
+    return a.lo < b.hi && b.lo < a.hi;
+}
+
+Shad *PandaTaintVisitor::shadForConst(Value *V) {
+    if (V == llvConst) return shad->llv;
+    if (V == memConst) return shad->ram;
+    if (V == grvConst) return shad->grv;
+    if (V == gsvConst) return shad->gsv;
+    if (V == retConst) return shad->ret;
+    return nullptr;
+}
+
+bool PandaTaintVisitor::inBounds(const ShadRange &sr) {
+    Shad *s = shadForConst(sr.shad);
+    return s && sr.known && sr.lo <= sr.hi && sr.hi <= s->get_size();
+}
+
+TaintOpEffect PandaTaintVisitor::taintOpEffect(Instruction &I) {
+    TaintOpEffect e;
+    CallInst *CI = dyn_cast<CallInst>(&I);
+    if (!CI) {
+        e.kind = OP_NONE;
+        return e;
+    }
+    Function *F = CI->getCalledFunction();
+    if (!F) return e;
+    if (F == memlogPopF || F == breadcrumbF || F->isIntrinsic()) {
+        e.kind = OP_NONE;
+        return e;
+    }
+
+    e.kind = OP_TAINT;
+    if (F == copyF) {
+        e.write = shad_range(CI, 0, 1, 4);
+        e.reads.push_back(shad_range(CI, 2, 3, 4));
+        e.kills = inBounds(e.write) && inBounds(e.reads[0]);
+    } else if (F == deleteF) {
+        e.write = shad_range(CI, 0, 1, 2);
+        e.kills = inBounds(e.write);
+    } else if (F == mixCompF || F == parallelCompF) {
+        // parallel computes write src_size bytes and ignore dest_size
+        e.write = shad_range(CI, 0, 1, F == mixCompF ? 2 : 5);
+        e.reads.push_back(shad_range(CI, 0, 3, 5));
+        e.reads.push_back(shad_range(CI, 0, 4, 5));
+        e.kills = inBounds(e.write) && inBounds(e.reads[0]) &&
+            inBounds(e.reads[1]);
+    } else if (F == mulCompF) {
+        // writes either dest_size or src_size bytes depending on the operands
+        uint64_t ds, ss;
+        e.write = shad_range(CI, 0, 1, 2);
+        if (e.write.known && const_arg(CI, 5, ss) && const_arg(CI, 2, ds)) {
+            e.write.hi = e.write.lo + std::max(ds, ss);
+        } else {
+            e.write.known = false;
+        }
+        e.reads.push_back(shad_range(CI, 0, 3, 5));
+        e.reads.push_back(shad_range(CI, 0, 4, 5));
+    } else if (F == mixF || F == sextF) {
+        e.write = shad_range(CI, 0, 1, 2);
+        e.reads.push_back(shad_range(CI, 0, 3, 4));
+        e.kills = inBounds(e.write) && inBounds(e.reads[0]);
+    } else if (F == selectF) {
+        // may leave dest alone if a constant is selected
+        e.write = shad_range(CI, 0, 1, 2);
+        e.reads.push_back({ CI->getArgOperand(0), 0, 0, false });
+    } else {
+        e.kind = OP_BARRIER;
+    }
+    return e;
+}
+
+// Try to fold cur into prev, which immediately precedes it.
+bool PandaTaintVisitor::mergeTaintOps(CallInst *prev, CallInst *cur) {
+    Function *F = prev->getCalledFunction();
+    if (F != cur->getCalledFunction()) return false;
+    LLVMContext &ctx = prev->getContext();
+
+    if (F == deleteF) {
+        ShadRange a = shad_range(prev, 0, 1, 2), b = shad_range(cur, 0, 1, 2);
+        if (a.shad != b.shad || !inBounds(a) || !inBounds(b)) return false;
+        if (a.hi < b.lo || b.hi < a.lo) return false;
+        uint64_t lo = std::min(a.lo, b.lo), hi = std::max(a.hi, b.hi);
+        prev->setArgOperand(1, const_uint64(ctx, lo));
+        prev->setArgOperand(2, const_uint64(ctx, hi - lo));
+        return true;
+    }
+
+    if (F == copyF) {
+        if (prev->getArgOperand(0) != cur->getArgOperand(0) ||
+                prev->getArgOperand(2) != cur->getArgOperand(2)) {
+            return false;
+        }
+        ShadRange pd = shad_range(prev, 0, 1, 4), ps = shad_range(prev, 2, 3, 4);
+        ShadRange cd = shad_range(cur, 0, 1, 4), cs = shad_range(cur, 2, 3, 4);
+        if (!inBounds(pd) || !inBounds(ps) || !inBounds(cd) || !inBounds(cs))
+            return false;
+        if (cd.lo != pd.hi || cs.lo != ps.hi) return false;
+        if (!cb_neutral(prev->getArgOperand(5)) ||
+                !cb_neutral(cur->getArgOperand(5))) {
+            return false;
+        }
+        ShadRange d = { pd.shad, pd.lo, cd.hi, true };
+        ShadRange s = { ps.shad, ps.lo, cs.hi, true };
+        if (overlaps(d, s)) return false; // sequential != memmove
+        prev->setArgOperand(4, const_uint64(ctx, d.hi - d.lo));
+        prev->setArgOperand(5, constNull(ctx));
+        return true;
+    }
+
+    // An op that exactly repeats the previous one is redundant as long as it
+    // doesn't read what it writes.
+    if (F == mixCompF || F == parallelCompF || F == mixF || F == sextF) {
+        for (unsigned i = 0; i < prev->getNumArgOperands(); i++) {
+            if (prev->getArgOperand(i) != cur->getArgOperand(i)) return false;
+        }
+        TaintOpEffect e = taintOpEffect(*cur);
+        if (!e.kills) return false;
+        for (auto &r : e.reads) {
+            if (overlaps(e.write, r)) return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void PandaTaintVisitor::optimizeTaintOps(BasicBlock &BB) {
+    if (!optimize_taint_ops || inline_taint || track_taint_state) return;
+    // The limits turn individual writes away, so which writes happen matters.
+    if (max_tcn || max_taintset_card) return;
+
+    // Backward: drop ops whose every destination byte is dead.
+    std::map<Value *, ByteRanges> dead;
+    vector<Instruction *> insts;
+    for (Instruction &I : BB) insts.push_back(&I);
+    for (auto it = insts.rbegin(); it != insts.rend(); ++it) {
+        Instruction *I = *it;
+        TaintOpEffect e = taintOpEffect(*I);
+        if (e.kind == OP_NONE) continue;
+        if (e.kind == OP_BARRIER) {
+            dead.clear();
+            continue;
+        }
+        taintOpsSeen++;
+        if (e.write.known && dead[e.write.shad].covers(e.write.lo, e.write.hi)) {
+            I->eraseFromParent();
+            taintOpsElided++;
+            continue;
+        }
+        if (e.kills) dead[e.write.shad].add(e.write.lo, e.write.hi);
+        for (auto &r : e.reads) {
+            if (r.known) dead[r.shad].remove(r.lo, r.hi);
+            else dead.erase(r.shad);
+        }
+    }
+
+    // Forward: coalesce neighbouring ops.
+    CallInst *prev = nullptr;
+    insts.clear();
+    for (Instruction &I : BB) insts.push_back(&I);
+    for (Instruction *I : insts) {
+        TaintOpEffect e = taintOpEffect(*I);
+        if (e.kind == OP_NONE) continue;
+        if (e.kind == OP_BARRIER) {
+            prev = nullptr;
+            continue;
+        }
+        CallInst *cur = cast<CallInst>(I);
+        if (prev && mergeTaintOps(prev, cur)) {
+            cur->eraseFromParent();
+            taintOpsElided++;
+        } else {
+            prev = cur;
+        }
+    }
+}
+
 // Terminator instructions
 void PandaTaintVisitor::visitReturnInst(ReturnInst &I) {
     Value *ret = I.getReturnValue();
@@ -30,6 +30,7 @@ typedef struct taint2_memlog taint2_memlog;
 typedef struct addr_struct Addr;
 
 struct ShadowState;
+class Shad;
 
 using std::vector;
 using std::pair;
@@ -75,6 +76,23 @@ class BinaryOperator;
 class PHINode;
 class Instruction;
 
+// What a taint op call does to shadow memory, as seen by the taint op
+// optimizer.  Ranges are [lo, hi) byte offsets into the shadow.
+struct ShadRange {
+    Value *shad;
+    uint64_t lo, hi;
+    bool known; // false: may touch any byte of shad
+};
+
+enum TaintOpKind { OP_NONE, OP_TAINT, OP_BARRIER };
+
+struct TaintOpEffect {
+    TaintOpKind kind = OP_BARRIER;
+    ShadRange write = { nullptr, 0, 0, false };
+    bool kills = false; // every byte of write is overwritten
+    vector<ShadRange> reads;
+};
+
 /* PandaTaintVisitor class
  * This class implements our taint propagation policies for each LLVM
  * instruction.  Generally, it emits taint operations into the taint buffer to
@@ -131,6 +149,11 @@ private:
     void insertTaintQueryNonConstPc(Instruction &I, Value *cond);
     void insertStateOp(Instruction &I);
 
+    Shad *shadForConst(Value *V);
+    bool inBounds(const ShadRange &sr);
+    TaintOpEffect taintOpEffect(Instruction &I);
+    bool mergeTaintOps(CallInst *prev, CallInst *cur);
+
 public:
     DataLayout *dataLayout = NULL;
 
@@ -169,6 +192,10 @@ public:
 
     Type *instrT;
 
+    // taint op optimizer counters
+    uint64_t taintOpsSeen = 0;
+    uint64_t taintOpsElided = 0;
+
     PandaTaintVisitor(ShadowState *shad, taint2_memlog *taint_memlog)
         : shad(shad), taint_memlog(taint_memlog) {}
 
@@ -178,6 +205,9 @@ public:
     void visitFunction(Function& F);
     void visitBasicBlock(BasicBlock &BB);
 
+    // Coalesce and elide the taint ops inserted into BB.
+    void optimizeTaintOps(BasicBlock &BB);
+
     void visitInvokeInst(InvokeInst &I);
     void visitUnreachableInst(UnreachableInst &I);
     void visitAllocaInst(AllocaInst &I);
@@ -38,8 +38,6 @@ Shad::Shad(std::string name, uint64_t max_size)
 
 Shad::~Shad() = default;
 
-typedef const std::set<uint32_t> *LabelSetP;
-
 FastShad::FastShad(std::string name, uint64_t labelsets) : Shad(name, labelsets)
 {
     uint64_t bytes = sizeof(TaintData) * labelsets;
@@ -73,6 +71,39 @@ FastShad::~FastShad() {
     }
 }
 
+CompactShad::CompactShad(std::string name, uint64_t labelsets)
+    : Shad(name, labelsets)
+{
+    uint64_t bytes = sizeof(CompactTaintData) * labelsets;
+
+    CompactTaintData *array;
+    if (labelsets < (1UL << 24)) {
+        array = (CompactTaintData *)calloc(labelsets, sizeof(CompactTaintData));
+        printf("taint2: Allocating small compact_shad (%" PRIu64 " bytes) using calloc @ %p.\n",
+                bytes, array);
+        assert(array);
+    } else {
+        printf("taint2: Allocating large compact_shad (%" PRIu64 " bytes).\n", bytes);
+        array = (CompactTaintData *)mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
+        if (array == (CompactTaintData *)MAP_FAILED) {
+            puts(strerror(errno));
+        }
+    }
+
+    labels = array;
+    orig_labels = array;
+}
+
+// release all memory associated with this compact_shad.
+CompactShad::~CompactShad() {
+    if (size < (1UL << 24)) {
+        free(orig_labels);
+    } else {
+        munmap(orig_labels, sizeof(CompactTaintData) * size);
+    }
+}
+
 LazyShad::LazyShad(std::string name, uint64_t max_size) : Shad(name, max_size)
 {
     tassert(this->size > 0);
@@ -82,3 +113,62 @@ LazyShad::LazyShad(std::string name, uint64_t max_size) : Shad(name, max_size)
 LazyShad::~LazyShad()
 {
 }
+
+const TaintData PageShad::blank_page[SHAD_PAGE_ENTRIES];
+
+PageShad::PageShad(std::string name, uint64_t max_size) : Shad(name, max_size)
+{
+    uint64_t num_pages = (max_size + SHAD_PAGE_ENTRIES - 1) >> SHAD_PAGE_BITS;
+    num_tables = (num_pages + SHAD_TABLE_ENTRIES - 1) >> SHAD_TABLE_BITS;
+    tables = (TaintData ***)calloc(num_tables, sizeof(TaintData **));
+    allocated = (uint64_t *)calloc((num_pages + 63) / 64, sizeof(uint64_t));
+    live = (uint16_t *)calloc(num_pages, sizeof(uint16_t));
+    assert(tables && allocated && live);
+    num_pages_allocated = 0;
+    printf("taint2: Allocating page_shad (%" PRIu64 " pages of %lu bytes).\n",
+            num_pages, SHAD_PAGE_ENTRIES * sizeof(TaintData));
+}
+
+// release all memory associated with this page_shad.
+PageShad::~PageShad()
+{
+    printf("taint2: page_shad %s had %" PRIu64 " pages (%" PRIu64
+            " bytes) allocated.\n", name(), num_pages_allocated,
+            num_pages_allocated * SHAD_PAGE_ENTRIES * sizeof(TaintData));
+    for (uint64_t t = 0; t < num_tables; t++) {
+        if (!tables[t]) continue;
+        for (uint64_t p = 0; p < SHAD_TABLE_ENTRIES; p++) {
+            free(tables[t][p]);
+        }
+        free(tables[t]);
+    }
+    free(tables);
+    free(allocated);
+    free(live);
+}
+
+TaintData *PageShad::alloc_page(uint64_t page)
+{
+    TaintData **&table = tables[page >> SHAD_TABLE_BITS];
+    if (!table) {
+        table = (TaintData **)calloc(SHAD_TABLE_ENTRIES, sizeof(TaintData *));
+        assert(table);
+    }
+    TaintData *&result = table[page & SHAD_TABLE_MASK];
+    result = (TaintData *)calloc(SHAD_PAGE_ENTRIES, sizeof(TaintData));
+    assert(result);
+    allocated[page >> 6] |= 1UL << (page & 63);
+    live[page] = 0;
+    num_pages_allocated++;
+    return result;
+}
+
+void PageShad::free_page(uint64_t page)
+{
+    TaintData *&tds = tables[page >> SHAD_TABLE_BITS][page & SHAD_TABLE_MASK];
+    free(tds);
+    tds = NULL;
+    allocated[page >> 6] &= ~(1UL << (page & 63));
+    live[page] = 0;
+    num_pages_allocated--;
+}
@@ -21,6 +21,8 @@ PANDAENDCOMMENT */
 #include <cstring>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #ifdef TAINT2_DEBUG
 #include "qemu/osdep.h"
@@ -123,16 +125,26 @@ struct TaintData {
     }
 };
 
+// Number of TaintData staged on the stack at a time when copying between
+// shadows that can't hand out a pointer to their storage.
+#define SHAD_COPY_CHUNK 64
+
+// Shadow entry used by CompactShad: the label set is stored by id, and the
+// taint compute number lives in a side table (has_tcn says whether to look).
+struct CompactTaintData {
+    uint32_t ls_id;
+    uint8_t cb_mask;
+    uint8_t one_mask;
+    uint8_t zero_mask;
+    uint8_t has_tcn;
+};
+
 class Shad
 {
   protected:
     uint64_t size; // Number of labelsets contained.
     std::string _name;
 
-    // Determines if any of the memory locations in the range [addr ..
-    // addr+size-1] are tainted.
-    virtual bool range_tainted(uint64_t addr, uint64_t size) = 0;
-
   public:
     Shad(std::string name, uint64_t max_size);
 
@@ -152,6 +164,42 @@ class Shad
 
     virtual void label(uint64_t addr, LabelSetP ls) = 0;
 
+    // Determines if any of the memory locations in the range [addr ..
+    // addr+size-1] are tainted.
+    virtual bool range_tainted(uint64_t addr, uint64_t size) = 0;
+
+    // Reads the TaintData for the range [addr .. addr+size-1] into tds.
+    virtual void get_range(uint64_t addr, uint64_t size, TaintData *tds) = 0;
+
+    // Stores tds on the range [addr .. addr+size-1] without reporting a taint
+    // change.  The same caveats as for set_full_quiet apply.
+    virtual void set_range_quiet(uint64_t addr, uint64_t size,
+                                 const TaintData *tds) = 0;
+
+    // Returns a pointer to the TaintData for [addr .. addr+size-1] if this
+    // shadow stores the range contiguously, NULL otherwise.  Lets copies
+    // skip staging the data through a temporary buffer.
+    virtual const TaintData *range_ptr(uint64_t addr, uint64_t size)
+    {
+        return NULL;
+    }
+
+    // Same as range_ptr, for shadows made of CompactTaintData.
+    virtual const CompactTaintData *compact_range_ptr(uint64_t addr,
+                                                      uint64_t size)
+    {
+        return NULL;
+    }
+
+    // Copies [src .. src+size-1] of shad_src onto [dest .. dest+size-1] of
+    // this shadow quietly, if this shadow knows a faster way to do so than
+    // going through TaintData.  Returns false if it doesn't.
+    virtual bool copy_range_from(uint64_t dest, Shad *shad_src, uint64_t src,
+                                 uint64_t size)
+    {
+        return false;
+    }
+
     static void copy(Shad *shad_dest, uint64_t dest, Shad *shad_src,
                      uint64_t src, uint64_t size)
     {
@@ -165,12 +213,18 @@ class Shad
                     shad_src->range_tainted(src, size)))
             change = true;
 
-        for (uint64_t i = 0; i < size; i++) {
-            auto td = shad_src->query_full(src + i);
-
-            // don't report taint changes when store the taint data, as it is
-            // already taken care of for all bytes below
-            shad_dest->set_full_quiet(dest + i, td);
+        // don't report taint changes when storing the taint data, as it is
+        // already taken care of for all bytes below
+        const TaintData *src_tds = shad_src->range_ptr(src, size);
+        if (src_tds) {
+            shad_dest->set_range_quiet(dest, size, src_tds);
+        } else if (!shad_dest->copy_range_from(dest, shad_src, src, size)) {
+            TaintData buf[SHAD_COPY_CHUNK];
+            for (uint64_t i = 0; i < size; i += SHAD_COPY_CHUNK) {
+                uint64_t n = std::min<uint64_t>(SHAD_COPY_CHUNK, size - i);
+                shad_src->get_range(src + i, n, buf);
+                shad_dest->set_range_quiet(dest + i, n, buf);
+            }
         }
 
         if (change) taint_state_changed(shad_dest, dest, size);
@@ -193,6 +247,13 @@ class Shad
 
     virtual void pop_frame(uint64_t framesize) = 0;
 
+    // Offset of the current frame from the start of the shadow, so that
+    // frame relative addresses can be made absolute.
+    virtual uint64_t frame_base()
+    {
+        return 0;
+    }
+
     virtual TaintData query_full(uint64_t addr) = 0;
 
     virtual void set_full(uint64_t addr, TaintData td) = 0;
@@ -224,20 +285,52 @@ class FastShad : public Shad
         return &labels[guest_addr];
     }
 
-  protected:
-    bool range_tainted(uint64_t addr, uint64_t size) override
+    TaintData *get_range_p(uint64_t guest_addr, uint64_t range_size)
     {
-        for (unsigned i = addr; i < addr + size; i++) {
-            if (get_td_p(i)->ls)
-                return true;
+        tassert(guest_addr + range_size >= guest_addr);
+        tassert(guest_addr + range_size <= size);
+        if (guest_addr + range_size > size) {
+          fprintf(stderr, "PANDA[taint2]: Fatal error- taint query on invalid range 0x%lx+0x%lx\n", guest_addr, range_size);
+          return NULL;
         }
-        return false;
+        return &labels[guest_addr];
     }
 
   public:
     FastShad(std::string name, uint64_t size);
     ~FastShad();
 
+    bool range_tainted(uint64_t addr, uint64_t range_size) override
+    {
+        // Or all the label set pointers together rather than branching on
+        // each one; the compiler turns this into a vector loop.
+        const TaintData *tds = get_range_p(addr, range_size);
+        uintptr_t any = 0;
+        for (uint64_t i = 0; i < range_size; i++) {
+            any |= (uintptr_t)tds[i].ls;
+        }
+        return any != 0;
+    }
+
+    void get_range(uint64_t addr, uint64_t range_size, TaintData *tds) override
+    {
+        memcpy(tds, get_range_p(addr, range_size),
+               range_size * sizeof(TaintData));
+    }
+
+    void set_range_quiet(uint64_t addr, uint64_t range_size,
+                         const TaintData *tds) override
+    {
+        // source may be this very shadow, so the ranges can overlap
+        memmove(get_range_p(addr, range_size), tds,
+                range_size * sizeof(TaintData));
+    }
+
+    const TaintData *range_ptr(uint64_t addr, uint64_t range_size) override
+    {
+        return get_range_p(addr, range_size);
+    }
+
     // Taint an address with a labelset.
     void label(uint64_t addr, LabelSetP ls) override
     {
@@ -254,7 +347,8 @@ class FastShad : public Shad
         bool change = false;
         if (track_taint_state && range_tainted(addr, remove_size))
             change = true;
-        memset(get_td_p(addr), 0, remove_size * sizeof(TaintData));
+        memset(get_range_p(addr, remove_size), 0,
+               remove_size * sizeof(TaintData));
 
         if (change)
             taint_state_changed(this, addr, remove_size);
@@ -262,10 +356,8 @@ class FastShad : public Shad
 
     void remove_quiet(uint64_t addr, uint64_t remove_size) override
     {
-        tassert(addr + remove_size >= addr);
-        tassert(addr + remove_size <= size);
-
-        memset(get_td_p(addr), 0, remove_size * sizeof(TaintData));
+        memset(get_range_p(addr, remove_size), 0,
+               remove_size * sizeof(TaintData));
     }
 
     LabelSetP query(uint64_t addr) override
@@ -293,6 +385,11 @@ class FastShad : public Shad
         taint_log("pop: %lx\n", (uint64_t)labels);
     }
 
+    uint64_t frame_base() override
+    {
+        return labels - orig_labels;
+    }
+
     TaintData query_full(uint64_t addr) override
     {
         tassert(addr < size);
@@ -338,26 +435,286 @@ class FastShad : public Shad
     }
 };
 
+// A fast shadow memory with 8 byte entries instead of 16 byte TaintData -
+// allocates memory on creation, like FastShad.  Taint compute numbers, which
+// are rarely non-zero and rarely looked at, are kept in a side table keyed
+// by the entry's position in the array.
+class CompactShad : public Shad
+{
+  private:
+    CompactTaintData *labels;
+    CompactTaintData *orig_labels;
+    std::unordered_map<uint64_t, uint32_t> tcns;
+
+    CompactTaintData *get_range_p(uint64_t guest_addr, uint64_t range_size)
+    {
+        tassert(guest_addr + range_size >= guest_addr);
+        tassert(guest_addr + range_size <= size);
+        if (guest_addr + range_size > size) {
+          fprintf(stderr, "PANDA[taint2]: Fatal error- taint query on invalid range 0x%lx+0x%lx\n", guest_addr, range_size);
+          return NULL;
+        }
+        return &labels[guest_addr];
+    }
+
+    // Key into tcns - independent of the current frame.
+    uint64_t tcn_key(uint64_t addr)
+    {
+        return (labels - orig_labels) + addr;
+    }
+
+    TaintData expand(uint64_t addr, const CompactTaintData &ctd)
+    {
+        TaintData td;
+        td.ls = label_set_from_id(ctd.ls_id);
+        td.tcn = ctd.has_tcn ? tcns[tcn_key(addr)] : 0;
+        td.cb_mask = ctd.cb_mask;
+        td.one_mask = ctd.one_mask;
+        td.zero_mask = ctd.zero_mask;
+        return td;
+    }
+
+    void store(uint64_t addr, const TaintData &td)
+    {
+        CompactTaintData &ctd = labels[addr];
+        if (td.tcn) {
+            tcns[tcn_key(addr)] = td.tcn;
+        } else if (ctd.has_tcn) {
+            tcns.erase(tcn_key(addr));
+        }
+        ctd.ls_id = label_set_id(td.ls);
+        ctd.cb_mask = td.cb_mask;
+        ctd.one_mask = td.one_mask;
+        ctd.zero_mask = td.zero_mask;
+        ctd.has_tcn = td.tcn != 0;
+    }
+
+    // Forget the side table entries for a range about to be overwritten.
+    void drop_tcns(uint64_t addr, uint64_t range_size)
+    {
+        if (tcns.empty()) return;
+        const CompactTaintData *ctds = get_range_p(addr, range_size);
+        for (uint64_t i = 0; i < range_size; i++) {
+            if (ctds[i].has_tcn) tcns.erase(tcn_key(addr + i));
+        }
+    }
+
+    void clear_range(uint64_t addr, uint64_t range_size)
+    {
+        drop_tcns(addr, range_size);
+        memset(get_range_p(addr, range_size), 0,
+               range_size * sizeof(CompactTaintData));
+    }
+
+  public:
+    CompactShad(std::string name, uint64_t size);
+    ~CompactShad();
+
+    bool range_tainted(uint64_t addr, uint64_t range_size) override
+    {
+        const CompactTaintData *ctds = get_range_p(addr, range_size);
+        uint32_t any = 0;
+        for (uint64_t i = 0; i < range_size; i++) {
+            any |= ctds[i].ls_id;
+        }
+        return any != 0;
+    }
+
+    void get_range(uint64_t addr, uint64_t range_size, TaintData *tds) override
+    {
+        const CompactTaintData *ctds = get_range_p(addr, range_size);
+        for (uint64_t i = 0; i < range_size; i++) {
+            tds[i] = expand(addr + i, ctds[i]);
+        }
+    }
+
+    void set_range_quiet(uint64_t addr, uint64_t range_size,
+                         const TaintData *tds) override
+    {
+        get_range_p(addr, range_size);
+        for (uint64_t i = 0; i < range_size; i++) {
+            store(addr + i, tds[i]);
+        }
+    }
+
+    const CompactTaintData *compact_range_ptr(uint64_t addr,
+                                              uint64_t range_size) override
+    {
+        return get_range_p(addr, range_size);
+    }
+
+    bool copy_range_from(uint64_t dest, Shad *shad_src, uint64_t src,
+                         uint64_t range_size) override
+    {
+        const CompactTaintData *src_ctds =
+            shad_src->compact_range_ptr(src, range_size);
+        if (!src_ctds) return false;
+
+        // Collect the source's tcns before anything gets overwritten, as the
+        // source may be this very shadow.  This is almost always empty.
+        std::vector<std::pair<uint64_t, uint32_t>> src_tcns;
+        for (uint64_t i = 0; i < range_size; i++) {
+            if (src_ctds[i].has_tcn) {
+                src_tcns.push_back(std::make_pair(i, shad_src->query_tcn(src + i)));
+            }
+        }
+
+        drop_tcns(dest, range_size);
+        memmove(get_range_p(dest, range_size), src_ctds,
+                range_size * sizeof(CompactTaintData));
+        for (auto &it : src_tcns) {
+            tcns[tcn_key(dest + it.first)] = it.second;
+        }
+        return true;
+    }
+
+    // Taint an address with a labelset.
+    void label(uint64_t addr, LabelSetP ls) override
+    {
+        taint_log("LABEL: %s[%lx] (%p)\n", name(), addr, ls);
+        get_range_p(addr, 1);
+        store(addr, TaintData(ls));
+    }
+
+    // Remove taint.
+    void remove(uint64_t addr, uint64_t remove_size) override
+    {
+        bool change = false;
+        if (track_taint_state && range_tainted(addr, remove_size))
+            change = true;
+        clear_range(addr, remove_size);
+
+        if (change)
+            taint_state_changed(this, addr, remove_size);
+    }
+
+    void remove_quiet(uint64_t addr, uint64_t remove_size) override
+    {
+        clear_range(addr, remove_size);
+    }
+
+    LabelSetP query(uint64_t addr) override
+    {
+        return label_set_from_id(get_range_p(addr, 1)->ls_id);
+    }
+
+    void reset_frame() override
+    {
+        labels = orig_labels;
+        taint_log("reset: %lx\n", (uint64_t)labels);
+    }
+
+    void push_frame(uint64_t framesize) override
+    {
+        labels += framesize;
+        tassert(labels < orig_labels + size);
+        taint_log("push: %lx\n", (uint64_t)labels);
+    }
+
+    void pop_frame(uint64_t framesize) override
+    {
+        labels -= framesize;
+        tassert(labels >= orig_labels);
+        taint_log("pop: %lx\n", (uint64_t)labels);
+    }
+
+    uint64_t frame_base() override
+    {
+        return labels - orig_labels;
+    }
+
+    TaintData query_full(uint64_t addr) override
+    {
+        tassert(addr < size);
+        return expand(addr, labels[addr]);
+    }
+
+    void set_full(uint64_t addr, TaintData td) override
+    {
+        tassert(addr < size);
+
+        uint32_t newcard = 0;
+        if (td.ls != NULL) newcard = td.ls->size();
+        if (((max_tcn == 0) || (td.tcn <= max_tcn)) &&
+            ((max_taintset_card == 0) || (newcard <= max_taintset_card)))
+        {
+            bool change = !(td == query_full(addr));
+            store(addr, td);
+
+            if (change) taint_state_changed(this, addr, 1);
+        }
+        else
+        {
+            // delete taint, if there is any, as things have gone too far
+            if (range_tainted(addr, 1))
+            {
+                // remove will take care of taint_state_changed, unless they
+                // don't care to be informed of removals
+                remove(addr, 1);
+            }
+        }
+    }
+
+    // Set taint quietly - ie. no taint change report is made.
+    void set_full_quiet(uint64_t addr, TaintData td) override
+    {
+        tassert(addr < size);
+        store(addr, td);
+    }
+
+    uint32_t query_tcn(uint64_t addr) override
+    {
+        tassert(addr < size);
+        return labels[addr].has_tcn ? tcns[tcn_key(addr)] : 0;
+    }
+};
+
 class LazyShad : public Shad
 {
   private:
     std::map<uint64_t, TaintData> labels;
 
-  protected:
-    bool range_tainted(uint64_t addr, uint64_t size) override
+  public:
+    LazyShad(std::string name, uint64_t size);
+    ~LazyShad();
+
+    bool range_tainted(uint64_t addr, uint64_t range_size) override
     {
-        for (uint64_t cur = addr; cur < addr + size; cur++) {
-            auto it = labels.find(cur);
-            if (it != labels.end() && it->second.ls) {
+        auto end = labels.lower_bound(addr + range_size);
+        for (auto it = labels.lower_bound(addr); it != end; ++it) {
+            if (it->second.ls) {
                 return true;
             }
         }
         return false;
     }
 
-  public:
-    LazyShad(std::string name, uint64_t size);
-    ~LazyShad();
+    void get_range(uint64_t addr, uint64_t range_size, TaintData *tds) override
+    {
+        std::fill(tds, tds + range_size, TaintData());
+        auto end = labels.lower_bound(addr + range_size);
+        for (auto it = labels.lower_bound(addr); it != end; ++it) {
+            tds[it->first - addr] = it->second;
+        }
+    }
+
+    void set_range_quiet(uint64_t addr, uint64_t range_size,
+                         const TaintData *tds) override
+    {
+        // Drop the whole range, then put back everything that isn't blank,
+        // using the previous insertion point as a hint.  tds never points
+        // into the map itself (copies out of a LazyShad are staged), so this
+        // is safe even when copying within the same shadow.
+        auto hint = labels.erase(labels.lower_bound(addr),
+                                 labels.lower_bound(addr + range_size));
+        const TaintData blank;
+        for (uint64_t i = 0; i < range_size; i++) {
+            if (!(tds[i] == blank)) {
+                hint = labels.emplace_hint(hint, addr + i, tds[i]);
+                ++hint;
+            }
+        }
+    }
 
     void label(uint64_t addr, LabelSetP ls) override
     {
@@ -375,9 +732,8 @@ class LazyShad : public Shad
         if (track_taint_state && range_tainted(addr, remove_size)) {
             change = true;
         }
-        for (uint64_t cur = addr; cur < addr + remove_size; cur++) {
-             labels.erase(cur);
-        }
+        labels.erase(labels.lower_bound(addr),
+                     labels.lower_bound(addr + remove_size));
 
         if (change) {
             taint_state_changed(this, addr, remove_size);
@@ -386,9 +742,8 @@ class LazyShad : public Shad
 
     void remove_quiet(uint64_t addr, uint64_t remove_size) override
     {
-        for (uint64_t cur = addr; cur < (addr + remove_size); cur++) {
-             labels.erase(cur);
-        }
+        labels.erase(labels.lower_bound(addr),
+                     labels.lower_bound(addr + remove_size));
     }
 
     LabelSetP query(uint64_t addr) override
@@ -402,7 +757,11 @@ class LazyShad : public Shad
 
     TaintData query_full(uint64_t addr) override
     {
-        return labels[addr];
+        auto result = labels.find(addr);
+        if (result == labels.end()) {
+            return TaintData();
+        }
+        return result->second;
     }
 
     void set_full(uint64_t addr, TaintData td) override
@@ -453,4 +812,251 @@ class LazyShad : public Shad
     }
 };
 
+// Sizes for PageShad: each page holds the TaintData for 2^SHAD_PAGE_BITS
+// addresses, and each second level table points to 2^SHAD_TABLE_BITS pages.
+#define SHAD_PAGE_BITS 12
+#define SHAD_PAGE_ENTRIES (1UL << SHAD_PAGE_BITS)
+#define SHAD_PAGE_MASK (SHAD_PAGE_ENTRIES - 1)
+#define SHAD_TABLE_BITS 10
+#define SHAD_TABLE_ENTRIES (1UL << SHAD_TABLE_BITS)
+#define SHAD_TABLE_MASK (SHAD_TABLE_ENTRIES - 1)
+
+// A sparse shadow memory - a two level page table of TaintData pages that are
+// only allocated while something other than blank TaintData is stored in them.
+// A bitmap with one bit per page records which pages are allocated, so reads
+// and blank writes on clean pages (the vast majority for guest RAM) cost a
+// single bit test. Each allocated page keeps a count of its non-blank entries
+// and is freed once that drops to zero.
+class PageShad : public Shad
+{
+  private:
+    TaintData ***tables;
+    uint64_t num_tables;
+    uint64_t *allocated;
+    uint16_t *live;
+    uint64_t num_pages_allocated;
+
+    // What clean pages read as.
+    static const TaintData blank_page[SHAD_PAGE_ENTRIES];
+
+    bool page_allocated(uint64_t page)
+    {
+        return (allocated[page >> 6] >> (page & 63)) & 1;
+    }
+
+    // Returns the page, or NULL if it holds nothing.
+    TaintData *find_page(uint64_t page)
+    {
+        if (!page_allocated(page)) return NULL;
+        return tables[page >> SHAD_TABLE_BITS][page & SHAD_TABLE_MASK];
+    }
+
+    TaintData *alloc_page(uint64_t page);
+    void free_page(uint64_t page);
+
+    static uint64_t count_live(const TaintData *tds, uint64_t n)
+    {
+        const TaintData blank;
+        uint64_t count = 0;
+        for (uint64_t i = 0; i < n; i++) {
+            count += !(tds[i] == blank);
+        }
+        return count;
+    }
+
+    // Frees the pages of [addr .. addr+len-1] that no longer hold anything.
+    // Done after a write rather than during it, as the data being written
+    // may live on one of the pages.
+    void free_blank_pages(uint64_t addr, uint64_t len)
+    {
+        for_each_page(addr, len,
+                [&](uint64_t page, uint64_t off, uint64_t n, uint64_t i) {
+            if (page_allocated(page) && live[page] == 0) free_page(page);
+        });
+    }
+
+    // Calls fn(page, offset, n, i) for each piece of [addr .. addr+len-1]
+    // that falls on a single page, where i is the offset of the piece from
+    // addr.
+    template <typename F>
+    static void for_each_page(uint64_t addr, uint64_t len, F fn)
+    {
+        uint64_t i = 0;
+        while (i < len) {
+            uint64_t cur = addr + i;
+            uint64_t off = cur & SHAD_PAGE_MASK;
+            uint64_t n = std::min(SHAD_PAGE_ENTRIES - off, len - i);
+            fn(cur >> SHAD_PAGE_BITS, off, n, i);
+            i += n;
+        }
+    }
+
+  public:
+    PageShad(std::string name, uint64_t size);
+    ~PageShad();
+
+    bool range_tainted(uint64_t addr, uint64_t range_size) override
+    {
+        tassert(addr + range_size <= size);
+        bool tainted = false;
+        for_each_page(addr, range_size,
+                [&](uint64_t page, uint64_t off, uint64_t n, uint64_t i) {
+            if (tainted) return;
+            TaintData *tds = find_page(page);
+            if (!tds) return;
+            uintptr_t any = 0;
+            for (uint64_t j = off; j < off + n; j++) {
+                any |= (uintptr_t)tds[j].ls;
+            }
+            tainted = any != 0;
+        });
+        return tainted;
+    }
+
+    void get_range(uint64_t addr, uint64_t range_size, TaintData *tds) override
+    {
+        tassert(addr + range_size <= size);
+        for_each_page(addr, range_size,
+                [&](uint64_t page, uint64_t off, uint64_t n, uint64_t i) {
+            TaintData *page_tds = find_page(page);
+            if (page_tds) {
+                memcpy(tds + i, page_tds + off, n * sizeof(TaintData));
+            } else {
+                std::fill(tds + i, tds + i + n, TaintData());
+            }
+        });
+    }
+
+    void set_range_quiet(uint64_t addr, uint64_t range_size,
+                         const TaintData *tds) override
+    {
+        tassert(addr + range_size <= size);
+        bool emptied = false;
+        for_each_page(addr, range_size,
+                [&](uint64_t page, uint64_t off, uint64_t n, uint64_t i) {
+            uint64_t added = count_live(tds + i, n);
+            TaintData *page_tds = find_page(page);
+            if (!page_tds) {
+                // don't allocate just to store nothing
+                if (added == 0) return;
+                page_tds = alloc_page(page);
+            }
+            live[page] -= count_live(page_tds + off, n);
+            memmove(page_tds + off, tds + i, n * sizeof(TaintData));
+            live[page] += added;
+            emptied |= live[page] == 0;
+        });
+        if (emptied) free_blank_pages(addr, range_size);
+    }
+
+    const TaintData *range_ptr(uint64_t addr, uint64_t range_size) override
+    {
+        if ((addr & SHAD_PAGE_MASK) + range_size > SHAD_PAGE_ENTRIES) {
+            return NULL;
+        }
+        TaintData *page_tds = find_page(addr >> SHAD_PAGE_BITS);
+        return (page_tds ? page_tds : blank_page) + (addr & SHAD_PAGE_MASK);
+    }
+
+    void label(uint64_t addr, LabelSetP ls) override
+    {
+        taint_log("LABEL: %s[%lx] (%p)\n", name(), addr, ls);
+        tassert(addr < size);
+        TaintData td(ls);
+        set_range_quiet(addr, 1, &td);
+    }
+
+    void remove(uint64_t addr, uint64_t remove_size) override
+    {
+        bool change = false;
+        if (track_taint_state && range_tainted(addr, remove_size)) {
+            change = true;
+        }
+
+        remove_quiet(addr, remove_size);
+
+        if (change) {
+            taint_state_changed(this, addr, remove_size);
+        }
+    }
+
+    void remove_quiet(uint64_t addr, uint64_t remove_size) override
+    {
+        tassert(addr + remove_size <= size);
+        for_each_page(addr, remove_size,
+                [&](uint64_t page, uint64_t off, uint64_t n, uint64_t i) {
+            TaintData *page_tds = find_page(page);
+            if (!page_tds) return;
+            live[page] -= count_live(page_tds + off, n);
+            if (live[page] == 0) {
+                free_page(page);
+            } else {
+                std::fill(page_tds + off, page_tds + off + n, TaintData());
+            }
+        });
+    }
+
+    LabelSetP query(uint64_t addr) override
+    {
+        tassert(addr < size);
+        TaintData *page_tds = find_page(addr >> SHAD_PAGE_BITS);
+        return page_tds ? page_tds[addr & SHAD_PAGE_MASK].ls : NULL;
+    }
+
+    TaintData query_full(uint64_t addr) override
+    {
+        tassert(addr < size);
+        TaintData *page_tds = find_page(addr >> SHAD_PAGE_BITS);
+        return page_tds ? page_tds[addr & SHAD_PAGE_MASK] : TaintData();
+    }
+
+    void set_full(uint64_t addr, TaintData td) override
+    {
+        uint32_t newcard = 0;
+        if (td.ls != NULL) newcard = td.ls->size();
+        if (((max_tcn == 0) || (td.tcn <= max_tcn)) &&
+            ((max_taintset_card == 0) || (newcard <= max_taintset_card)))
+        {
+            bool change = !(td == query_full(addr));
+            if (change) {
+                set_full_quiet(addr, td);
+                taint_state_changed(this, addr, 1);
+            }
+        }
+        else
+        {
+            // delete taint, if there is any, as things have gone too far
+            if (range_tainted(addr, 1))
+            {
+                // remove will take care of taint_state_changed, unless they
+                // don't care to be informed of removals
+                remove(addr, 1);
+            }
+        }
+    }
+
+    // Set taint quietly - ie. no taint change report is made
+    void set_full_quiet(uint64_t addr, TaintData td) override
+    {
+        set_range_quiet(addr, 1, &td);
+    }
+
+    uint32_t query_tcn(uint64_t addr) override
+    {
+        return (query_full(addr)).tcn;
+    }
+
+    void reset_frame() override
+    {
+    }
+
+    void push_frame(uint64_t framesize) override
+    {
+    }
+
+    void pop_frame(uint64_t framesize) override
+    {
+    }
+};
+
 #endif
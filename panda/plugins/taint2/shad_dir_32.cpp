@@ -49,8 +49,6 @@ PANDAENDCOMMENT */
 
 #include "shad_dir_32.h"
 
-typedef const std::set<uint32_t> *LabelSetP;
-
 // create a new table
 static SdTable *__shad_dir_table_new_32(SdDir32 *shad_dir) {
   SdTable *table = (SdTable *) calloc(1, sizeof(SdTable));
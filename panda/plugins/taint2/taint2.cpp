@@ -56,6 +56,7 @@
 #include "label_set.h"
 #include "taint_api.h"
 #include "taint2_hypercalls.h"
+#include "taint_trace.h"
 
 #define CPU_OFF(member) (uint64_t)(&((CPUArchState *)0)->member)
 
@@ -67,6 +68,7 @@ bool init_plugin(void *);
 void uninit_plugin(void *);
 int after_block_translate(CPUState *cpu, TranslationBlock *tb);
 bool before_block_exec_invalidate_opt(CPUState *cpu, TranslationBlock *tb);
+void before_block_exec_bypass(CPUState *cpu, TranslationBlock *tb);
 
 // for i386 condition code adjustments
 #if defined(TARGET_I386)
@@ -141,8 +143,21 @@ static taint2_memlog taint_memlog;
 bool tainted_pointer = true;
 bool optimize_llvm = true;
 extern bool inline_taint;
+extern bool optimize_taint_ops;
 bool debug_taint = false;
 bool detaint_cb0_bytes = false;
+RamShadType ram_shad_type = RAM_SHAD_FAST;
+bool compact_shad = false;
+bool llvm_bypass = false;
+uint32_t bypass_check = 100000;
+
+// Untainted-block bypass state.  While guest_taint_free holds, nothing in
+// the guest register, CPU state or RAM shadows is tainted, so a block can't
+// produce taint and its plain TCG translation is run instead.
+static bool guest_taint_free = true;
+static uint64_t bypass_blocks_since_scan = 0;
+static uint64_t bypass_fast_blocks = 0;
+static uint64_t bypass_slow_blocks = 0;
 
 /*
  * These memory callbacks are only for whole-system mode.  User-mode memory
@@ -158,6 +173,22 @@ void phys_mem_read_callback(CPUState *cpu, target_ptr_t pc, target_ulong addr, s
     return;
 }
 
+// Taint may have reached guest registers or RAM: run instrumented blocks
+// until a scan shows it is gone again.
+void taint_bypass_off(void) {
+    guest_taint_free = false;
+}
+
+// Transfers from the disk and IO shadows bring taint into RAM behind the
+// bypass' back.
+static void bypass_check_transfer(Shad *dst_shad, Shad *src_shad,
+                                  uint64_t src_addr, size_t num_bytes) {
+    if (llvm_bypass && guest_taint_free && dst_shad == shadow->ram &&
+            src_shad->range_tainted(src_addr, num_bytes)) {
+        taint_bypass_off();
+    }
+}
+
 void replay_hd_transfer_callback(CPUState *cpu, uint32_t type,
                                  target_ptr_t src_addr, target_ptr_t dst_addr,
                                  size_t num_bytes) {
@@ -178,10 +209,10 @@ void replay_hd_transfer_callback(CPUState *cpu, uint32_t type,
         break;
     case HD_TRANSFER_HD_TO_RAM:
         src_shad = &shadow->hd;
-        dst_shad = &shadow->ram;
+        dst_shad = shadow->ram;
         break;
     case HD_TRANSFER_RAM_TO_HD:
-        src_shad = &shadow->ram;
+        src_shad = shadow->ram;
         dst_shad = &shadow->hd;
         break;
     default:
@@ -189,6 +220,8 @@ void replay_hd_transfer_callback(CPUState *cpu, uint32_t type,
         return;
     }
 
+    bypass_check_transfer(dst_shad, src_shad, src_addr, num_bytes);
+    TAINT_TRACE(TT_COPY, dst_shad, dst_addr, num_bytes, src_shad, src_addr, num_bytes);
     Shad::copy(dst_shad, dst_addr, src_shad, src_addr, num_bytes);
 
     return;
@@ -207,12 +240,12 @@ void on_replay_net_transfer(CPUState *cpu, uint32_t type, uint64_t src_addr,
     switch (type)
     {
     case NET_TRANSFER_RAM_TO_IOB:
-        src_shad = &shadow->ram;
+        src_shad = shadow->ram;
         dst_shad = &shadow->io;
         break;
     case NET_TRANSFER_IOB_TO_RAM:
         src_shad = &shadow->io;
-        dst_shad = &shadow->ram;
+        dst_shad = shadow->ram;
         break;
     case NET_TRANSFER_IOB_TO_IOB:
         src_shad = &shadow->io;
@@ -222,6 +255,8 @@ void on_replay_net_transfer(CPUState *cpu, uint32_t type, uint64_t src_addr,
         fprintf(stderr, "Invalid network transfer type (%d)\n", type);
         return;
     }
+    bypass_check_transfer(dst_shad, src_shad, src_addr, num_bytes);
+    TAINT_TRACE(TT_COPY, dst_shad, dst_addr, num_bytes, src_shad, src_addr, num_bytes);
     Shad::copy(dst_shad, dst_addr, src_shad, src_addr, num_bytes);
     return;
 } // end of function on_replay_net_transfer
@@ -246,16 +281,18 @@ void on_replay_before_dma(CPUState *cpu, const uint8_t *src_addr,
     if (is_write) {
         // write to guest RAM
         src_shad = &shadow->io;
-        dst_shad = &shadow->ram;
+        dst_shad = shadow->ram;
         ss_addr = (uint64_t)src_addr;
         ds_addr = dest_addr;
     } else {
         // write to QEMU IO buffer
-        src_shad = &shadow->ram;
+        src_shad = shadow->ram;
         dst_shad = &shadow->io;
         ss_addr = dest_addr;
         ds_addr = (uint64_t)src_addr;
     }
+    bypass_check_transfer(dst_shad, src_shad, ss_addr, num_bytes);
+    TAINT_TRACE(TT_COPY, dst_shad, ds_addr, num_bytes, src_shad, ss_addr, num_bytes);
     Shad::copy(dst_shad, ds_addr, src_shad, ss_addr, num_bytes);
     return;
 }  // end of function on_replay_before_dma
@@ -296,7 +333,14 @@ void taint2_enable_taint(void) {
     panda_enable_llvm_helpers();
 
     if (shadow) delete shadow;
-    shadow = new ShadowState();
+    shadow = new ShadowState(ram_shad_type, compact_shad);
+
+    if (llvm_bypass) {
+        guest_taint_free = true;
+        pcb.before_block_exec = before_block_exec_bypass;
+        panda_register_callback(taint2_plugin, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
+        panda_enable_llvm_bypass();
+    }
 
     // Initialize memlog.
     memset(&taint_memlog, 0, sizeof(taint_memlog));
@@ -371,22 +415,33 @@ void i386_after_cpu_exec_enter(CPUState *cpu) {
     if (taintEnabled) {
         if (savedTaint) {
             for (uint32_t i = 0; i < sizeof(target_ulong); i++) {
-                shadow->gsv.set_full_quiet(dstOff + i, ccDstTaint[i]);
-                shadow->gsv.set_full_quiet(srcOff + i, ccSrcTaint[i]);
-                shadow->gsv.set_full_quiet(src2Off + i, ccSrc2Taint[i]);
+                shadow->gsv->set_full_quiet(dstOff + i, ccDstTaint[i]);
+                shadow->gsv->set_full_quiet(srcOff + i, ccSrcTaint[i]);
+                shadow->gsv->set_full_quiet(src2Off + i, ccSrc2Taint[i]);
             }
             for (uint32_t i = 0; i < sizeof(uint32_t); i++) {
-                shadow->gsv.set_full_quiet(opOff + i, ccOpTaint[i]);
+                shadow->gsv->set_full_quiet(opOff + i, ccOpTaint[i]);
+            }
+            if (unlikely(taint_trace_on)) {
+                // the saved copies live at their gsv offsets in TT_SHAD_SAVED
+                taint_trace_save(shadow->gsv, dstOff, sizeof(target_ulong), dstOff, true);
+                taint_trace_save(shadow->gsv, srcOff, sizeof(target_ulong), srcOff, true);
+                taint_trace_save(shadow->gsv, src2Off, sizeof(target_ulong), src2Off, true);
+                taint_trace_save(shadow->gsv, opOff, sizeof(uint32_t), opOff, true);
             }
             savedTaint = false;
         }
         else {
             // if taint enabled since saved info, wipe out any taint that
             // may have appeared on the data since the save
-            shadow->gsv.remove_quiet(dstOff, sizeof(target_ulong));
-            shadow->gsv.remove_quiet(srcOff, sizeof(target_ulong));
-            shadow->gsv.remove_quiet(src2Off, sizeof(target_ulong));
-            shadow->gsv.remove_quiet(opOff, sizeof(uint32_t));
+            shadow->gsv->remove_quiet(dstOff, sizeof(target_ulong));
+            shadow->gsv->remove_quiet(srcOff, sizeof(target_ulong));
+            shadow->gsv->remove_quiet(src2Off, sizeof(target_ulong));
+            shadow->gsv->remove_quiet(opOff, sizeof(uint32_t));
+            TAINT_TRACE(TT_DELETE, shadow->gsv, dstOff, sizeof(target_ulong), nullptr, 0, 0);
+            TAINT_TRACE(TT_DELETE, shadow->gsv, srcOff, sizeof(target_ulong), nullptr, 0, 0);
+            TAINT_TRACE(TT_DELETE, shadow->gsv, src2Off, sizeof(target_ulong), nullptr, 0, 0);
+            TAINT_TRACE(TT_DELETE, shadow->gsv, opOff, sizeof(uint32_t), nullptr, 0, 0);
         }
     }
     // if taint was disabled since saved the taint, I think we're just hosed
@@ -416,12 +471,18 @@ void i386_before_cpu_exec_exit(CPUState *cpu, bool ranBlock) {
             // the offset into CPUX86State of each item of interest is used as
             // the address of the item's taint in the shadow
             for (uint32_t i = 0; i < sizeof(target_ulong); i++) {
-                ccDstTaint[i] = shadow->gsv.query_full(dstOff + i);
-                ccSrcTaint[i] = shadow->gsv.query_full(srcOff + i);
-                ccSrc2Taint[i] = shadow->gsv.query_full(src2Off + i);
+                ccDstTaint[i] = shadow->gsv->query_full(dstOff + i);
+                ccSrcTaint[i] = shadow->gsv->query_full(srcOff + i);
+                ccSrc2Taint[i] = shadow->gsv->query_full(src2Off + i);
             }
             for (uint32_t i = 0; i < sizeof(uint32_t); i++) {
-                ccOpTaint[i] = shadow->gsv.query_full(opOff + i);
+                ccOpTaint[i] = shadow->gsv->query_full(opOff + i);
+            }
+            if (unlikely(taint_trace_on)) {
+                taint_trace_save(shadow->gsv, dstOff, sizeof(target_ulong), dstOff, false);
+                taint_trace_save(shadow->gsv, srcOff, sizeof(target_ulong), srcOff, false);
+                taint_trace_save(shadow->gsv, src2Off, sizeof(target_ulong), src2Off, false);
+                taint_trace_save(shadow->gsv, opOff, sizeof(uint32_t), opOff, false);
             }
             savedTaint = true;
         }
@@ -465,18 +526,18 @@ void panda_virtual_string_read(CPUState *cpu, target_ulong vaddr, char *str) {
 void taint_state_changed(Shad *shad, uint64_t shad_addr, uint64_t size)
 {
     Addr addr;
-    if (shad == &shadow->llv) {
+    if (shad == shadow->llv) {
         addr = make_laddr(shad_addr / MAXREGSIZE, shad_addr % MAXREGSIZE);
-    } else if (shad == &shadow->ram) {
+    } else if (shad == shadow->ram) {
         addr = make_maddr(shad_addr);
-    } else if (shad == &shadow->grv) {
+    } else if (shad == shadow->grv) {
         addr = make_greg(shad_addr / sizeof(target_ulong), shad_addr % sizeof(target_ulong));
-    } else if (shad == &shadow->gsv) {
+    } else if (shad == shadow->gsv) {
         addr.typ = GSPEC;
         addr.val.gs = shad_addr;
         addr.off = 0;
         addr.flag = (AddrFlag)0;
-    } else if (shad == &shadow->ret) {
+    } else if (shad == shadow->ret) {
         addr.typ = RET;
         addr.val.ret = 0;
         addr.off = shad_addr;
@@ -499,6 +560,34 @@ bool before_block_exec_invalidate_opt(CPUState *cpu, TranslationBlock *tb) {
     return false;
 }
 
+// Taint can only spread from the shadows a block reads, so with none of them
+// tainted the uninstrumented translation does the same thing.  Which RAM a
+// block is going to touch isn't known before it runs, so RAM is checked as a
+// whole (cheap for the paged shadow, which skips pages never written).
+// Once taint is around, the shadows are rescanned every bypass_check blocks.
+void before_block_exec_bypass(CPUState *cpu, TranslationBlock *tb) {
+    if (!taintEnabled) return;
+
+    if (!guest_taint_free && ++bypass_blocks_since_scan >= bypass_check) {
+        bypass_blocks_since_scan = 0;
+        guest_taint_free =
+            !shadow->grv->range_tainted(0, shadow->grv->get_size()) &&
+            !shadow->gsv->range_tainted(0, shadow->gsv->get_size()) &&
+            !shadow->ram->range_tainted(0, shadow->ram->get_size());
+    }
+
+    if (guest_taint_free) {
+        panda_bypass_llvm();
+        bypass_fast_blocks++;
+    } else {
+        bypass_slow_blocks++;
+    }
+}
+
+
+static void enable_taint_on_init(CPUState *cpu) {
+    taint2_enable_taint();
+}
 
 /**
  * @brief Basic initialization for `taint2` plugin.
@@ -541,6 +630,8 @@ bool init_plugin(void *self) {
     std::cerr << PANDA_MSG "taint operations inlining " << PANDA_FLAG_STATUS(inline_taint) << std::endl;
     optimize_llvm = panda_parse_bool_opt(args, "opt", "run LLVM optimization on taint");
     std::cerr << PANDA_MSG "llvm optimizations " << PANDA_FLAG_STATUS(optimize_llvm) << std::endl;
+    optimize_taint_ops = panda_parse_bool_opt(args, "opt_ops", "coalesce and elide redundant taint operations");
+    std::cerr << PANDA_MSG "taint operation optimizer " << PANDA_FLAG_STATUS(optimize_taint_ops) << std::endl;
     debug_taint = panda_parse_bool_opt(args, "debug", "enable taint debugging");
     std::cerr << PANDA_MSG "taint debugging " << PANDA_FLAG_STATUS(debug_taint) << std::endl;
     detaint_cb0_bytes = panda_parse_bool_opt(args, "detaint_cb0", "detaint bytes whose control mask bits are 0");
@@ -551,6 +642,42 @@ bool init_plugin(void *self) {
     max_taintset_card = panda_parse_uint32_opt(args, "max_taintset_card", 0,
         "maximum size a label set can reach before stop tracking taint on it (0=never stop)");
     std::cerr << PANDA_MSG "maximum taintset cardinality (0=unlimited) " << max_taintset_card << std::endl;
+    const char *ram_shad = panda_parse_string_opt(args, "ram_shad", "fast",
+        "shadow memory used for guest RAM (fast, paged or lazy)");
+    if (0 == strcmp(ram_shad, "fast")) {
+        ram_shad_type = RAM_SHAD_FAST;
+    } else if (0 == strcmp(ram_shad, "paged")) {
+        ram_shad_type = RAM_SHAD_PAGED;
+    } else if (0 == strcmp(ram_shad, "lazy")) {
+        ram_shad_type = RAM_SHAD_LAZY;
+    } else {
+        std::cerr << PANDA_MSG "invalid ram_shad (" << ram_shad << ")" << std::endl;
+        return false;
+    }
+    std::cerr << PANDA_MSG "RAM shadow memory " << ram_shad << std::endl;
+    compact_shad = panda_parse_bool_opt(args, "compact", "use 8 byte shadow memory entries (tcn kept in a side table)");
+    std::cerr << PANDA_MSG "compact shadow memory " << PANDA_FLAG_STATUS(compact_shad) << std::endl;
+    llvm_bypass = panda_parse_bool_opt(args, "bypass", "run uninstrumented blocks while nothing the guest can read is tainted");
+    std::cerr << PANDA_MSG "untainted block bypass " << PANDA_FLAG_STATUS(llvm_bypass) << std::endl;
+    bypass_check = panda_parse_uint32_opt(args, "bypass_check", 100000,
+        "with bypass, blocks between scans for taint having gone away");
+    const char *op_trace = panda_parse_string_opt(args, "op_trace", NULL,
+        "write every taint operation to this file, for taint_query (enables taint at start)");
+    if (op_trace) {
+        if (!taint_trace_open(op_trace)) return false;
+        std::cerr << PANDA_MSG "taint op trace " << op_trace << std::endl;
+        // the trace has to see every op, from the start, as plain calls
+        inline_taint = false;
+        llvm_bypass = false;
+        panda_cb pcb3;
+        pcb3.after_machine_init = enable_taint_on_init;
+        panda_register_callback(self, PANDA_CB_AFTER_MACHINE_INIT, pcb3);
+    }
+    if (llvm_bypass && ram_shad_type == RAM_SHAD_FAST) {
+        // scanning a flat RAM shadow is far too slow
+        ram_shad_type = RAM_SHAD_PAGED;
+        std::cerr << PANDA_MSG "bypass uses the paged RAM shadow memory" << std::endl;
+    }
     
     // load dependencies
     panda_require("callstack_instr");
@@ -560,6 +687,20 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
+    if (llvm_bypass) {
+        std::cerr << PANDA_MSG "bypass ran " << bypass_fast_blocks
+            << " blocks uninstrumented, " << bypass_slow_blocks
+            << " instrumented" << std::endl;
+        if (taint2_enabled()) panda_disable_llvm_bypass();
+    }
+    if (PTFP && optimize_taint_ops) {
+        std::cerr << PANDA_MSG "taint operation optimizer removed "
+            << PTFP->PTV.taintOpsElided << " of " << PTFP->PTV.taintOpsSeen
+            << " taint ops" << std::endl;
+    }
+
+    taint_trace_close();
+
     if (shadow) {
         delete shadow;
         shadow = nullptr;
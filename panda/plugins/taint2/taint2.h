@@ -29,8 +29,6 @@
 #include "addr.h"
 #include "query_res.h"
 
-typedef const std::set<uint32_t> *LabelSetP;
-
 typedef void (*on_branch2_t) (Addr, uint64_t);
 typedef void (*on_indirect_jump_t) (Addr, uint64_t);
 typedef void (*on_taint_change_t) (Addr, uint64_t);
@@ -38,24 +36,65 @@ typedef void (*on_ptr_load_t) (Addr, uint64_t, uint64_t);
 typedef void (*on_ptr_store_t) (Addr, uint64_t, uint64_t);
 
 
+// Which shadow memory implementation to use for guest RAM.
+enum RamShadType {
+    RAM_SHAD_FAST,   // FastShad: one big mmaped array
+    RAM_SHAD_PAGED,  // PageShad: sparse pages plus a clean page bitmap
+    RAM_SHAD_LAZY,   // LazyShad: std::map, mainly for comparison
+};
+
 struct ShadowState {
     uint64_t prev_bb; // label for previous BB.
     uint32_t num_vals;
-    FastShad ram;
-    FastShad llv;  // LLVM registers, with multiple frames
-    FastShad ret;  // LLVM return value, also temp register
-    FastShad grv;  // guest general purpose registers
-    FastShad gsv;  // guest special values, like FP, and parts of CPUState
+    Shad *ram;
+    Shad *llv;     // LLVM registers, with multiple frames
+    Shad *ret;     // LLVM return value, also temp register
+    Shad *grv;     // guest general purpose registers
+    Shad *gsv;     // guest special values, like FP, and parts of CPUState
     LazyShad hd;   // Hard Drive
     LazyShad io;   // I/O Buffer
 
-    ShadowState()
-        : prev_bb(0), num_vals(MAXFRAMESIZE), ram("RAM", ram_size),
-          llv("LLVM", MAXFRAMESIZE * FUNCTIONFRAMES * MAXREGSIZE),
-          ret("Ret", MAXREGSIZE), grv("Reg", NUM_REGS * sizeof(target_ulong)),
-          gsv("CPUState", sizeof(CPUArchState)), hd("HD", UINT64_MAX),
-          io("IO", UINT64_MAX)
+    // With compact set, the array backed shadows use CompactShad (8 bytes
+    // per entry) rather than FastShad (16 bytes per entry).
+    ShadowState(RamShadType ram_type = RAM_SHAD_FAST, bool compact = false)
+        : prev_bb(0), num_vals(MAXFRAMESIZE),
+          ram(new_ram_shad(ram_type, compact)),
+          llv(new_fast_shad("LLVM", MAXFRAMESIZE * FUNCTIONFRAMES * MAXREGSIZE,
+                            compact)),
+          ret(new_fast_shad("Ret", MAXREGSIZE, compact)),
+          grv(new_fast_shad("Reg", NUM_REGS * sizeof(target_ulong), compact)),
+          gsv(new_fast_shad("CPUState", sizeof(CPUArchState), compact)),
+          hd("HD", UINT64_MAX), io("IO", UINT64_MAX)
+    {
+    }
+
+    ~ShadowState()
     {
+        delete ram;
+        delete llv;
+        delete ret;
+        delete grv;
+        delete gsv;
+    }
+
+    static Shad *new_fast_shad(std::string name, uint64_t size, bool compact)
+    {
+        if (compact) {
+            return new CompactShad(name, size);
+        }
+        return new FastShad(name, size);
+    }
+
+    static Shad *new_ram_shad(RamShadType ram_type, bool compact)
+    {
+        switch (ram_type) {
+            case RAM_SHAD_PAGED:
+                return new PageShad("RAM", ram_size);
+            case RAM_SHAD_LAZY:
+                return new LazyShad("RAM", ram_size);
+            default:
+                return new_fast_shad("RAM", ram_size, compact);
+        }
     }
 
     std::pair<Shad *, uint64_t> query_loc(const Addr &a)
@@ -68,15 +107,15 @@ struct ShadowState {
             case CONST:
                 return std::make_pair(nullptr, 0);
             case MADDR:
-                return std::make_pair(&ram, a.val.ma + a.off);
+                return std::make_pair(ram, a.val.ma + a.off);
             case LADDR:
-                return std::make_pair(&llv, a.val.la * MAXREGSIZE + a.off);
+                return std::make_pair(llv, a.val.la * MAXREGSIZE + a.off);
             case GREG:
-                return std::make_pair(&grv, a.val.gr * sizeof(target_ulong) + a.off);
+                return std::make_pair(grv, a.val.gr * sizeof(target_ulong) + a.off);
             case GSPEC:
-                return std::make_pair(&gsv, a.val.gs + a.off);
+                return std::make_pair(gsv, a.val.gs + a.off);
             case RET:
-                return std::make_pair(&ret, a.off);
+                return std::make_pair(ret, a.off);
             default:
                 assert(false);
                 return std::make_pair(nullptr, 0);
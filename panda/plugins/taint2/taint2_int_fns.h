@@ -48,6 +48,18 @@ void taint2_label_reg_additive(int reg_num, int offset, uint32_t l);
 // address are not removed.
 void taint2_label_io_additive(uint64_t ia, uint32_t l);
 
+// label the guest virtual range [addr .. addr+length-1] of RAM, replacing any
+// previous labels. with positional, byte i gets label start_label+i, else
+// every byte gets start_label. each page is translated once and labelled in
+// one go; pages that aren't mapped to RAM are skipped. returns the number of
+// bytes labelled.
+uint32_t taint2_label_ram_range(CPUState *cpu, uint64_t addr, uint32_t length,
+                                uint32_t start_label, bool positional);
+
+// label the io addrs [ia .. ia+length-1] the same way.
+void taint2_label_io_range(uint64_t ia, uint32_t length, uint32_t start_label,
+                           bool positional);
+
 // query fns return 0 if untainted, else cardinality of taint set
 uint32_t taint2_query(Addr a);
 uint32_t taint2_query_ram(uint64_t RamOffset);
@@ -1,6 +1,9 @@
 #include "taint2.h"
 #include "taint_api.h"
+#include "taint_trace.h"
+#include <algorithm>
 #include <set>
+#include <vector>
 
 Addr make_haddr(uint64_t a)
 {
@@ -87,6 +90,7 @@ static void start_debugging() {
 }
 
 extern ShadowState *shadow;
+void taint_bypass_off(void);
 
 // returns a copy of the labelset associated with a.  or NULL if none.
 // so you'll need to call labelset_free on this pointer when done with it.
@@ -106,11 +110,15 @@ static TaintData tp_query_full(const Addr &a) {
 static void tp_delete(const Addr &a) {
     assert(shadow);
     auto loc = shadow->query_loc(a);
-    if (loc.first) loc.first->remove(loc.second, 1);
+    if (loc.first) {
+        TAINT_TRACE(TT_DELETE, loc.first, loc.second, 1, nullptr, 0, 0);
+        loc.first->remove(loc.second, 1);
+    }
 }
 
 static void tp_labelset_put(const Addr &a, LabelSetP ls) {
     assert(shadow);
+    taint_bypass_off();
     auto loc = shadow->query_loc(a);
     if (loc.first) loc.first->set_full(loc.second, TaintData(ls));
 }
@@ -123,6 +131,10 @@ std::set<uint32_t> labels_applied;
 static void tp_label(Addr a, uint32_t l) {
     if (debug_taint) start_debugging();
 
+    if (unlikely(taint_trace_on)) {
+        auto loc = shadow->query_loc(a);
+        if (loc.first) taint_trace_label(loc.first, loc.second, 1, l, false, false);
+    }
     LabelSetP ls = label_set_singleton(l);
     tp_labelset_put(a, ls);
     labels_applied.insert(l);
@@ -133,6 +145,10 @@ static void tp_label(Addr a, uint32_t l) {
 static void tp_label_additive(Addr a, uint32_t l) {
     if (debug_taint) start_debugging();
 
+    if (unlikely(taint_trace_on)) {
+        auto loc = shadow->query_loc(a);
+        if (loc.first) taint_trace_label(loc.first, loc.second, 1, l, false, true);
+    }
     LabelSetP ls_at_a = tp_labelset_get(a);     // get the set at addr a
     LabelSetP ls_of_l = label_set_singleton(l); // get new set with label l
 
@@ -196,62 +212,107 @@ void taint2_label_io_additive(uint64_t ia, uint32_t l) {
     tp_label_additive(a, l);
 }
 
-static void label_byte(target_ulong virt_addr, hwaddr pa, ram_addr_t RamOffset, uint32_t label_num) {
-    if (pandalog) {
-        Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
-        ple.has_taint_label_virtual_addr = 1;
-        ple.has_taint_label_physical_addr = 1;
-        ple.has_taint_label_number = 1;
-        ple.taint_label_virtual_addr = virt_addr;
-        ple.taint_label_physical_addr = pa;
-        ple.taint_label_number = label_num;
-        pandalog_write_entry(&ple);
-    }
-    taint2_label_ram(RamOffset, label_num);
+static void log_label(target_ulong virt_addr, hwaddr pa, uint32_t label_num) {
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.has_taint_label_virtual_addr = 1;
+    ple.has_taint_label_physical_addr = 1;
+    ple.has_taint_label_number = 1;
+    ple.taint_label_virtual_addr = virt_addr;
+    ple.taint_label_physical_addr = pa;
+    ple.taint_label_number = label_num;
+    pandalog_write_entry(&ple);
 }
 
 
-// Apply positional taint to a buffer of memory
-void taint2_add_taint_ram_pos(CPUState *cpu, uint64_t addr, uint32_t length, uint32_t start_label){
-    for (unsigned i = 0; i < length; i++){
-        hwaddr pa = panda_virt_to_phys(cpu, addr + i);
-        if (pa == (hwaddr)(-1)) {
-            printf("can't label addr=0x%" PRIx64 ": mmu hasn't mapped virt->phys, "
-                   "i.e., it isnt actually there.\n", addr+i);
-            continue;
+// Labels [off .. off+n-1] of shad: with positional, item i gets label
+// label+i, otherwise they all get label. The label sets are made in one
+// batch and stored with a single range store and taint change report.
+static void tp_label_range(Shad *shad, uint64_t off, uint32_t n,
+                           uint32_t label, bool positional) {
+    static std::vector<LabelSetP> sets;
+    static std::vector<TaintData> tds;
+
+    if (n == 0) return;
+    if (debug_taint) start_debugging();
+    taint_bypass_off();
+    if (unlikely(taint_trace_on)) {
+        taint_trace_label(shad, off, n, label, positional, false);
+    }
+
+    tds.resize(n);
+    if (positional) {
+        sets.resize(n);
+        label_set_singletons(label, n, sets.data());
+        for (uint32_t i = 0; i < n; i++) tds[i] = TaintData(sets[i]);
+        // labels only ever go up here, so hinting at the end keeps the
+        // inserts cheap
+        for (uint32_t i = 0; i < n; i++) {
+            labels_applied.insert(labels_applied.end(), label + i);
         }
+    } else {
+        std::fill(tds.begin(), tds.end(), TaintData(label_set_singleton(label)));
+        labels_applied.insert(label);
+    }
+
+    shad->set_range_quiet(off, n, tds.data());
+    if (track_taint_state) taint_state_changed(shad, off, n);
+}
+
+uint32_t taint2_label_ram_range(CPUState *cpu, uint64_t addr, uint32_t length,
+                                uint32_t start_label, bool positional) {
+    assert(shadow);
+    uint32_t labelled = 0;
+    uint32_t i = 0;
+    while (i < length) {
+        // one translation per guest page
+        uint64_t va = addr + i;
+        uint32_t n = TARGET_PAGE_SIZE - (va & ~TARGET_PAGE_MASK);
+        if (n > length - i) n = length - i;
+        uint32_t label = positional ? start_label + i : start_label;
+
+        hwaddr pa = panda_virt_to_phys(cpu, va);
         ram_addr_t RamOffset = RAM_ADDR_INVALID;
-        if (PandaPhysicalAddressToRamOffset(&RamOffset, pa, false) != MEMTX_OK)
-        {
-            printf("can't label addr=0x%" PRIx64 " paddr=0x" TARGET_FMT_plx ": physical map is not RAM.\n", addr + i, pa);
-            continue;
+        if (pa == (hwaddr)(-1)) {
+            printf("can't label addr=0x%" PRIx64 "..0x%" PRIx64 ": mmu hasn't "
+                   "mapped virt->phys, i.e., it isnt actually there.\n",
+                   va, va + n - 1);
+        } else if (PandaPhysicalAddressToRamOffset(&RamOffset, pa, false) != MEMTX_OK) {
+            printf("can't label addr=0x%" PRIx64 "..0x%" PRIx64 " paddr=0x"
+                   TARGET_FMT_plx ": physical map is not RAM.\n",
+                   va, va + n - 1, pa);
+        } else {
+            if (pandalog) {
+                for (uint32_t j = 0; j < n; j++) {
+                    log_label(va + j, pa + j, positional ? label + j : label);
+                }
+            }
+            tp_label_range(shadow->ram, RamOffset, n, label, positional);
+            labelled += n;
         }
-        printf("taint2: adding positional taint label %d\n", i+start_label);
-        label_byte(addr + i, pa, RamOffset, i+start_label);
+        i += n;
     }
+    return labelled;
+}
+
+void taint2_label_io_range(uint64_t ia, uint32_t length, uint32_t start_label,
+                           bool positional) {
+    assert(shadow);
+    tp_label_range(&shadow->io, ia, length, start_label, positional);
+}
+
+// Apply positional taint to a buffer of memory
+void taint2_add_taint_ram_pos(CPUState *cpu, uint64_t addr, uint32_t length, uint32_t start_label){
+    uint32_t n = taint2_label_ram_range(cpu, addr, length, start_label, true);
+    printf("taint2: added positional taint labels %u..%u to %u bytes\n",
+           start_label, start_label + length - 1, n);
 }
 
 
 // Apply single label taint to a buffer of memory
 void taint2_add_taint_ram_single_label(CPUState *cpu, uint64_t addr,
         uint32_t length, long label){
-    for (unsigned i = 0; i < length; i++){
-        hwaddr pa = panda_virt_to_phys(cpu, addr + i);
-        if (pa == (hwaddr)(-1)) {
-            printf("can't label addr=0x%" PRIx64 ": mmu hasn't mapped virt->phys, "
-                   "i.e., it isnt actually there.\n", addr+i);
-            continue;
-        }
-        ram_addr_t RamOffset = RAM_ADDR_INVALID;
-        if (PandaPhysicalAddressToRamOffset(&RamOffset, pa, false) != MEMTX_OK)
-        {
-            printf("can't label addr=0x%" PRIx64 " paddr=0x" TARGET_FMT_plx ": physical map is not RAM.\n", addr + i, pa);
-            continue;
-        }
-        //taint2_label_ram(pa, label);
-        printf("taint2: adding single taint label %lu\n", label);
-        label_byte(addr + i, pa, RamOffset, label);
-    }
+    uint32_t n = taint2_label_ram_range(cpu, addr, length, label, false);
+    printf("taint2: added single taint label %lu to %u bytes\n", label, n);
 }
 
 uint32_t taint2_query(Addr a) {
@@ -427,8 +488,14 @@ void taint2_labelset_io_iter(uint64_t ia, int (*app)(uint32_t el, void *stuff1),
     tp_ls_iter(tp_labelset_get(make_iaddr(ia)), app, stuff2);
 }
 
+extern bool optimize_taint_ops;
+extern bool taintEnabled;
 void taint2_track_taint_state(void) {
     track_taint_state = true;
+    // Blocks translated with the taint op optimizer may be missing ops that
+    // would have reported a change, so retranslate them.  Helpers were
+    // instrumented once when taint was enabled and are left as they are.
+    if (optimize_taint_ops && taintEnabled) panda_do_flush_tb();
 }
 
 #define MAX_EL_ARR_IND 1000000
@@ -504,14 +571,13 @@ void pandalog_taint_query_free(Panda__TaintQuery *tq) {
     free(tq);
 }
 
-extern bool taintEnabled;
 int taint2_enabled() {
     return taintEnabled;
 }
 
-// from label_set.h
-// typedef const std::set<TaintLabel> *LabelSetP;
-typedef std::set<TaintLabel>::iterator LabelSetIter;
+// from label_set.h: label sets are flat sorted arrays, so iterators are just
+// pointers into them
+typedef const TaintLabel *LabelSetIter;
 
 void taint2_query_results_iter(QueryResult *qr) {
 
@@ -547,7 +613,7 @@ void taint2_query_laddr_full(uint64_t la, uint64_t offset, QueryResult *qr) {
 	qr->num_labels = td.ls->size();
 	qr->tcn = td.tcn;
 	qr->cb_mask = td.cb_mask;
-	qr->ls = (void *) td.ls;  // this should be a (const std::set<TaintLabel> *) type
+	qr->ls = (void *) td.ls;  // this should be a (const LabelSet *) type
 	taint2_query_results_iter(qr);
 }
 
@@ -559,7 +625,7 @@ void taint2_query_reg_full(uint32_t reg_num, uint32_t offset, QueryResult *qr) {
 	qr->num_labels = td.ls->size();
 	qr->tcn = td.tcn;
 	qr->cb_mask = td.cb_mask;
-	qr->ls = (void *) td.ls;  // this should be a (const std::set<TaintLabel> *) type
+	qr->ls = (void *) td.ls;  // this should be a (const LabelSet *) type
 	taint2_query_results_iter(qr);
 }
 //
@@ -572,6 +638,6 @@ void taint2_query_ram_full(uint64_t RamOffset, QueryResult *qr) {
 	qr->num_labels = td.ls->size();
 	qr->tcn = td.tcn;
 	qr->cb_mask = td.cb_mask;
-	qr->ls = (void *) td.ls;  // this should be a (const std::set<TaintLabel> *) type
+	qr->ls = (void *) td.ls;  // this should be a (const LabelSet *) type
 	taint2_query_results_iter(qr);
 }
@@ -24,6 +24,10 @@ void taint2_label_io(uint64_t ia, uint32_t l);
 void taint2_label_ram_additive(uint64_t RamOffset, uint32_t l);
 void taint2_label_reg_additive(int reg_num, int offset, uint32_t l);
 void taint2_label_io_additive(uint64_t ia, uint32_t l);
+uint32_t taint2_label_ram_range(CPUState *cpu, uint64_t addr, uint32_t length,
+    uint32_t start_label, bool positional);
+void taint2_label_io_range(uint64_t ia, uint32_t length, uint32_t start_label,
+    bool positional);
 void taint2_add_taint_ram_pos(CPUState *cpu, uint64_t addr, uint32_t length, uint32_t start_label);
 void taint2_add_taint_ram_single_label(CPUState *cpu, uint64_t addr,
     uint32_t length, long label);
@@ -40,6 +40,7 @@ PANDAENDCOMMENT */
 #include "shad.h"
 #include "label_set.h"
 #include "taint_ops.h"
+#include "taint_trace.h"
 
 uint64_t labelset_count;
 
@@ -141,11 +142,18 @@ void taint_copy(Shad *shad_dest, uint64_t dest, Shad *shad_src, uint64_t src,
             shad_dest->name(), dest, size, shad_src->name(), src);
     taint_log_labels(shad_src, src, size);
 
+    TAINT_TRACE(TT_COPY, shad_dest, dest, size, shad_src, src, size);
     Shad::copy(shad_dest, dest, shad_src, src, size);
 
     if (I) update_cb(shad_dest, dest, shad_src, src, size, I);
 }
 
+static void parallel_compute(Shad *shad, uint64_t dest, uint64_t src1,
+                             uint64_t src2, uint64_t src_size,
+                             llvm::Instruction *I);
+static void mix_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
+                        uint64_t src1, uint64_t src2, uint64_t src_size);
+
 void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
                             uint64_t src1, uint64_t src2, uint64_t src_size,
                             llvm::Instruction *I)
@@ -156,6 +164,16 @@ void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
         return;
     }
 
+    TAINT_TRACE(TT_PCOMPUTE, shad, dest, src_size, shad, src1, src_size,
+                shad, src2, src_size);
+    parallel_compute(shad, dest, src1, src2, src_size, I);
+}
+
+static void parallel_compute(Shad *shad, uint64_t dest, uint64_t src1,
+                             uint64_t src2, uint64_t src_size,
+                             llvm::Instruction *I)
+{
+
     taint_log("pcompute: %s[%lx+%lx] <- %lx + %lx\n",
             shad->name(), dest, src_size, src1, src2);
     uint64_t i;
@@ -224,6 +242,14 @@ static inline void bulk_set(Shad *shad, uint64_t addr, uint64_t size,
 void taint_mix_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
                        uint64_t src1, uint64_t src2, uint64_t src_size,
                        llvm::Instruction *ignored)
+{
+    TAINT_TRACE(TT_MCOMPUTE, shad, dest, dest_size, shad, src1, src_size,
+                shad, src2, src_size);
+    mix_compute(shad, dest, dest_size, src1, src2, src_size);
+}
+
+static void mix_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
+                        uint64_t src1, uint64_t src2, uint64_t src_size)
 {
     TaintData td = TaintData::make_union(
             mixed_labels(shad, src1, src_size, false),
@@ -239,12 +265,13 @@ void taint_mul_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
                        uint64_t src1, uint64_t src2, uint64_t src_size,
                        llvm::Instruction *inst, uint64_t arg1, uint64_t arg2)
 {
-    bool isTainted1 = false;
-    bool isTainted2 = false;
-    for (int i = 0; i < src_size; ++i) {
-        isTainted1 |= shad->query(src1+i) != NULL;
-        isTainted2 |= shad->query(src2+i) != NULL;
-    }
+    // what propagates depends on what's tainted now, so the trace gets the
+    // general case
+    TAINT_TRACE(TT_MCOMPUTE, shad, dest, dest_size, shad, src1, src_size,
+                shad, src2, src_size);
+
+    bool isTainted1 = shad->range_tainted(src1, src_size);
+    bool isTainted2 = shad->range_tainted(src2, src_size);
     if (!isTainted1 && !isTainted2) {
         taint_log("mul_com: untainted args \n");
         return; //nothing to propagate
@@ -253,12 +280,17 @@ void taint_mul_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
         taint_log("mul_com: one untainted arg %lu \n", cleanArg);
         if (cleanArg == 0) return ; // mul X untainted 0 -> no taint prop
         else if (cleanArg == 1) { //mul X untainted 1(one) should be a parallel taint
-            taint_parallel_compute(shad, dest, dest_size, src1, src2,  src_size, inst);
+            uint64_t shad_size = shad->get_size();
+            if (unlikely(dest >= shad_size || src1 >= shad_size ||
+                         src2 >= shad_size)) {
+                return;
+            }
+            parallel_compute(shad, dest, src1, src2, src_size, inst);
             taint_log("mul_com: mul X 1\n");
             return;
         }
     }
-    taint_mix_compute(shad, dest, dest_size, src1, src2,  src_size, inst);
+    mix_compute(shad, dest, dest_size, src1, src2, src_size);
 }
 
 void taint_delete(Shad *shad, uint64_t dest, uint64_t size)
@@ -268,18 +300,21 @@ void taint_delete(Shad *shad, uint64_t dest, uint64_t size)
         taint_log("Ignoring IO RW\n");
         return;
     }
+    TAINT_TRACE(TT_DELETE, shad, dest, size, nullptr, 0, 0);
     shad->remove(dest, size);
 }
 
 void taint_set(Shad *shad_dest, uint64_t dest, uint64_t dest_size,
                Shad *shad_src, uint64_t src)
 {
+    TAINT_TRACE(TT_SET, shad_dest, dest, dest_size, shad_src, src, 1);
     bulk_set(shad_dest, dest, dest_size, shad_src->query_full(src));
 }
 
 void taint_mix(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
                uint64_t src_size, llvm::Instruction *I)
 {
+    TAINT_TRACE(TT_MIX, shad, dest, dest_size, shad, src, src_size);
     TaintData td = mixed_labels(shad, src, src_size, true);
     bulk_set(shad, dest, dest_size, td);
     taint_log("mix: %s[%lx+%lx] <- %lx+%lx ",
@@ -313,6 +348,10 @@ void taint_pointer(Shad *shad_dest, uint64_t dest, Shad *shad_ptr, uint64_t ptr,
         src = ones; // ignore source.
     }
 
+    TAINT_TRACE(TT_POINTER, shad_dest, dest, size,
+                src == ones ? nullptr : shad_src, src == ones ? 0 : src,
+                src == ones ? 0 : size, shad_ptr, ptr, ptr_size);
+
     // query taint on pointer either being read or written
     if (tainted_pointer & TAINT_POINTER_MODE_CHECK) {
         taint_pointer_run(src, ptr, dest, (bool) is_store, size);
@@ -349,6 +388,9 @@ void taint_sext(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
                 uint64_t src_size)
 {
     taint_log("taint_sext\n");
+    TAINT_TRACE(TT_COPY, shad, dest, src_size, shad, src, src_size);
+    TAINT_TRACE(TT_SET, shad, dest + src_size, dest_size - src_size,
+                shad, dest + src_size - 1, 1);
     Shad::copy(shad, dest, shad, src, src_size);
     bulk_set(shad, dest + src_size, dest_size - src_size,
             shad->query_full(dest + src_size - 1));
@@ -367,6 +409,7 @@ void taint_select(Shad *shad, uint64_t dest, uint64_t size, uint64_t selector,
     while (!(src == ones && srcsel == ones)) {
         if (srcsel == selector) { // bingo!
             if (src != ones) { // otherwise it's a constant.
+                TAINT_TRACE(TT_COPY, shad, dest, size, shad, src, size);
                 Shad::copy(shad, dest, shad, src, size);
             }
             return;
@@ -454,6 +497,7 @@ void taint_host_copy(uint64_t env_ptr, uint64_t addr, Shad *llv,
     taint_log("hostcopy: %s[%lx+%lx] <- %s[%lx] (offset %lx) ",
             shad_dest->name(), dest, size, shad_src->name(), src, offset);
     taint_log_labels(shad_src, src, size);
+    TAINT_TRACE(TT_COPY, shad_dest, dest, size, shad_src, src, size);
     Shad::copy(shad_dest, dest, shad_src, src, size);
 }
 
@@ -480,6 +524,7 @@ void taint_host_memcpy(uint64_t env_ptr, uint64_t dest, uint64_t src,
             shad_dest->name(), dest, size, shad_src->name(), src,
             dest_offset, src_offset);
     taint_log_labels(shad_src, addr_src, size);
+    TAINT_TRACE(TT_COPY, shad_dest, addr_dest, size, shad_src, addr_src, size);
     Shad::copy(shad_dest, addr_dest, shad_src, addr_src, size);
 }
 
@@ -499,6 +544,7 @@ void taint_host_delete(uint64_t env_ptr, uint64_t dest_addr, Shad *greg,
 
     taint_log("hostdel: %s[%lx+%lx]\n", shad->name(), dest, size);
 
+    TAINT_TRACE(TT_DELETE, shad, dest, size, nullptr, 0, 0);
     shad->remove(dest, size);
 }
 
@@ -551,14 +597,7 @@ static void update_cb(Shad *shad_dest, uint64_t dest, Shad *shad_src,
     // this is because some operations cause constants to be put in the masks
     // (eg. SHL puts 1s in lower bits of zero mask), and this would then
     // generate a spurious taint change report
-    bool tainted = false;
-    for (uint32_t i = 0; i < size; i++) {
-        if (shad_src->query(src + i) != NULL) {
-            tainted = true;
-        }
-    }
-
-    if (tainted) {
+    if (shad_src->range_tainted(src, size)) {
         CBMasks cb_masks = compile_cb_masks(shad_src, src, size);
         uint64_t &cb_mask = cb_masks.cb_mask;
         uint64_t &one_mask = cb_masks.one_mask;
@@ -0,0 +1,609 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+/*
+ * Offline taint queries over a taint2 op trace (taint2:op_trace=<file>).
+ *
+ * The trace is cut into chunks, and each chunk is summarized in parallel,
+ * independently of any query: for every location the chunk writes, the set
+ * of "atoms" its final value depends on, where an atom is either a location
+ * as it was at the start of the chunk or a label applied inside the chunk.
+ * Branches on tainted-able values are summarized the same way. Summaries
+ * compose, so a query then only walks the chunk summaries:
+ *
+ *   forward   which label groups reach which branches, and RAM at the end
+ *   backward  which labels reach a given branch, or RAM at the end
+ *
+ * Usage:
+ *
+ *   taint_query [-j threads] [-c chunk_ops] [-s] trace forward LO[-HI]...
+ *   taint_query [-j threads] [-c chunk_ops] trace backward op=N
+ *   taint_query [-j threads] [-c chunk_ops] trace backward ram=ADDR+LEN
+ *
+ * Each LO-HI range of labels is a group (up to 64); forward reports group
+ * masks. -s answers forward queries by interpreting the whole trace on one
+ * thread instead, which is useful to check the summaries against.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#define TAINT_TRACE_NO_RECORDER
+#include "taint_trace.h"
+
+// A shadow location: the shadow in the top byte, the address below it.
+typedef uint64_t Loc;
+#define LOC_ADDR_MASK ((1ULL << 56) - 1)
+
+static inline Loc make_loc(uint8_t shad, uint64_t addr) {
+    return (uint64_t)shad << 56 | (addr & LOC_ADDR_MASK);
+}
+static inline uint8_t loc_shad(Loc l) { return l >> 56; }
+static inline uint64_t loc_addr(Loc l) { return l & LOC_ADDR_MASK; }
+
+static const char *shad_names[TT_SHAD_COUNT] = {
+    "ram", "llv", "ret", "grv", "gsv", "hd", "io", "saved"
+};
+
+/* ******************************************************************
+ Trace
+****************************************************************** */
+
+class Trace {
+public:
+    const TaintTraceOp *ops = nullptr;
+    uint64_t num_ops = 0;
+
+    bool open(const char *path) {
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            perror(path);
+            return false;
+        }
+        struct stat st;
+        fstat(fd, &st);
+        size = st.st_size;
+        const size_t header = 16;
+        if (size < header) {
+            fprintf(stderr, "%s: too short for a taint op trace\n", path);
+            ::close(fd);
+            return false;
+        }
+        base = (const uint8_t *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            perror("mmap");
+            return false;
+        }
+        uint32_t version, record_size;
+        memcpy(&version, base + 8, 4);
+        memcpy(&record_size, base + 12, 4);
+        if (memcmp(base, TAINT_TRACE_MAGIC, 8) != 0 ||
+                version != TAINT_TRACE_VERSION ||
+                record_size != sizeof(TaintTraceOp)) {
+            fprintf(stderr, "%s: not a version %d taint op trace\n", path,
+                    TAINT_TRACE_VERSION);
+            return false;
+        }
+        madvise((void *)base, size, MADV_SEQUENTIAL);
+        ops = (const TaintTraceOp *)(base + header);
+        num_ops = (size - header) / sizeof(TaintTraceOp);
+        return true;
+    }
+
+    ~Trace() {
+        if (base && base != MAP_FAILED) munmap((void *)base, size);
+    }
+
+private:
+    const uint8_t *base = nullptr;
+    size_t size = 0;
+};
+
+/* ******************************************************************
+ Op semantics
+****************************************************************** */
+
+// Runs one op on a value domain D, which provides
+//   V empty(); V get(Loc); void put(Loc, V); V join(V, V); V label(uint32_t)
+//   void branch(uint64_t op_index, uint64_t instr, Loc, V); uint64_t instr
+// The forward interpreter uses label group masks as values, the summarizer
+// sets of atoms.
+template <typename D>
+static void run_op(D &d, const TaintTraceOp &op, uint64_t idx) {
+    typedef decltype(d.empty()) V;
+    static thread_local std::vector<V> tmp;
+
+    auto mix = [&](uint8_t shad, uint64_t addr, uint64_t n) {
+        V v = d.empty();
+        for (uint64_t i = 0; i < n; i++) v = d.join(v, d.get(make_loc(shad, addr + i)));
+        return v;
+    };
+    auto fill = [&](V v) {
+        for (uint64_t i = 0; i < op.dest_size; i++) d.put(make_loc(op.dest_shad, op.dest + i), v);
+    };
+
+    switch (op.type) {
+        case TT_COPY:
+        case TT_PCOMPUTE:
+            // read everything first, the ranges may overlap
+            tmp.resize(op.dest_size);
+            for (uint64_t i = 0; i < op.dest_size; i++) {
+                tmp[i] = d.get(make_loc(op.src_shad, op.src + i));
+                if (op.type == TT_PCOMPUTE) {
+                    tmp[i] = d.join(tmp[i], d.get(make_loc(op.src2_shad, op.src2 + i)));
+                }
+            }
+            for (uint64_t i = 0; i < op.dest_size; i++) {
+                d.put(make_loc(op.dest_shad, op.dest + i), tmp[i]);
+            }
+            break;
+        case TT_MCOMPUTE:
+            fill(d.join(mix(op.src_shad, op.src, op.src_size),
+                        mix(op.src2_shad, op.src2, op.src2_size)));
+            break;
+        case TT_MIX:
+            fill(mix(op.src_shad, op.src, op.src_size));
+            break;
+        case TT_SET:
+            fill(d.get(make_loc(op.src_shad, op.src)));
+            break;
+        case TT_POINTER: {
+            V ptr = mix(op.src2_shad, op.src2, op.src2_size);
+            tmp.resize(op.dest_size);
+            for (uint64_t i = 0; i < op.dest_size; i++) {
+                tmp[i] = op.src_shad == TT_SHAD_NONE ? ptr :
+                    d.join(ptr, d.get(make_loc(op.src_shad, op.src + i)));
+            }
+            for (uint64_t i = 0; i < op.dest_size; i++) {
+                d.put(make_loc(op.dest_shad, op.dest + i), tmp[i]);
+            }
+            break;
+        }
+        case TT_DELETE:
+            fill(d.empty());
+            break;
+        case TT_LABEL:
+        case TT_LABEL_ADD:
+            for (uint64_t i = 0; i < op.dest_size; i++) {
+                Loc l = make_loc(op.dest_shad, op.dest + i);
+                V v = d.label(op.src + (op.src2 ? i : 0));
+                d.put(l, op.type == TT_LABEL ? v : d.join(d.get(l), v));
+            }
+            break;
+        case TT_BRANCH:
+            d.branch(idx, d.instr, make_loc(op.src_shad, op.src),
+                     mix(op.src_shad, op.src, op.src_size));
+            break;
+        case TT_INSTR:
+            d.instr = op.dest;
+            break;
+        default:
+            fprintf(stderr, "bad op type %d at op %" PRIu64 "\n", op.type, idx);
+            exit(1);
+    }
+}
+
+/* ******************************************************************
+ Chunk summaries
+****************************************************************** */
+
+#define ATOM_LABEL (1ULL << 63)
+
+struct BranchEvent {
+    uint64_t op;
+    uint64_t instr;
+    Loc loc;
+    uint32_t set;
+};
+
+struct Summary {
+    uint64_t first_op;
+    uint64_t end_op;
+    // an atom is an input location, or ATOM_LABEL | label
+    std::vector<uint64_t> atoms;
+    // interned sorted sets of atom indices; set 0 is the empty set
+    std::vector<std::vector<uint32_t>> sets;
+    // final value of every location written in the chunk
+    std::unordered_map<Loc, uint32_t> writes;
+    // branches whose condition depends on something
+    std::vector<BranchEvent> branches;
+};
+
+class Summarizer {
+public:
+    uint64_t instr = 0;
+
+    explicit Summarizer(Summary &s) : S(s) {
+        S.sets.emplace_back();
+    }
+
+    uint32_t empty() { return 0; }
+
+    uint32_t get(Loc l) {
+        auto it = cur.find(l);
+        if (it != cur.end()) return it->second.first;
+        // first read of something the chunk hasn't written: its value at
+        // the start of the chunk
+        uint32_t set = singleton(l);
+        cur.emplace(l, std::make_pair(set, false));
+        return set;
+    }
+
+    void put(Loc l, uint32_t set) {
+        cur[l] = std::make_pair(set, true);
+    }
+
+    uint32_t label(uint64_t label) {
+        return singleton(ATOM_LABEL | label);
+    }
+
+    uint32_t join(uint32_t a, uint32_t b) {
+        if (a == b || b == 0) return a;
+        if (a == 0) return b;
+        if (a > b) std::swap(a, b);
+        uint64_t key = (uint64_t)a << 32 | b;
+        auto it = union_cache.find(key);
+        if (it != union_cache.end()) return it->second;
+
+        const std::vector<uint32_t> &sa = S.sets[a], &sb = S.sets[b];
+        temp.clear();
+        std::set_union(sa.begin(), sa.end(), sb.begin(), sb.end(),
+                       std::back_inserter(temp));
+        uint32_t result;
+        if (temp.size() == sb.size()) result = b;
+        else if (temp.size() == sa.size()) result = a;
+        else result = intern(temp);
+        union_cache.emplace(key, result);
+        return result;
+    }
+
+    void branch(uint64_t op, uint64_t instr, Loc l, uint32_t set) {
+        if (set) S.branches.push_back({op, instr, l, set});
+    }
+
+    void finish() {
+        for (auto &kvp : cur) {
+            if (kvp.second.second) S.writes.emplace(kvp.first, kvp.second.first);
+        }
+    }
+
+private:
+    Summary &S;
+    std::unordered_map<Loc, std::pair<uint32_t, bool>> cur;
+    std::unordered_map<uint64_t, uint32_t> atom_sets;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> by_hash;
+    std::unordered_map<uint64_t, uint32_t> union_cache;
+    std::vector<uint32_t> temp;
+
+    static uint64_t hash(const std::vector<uint32_t> &v) {
+        uint64_t h = v.size();
+        for (uint32_t x : v) {
+            h ^= x + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+
+    uint32_t intern(const std::vector<uint32_t> &v) {
+        uint64_t h = hash(v);
+        std::vector<uint32_t> &ids = by_hash[h];
+        for (uint32_t id : ids) {
+            if (S.sets[id] == v) return id;
+        }
+        S.sets.push_back(v);
+        ids.push_back(S.sets.size() - 1);
+        return S.sets.size() - 1;
+    }
+
+    uint32_t singleton(uint64_t atom) {
+        auto it = atom_sets.find(atom);
+        if (it != atom_sets.end()) return it->second;
+        S.atoms.push_back(atom);
+        uint32_t set = intern(std::vector<uint32_t>{(uint32_t)(S.atoms.size() - 1)});
+        atom_sets.emplace(atom, set);
+        return set;
+    }
+};
+
+static void summarize(const Trace &t, Summary &s) {
+    Summarizer sz(s);
+    for (uint64_t i = s.first_op; i < s.end_op; i++) {
+        run_op(sz, t.ops[i], i);
+    }
+    sz.finish();
+}
+
+// Chunks start at instruction stamps, so every chunk knows its instr.
+static std::vector<Summary> make_chunks(const Trace &t, uint64_t chunk_ops) {
+    std::vector<Summary> chunks;
+    uint64_t start = 0;
+    while (start < t.num_ops) {
+        uint64_t end = std::min(start + chunk_ops, t.num_ops);
+        while (end < t.num_ops && t.ops[end].type != TT_INSTR) end++;
+        chunks.emplace_back();
+        chunks.back().first_op = start;
+        chunks.back().end_op = end;
+        start = end;
+    }
+    return chunks;
+}
+
+static void summarize_all(const Trace &t, std::vector<Summary> &chunks,
+                          unsigned nthreads) {
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+        size_t i;
+        while ((i = next++) < chunks.size()) summarize(t, chunks[i]);
+    };
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < nthreads; i++) threads.emplace_back(work);
+    for (auto &th : threads) th.join();
+}
+
+/* ******************************************************************
+ Queries
+****************************************************************** */
+
+struct LabelGroups {
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+
+    uint64_t mask(uint64_t label) const {
+        uint64_t m = 0;
+        for (size_t i = 0; i < ranges.size(); i++) {
+            if (ranges[i].first <= label && label <= ranges[i].second) m |= 1ULL << i;
+        }
+        return m;
+    }
+};
+
+static void print_branch(uint64_t op, uint64_t instr, Loc l, uint64_t mask) {
+    printf("branch op=%" PRIu64 " instr=%" PRIu64 " %s=0x%" PRIx64
+           " groups=0x%" PRIx64 "\n", op, instr, shad_names[loc_shad(l)],
+           loc_addr(l), mask);
+}
+
+// RAM locations with their group masks, coalesced into ranges
+static void print_ram(const std::unordered_map<Loc, uint64_t> &state) {
+    std::vector<std::pair<uint64_t, uint64_t>> ram;
+    for (auto &kvp : state) {
+        if (loc_shad(kvp.first) == TT_SHAD_RAM && kvp.second) {
+            ram.emplace_back(loc_addr(kvp.first), kvp.second);
+        }
+    }
+    std::sort(ram.begin(), ram.end());
+    for (size_t i = 0; i < ram.size(); ) {
+        size_t j = i + 1;
+        while (j < ram.size() && ram[j].first == ram[j - 1].first + 1 &&
+               ram[j].second == ram[i].second) j++;
+        printf("ram 0x%" PRIx64 "-0x%" PRIx64 " groups=0x%" PRIx64 "\n",
+               ram[i].first, ram[j - 1].first, ram[i].second);
+        i = j;
+    }
+}
+
+// Label group masks as values, for interpreting the trace directly.
+class MaskDomain {
+public:
+    uint64_t instr = 0;
+    std::unordered_map<Loc, uint64_t> state;
+
+    explicit MaskDomain(const LabelGroups &g) : groups(g) {}
+
+    uint64_t empty() { return 0; }
+    uint64_t get(Loc l) {
+        auto it = state.find(l);
+        return it == state.end() ? 0 : it->second;
+    }
+    void put(Loc l, uint64_t m) {
+        if (m) state[l] = m;
+        else state.erase(l);
+    }
+    uint64_t join(uint64_t a, uint64_t b) { return a | b; }
+    uint64_t label(uint64_t label) { return groups.mask(label); }
+    void branch(uint64_t op, uint64_t instr, Loc l, uint64_t m) {
+        if (m) print_branch(op, instr, l, m);
+    }
+
+private:
+    const LabelGroups &groups;
+};
+
+static void forward_serial(const Trace &t, const LabelGroups &groups) {
+    MaskDomain d(groups);
+    for (uint64_t i = 0; i < t.num_ops; i++) run_op(d, t.ops[i], i);
+    print_ram(d.state);
+}
+
+static void forward(const std::vector<Summary> &chunks, const LabelGroups &groups) {
+    std::unordered_map<Loc, uint64_t> state;
+    std::vector<uint64_t> atom_mask, set_mask;
+    std::vector<std::pair<Loc, uint64_t>> updates;
+
+    for (const Summary &s : chunks) {
+        atom_mask.resize(s.atoms.size());
+        for (size_t i = 0; i < s.atoms.size(); i++) {
+            uint64_t a = s.atoms[i];
+            if (a & ATOM_LABEL) {
+                atom_mask[i] = groups.mask(a & ~ATOM_LABEL);
+            } else {
+                auto it = state.find(a);
+                atom_mask[i] = it == state.end() ? 0 : it->second;
+            }
+        }
+        set_mask.resize(s.sets.size());
+        for (size_t i = 0; i < s.sets.size(); i++) {
+            uint64_t m = 0;
+            for (uint32_t a : s.sets[i]) m |= atom_mask[a];
+            set_mask[i] = m;
+        }
+
+        for (const BranchEvent &b : s.branches) {
+            if (set_mask[b.set]) print_branch(b.op, b.instr, b.loc, set_mask[b.set]);
+        }
+
+        // every value depends on the state at the start of the chunk, so
+        // apply the writes only after evaluating all of them
+        updates.clear();
+        for (auto &kvp : s.writes) updates.emplace_back(kvp.first, set_mask[kvp.second]);
+        for (auto &u : updates) {
+            if (u.second) state[u.first] = u.second;
+            else state.erase(u.first);
+        }
+    }
+    print_ram(state);
+}
+
+// Walks the locations in locs back from the end of chunk c to the start of
+// the trace, collecting the labels that flow into them.
+static void backward(const std::vector<Summary> &chunks, long c,
+                     std::set<Loc> locs, std::set<uint64_t> &labels) {
+    std::set<Loc> prev;
+    for (; c >= 0 && !locs.empty(); c--) {
+        const Summary &s = chunks[c];
+        prev.clear();
+        for (Loc l : locs) {
+            auto it = s.writes.find(l);
+            if (it == s.writes.end()) {
+                prev.insert(l);
+                continue;
+            }
+            for (uint32_t a : s.sets[it->second]) {
+                uint64_t atom = s.atoms[a];
+                if (atom & ATOM_LABEL) labels.insert(atom & ~ATOM_LABEL);
+                else prev.insert(atom);
+            }
+        }
+        locs.swap(prev);
+    }
+}
+
+static bool backward_query(const std::vector<Summary> &chunks, const char *what) {
+    std::set<Loc> locs;
+    std::set<uint64_t> labels;
+    long c = (long)chunks.size() - 1;
+    uint64_t op, addr, len;
+
+    if (sscanf(what, "op=%" SCNu64, &op) == 1) {
+        // the chunk holding the op, and the branch in it
+        auto it = std::upper_bound(chunks.begin(), chunks.end(), op,
+            [](uint64_t o, const Summary &s) { return o < s.first_op; });
+        if (it == chunks.begin() || op >= chunks.back().end_op) {
+            fprintf(stderr, "no op %" PRIu64 " in the trace\n", op);
+            return false;
+        }
+        const Summary &s = *(it - 1);
+        c = it - 1 - chunks.begin();
+        for (const BranchEvent &b : s.branches) {
+            if (b.op != op) continue;
+            for (uint32_t a : s.sets[b.set]) {
+                uint64_t atom = s.atoms[a];
+                if (atom & ATOM_LABEL) labels.insert(atom & ~ATOM_LABEL);
+                else locs.insert(atom);
+            }
+        }
+        c--;
+    } else if (sscanf(what, "ram=%" SCNx64 "+%" SCNu64, &addr, &len) == 2) {
+        for (uint64_t i = 0; i < len; i++) locs.insert(make_loc(TT_SHAD_RAM, addr + i));
+    } else {
+        fprintf(stderr, "backward query must be op=N or ram=ADDR+LEN\n");
+        return false;
+    }
+
+    backward(chunks, c, locs, labels);
+    for (uint64_t l : labels) printf("label %" PRIu64 "\n", l);
+    return true;
+}
+
+static bool parse_groups(int argc, char **argv, LabelGroups &groups) {
+    for (int i = 0; i < argc; i++) {
+        uint32_t lo, hi;
+        int n = sscanf(argv[i], "%u-%u", &lo, &hi);
+        if (n == 1) hi = lo;
+        if (n < 1 || hi < lo) {
+            fprintf(stderr, "bad label range %s\n", argv[i]);
+            return false;
+        }
+        groups.ranges.emplace_back(lo, hi);
+    }
+    if (groups.ranges.empty() || groups.ranges.size() > 64) {
+        fprintf(stderr, "forward needs 1 to 64 label ranges\n");
+        return false;
+    }
+    return true;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "usage: %s [-j threads] [-c chunk_ops] [-s] trace forward LO[-HI]...\n"
+        "       %s [-j threads] [-c chunk_ops] trace backward op=N|ram=ADDR+LEN\n",
+        prog, prog);
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    unsigned nthreads = std::thread::hardware_concurrency();
+    uint64_t chunk_ops = 1 << 20;
+    bool serial = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "j:c:s")) != -1) {
+        switch (opt) {
+            case 'j': nthreads = strtoul(optarg, NULL, 0); break;
+            case 'c': chunk_ops = strtoull(optarg, NULL, 0); break;
+            case 's': serial = true; break;
+            default: usage(argv[0]);
+        }
+    }
+    if (argc - optind < 3) usage(argv[0]);
+    if (nthreads == 0) nthreads = 1;
+    if (chunk_ops == 0) chunk_ops = 1;
+
+    Trace t;
+    if (!t.open(argv[optind])) return 1;
+    const char *query = argv[optind + 1];
+    bool is_forward = 0 == strcmp(query, "forward");
+    if (!is_forward && strcmp(query, "backward") != 0) usage(argv[0]);
+
+    LabelGroups groups;
+    if (is_forward && !parse_groups(argc - optind - 2, argv + optind + 2, groups)) {
+        return 1;
+    }
+    if (is_forward && serial) {
+        forward_serial(t, groups);
+        return 0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Summary> chunks = make_chunks(t, chunk_ops);
+    summarize_all(t, chunks, nthreads);
+    double secs = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    fprintf(stderr, "summarized %" PRIu64 " ops in %zu chunks on %u threads "
+            "in %.2fs\n", t.num_ops, chunks.size(), nthreads, secs);
+
+    if (is_forward) {
+        forward(chunks, groups);
+        return 0;
+    }
+    return backward_query(chunks, argv[optind + 2]) ? 0 : 1;
+}
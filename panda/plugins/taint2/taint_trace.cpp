@@ -0,0 +1,152 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "taint2.h"
+#include "taint_trace.h"
+
+extern ShadowState *shadow;
+
+bool taint_trace_on = false;
+
+static FILE *trace_file = NULL;
+static std::vector<TaintTraceOp> trace_buf;
+static size_t trace_used = 0;
+static uint64_t trace_ops = 0;
+static uint64_t trace_last_instr = ~0ULL;
+
+#define TAINT_TRACE_BUF_OPS (1 << 16)
+
+static uint8_t shad_id(Shad *shad) {
+    if (shad == nullptr) return TT_SHAD_NONE;
+    if (shad == shadow->ram) return TT_SHAD_RAM;
+    if (shad == shadow->llv) return TT_SHAD_LLV;
+    if (shad == shadow->ret) return TT_SHAD_RET;
+    if (shad == shadow->grv) return TT_SHAD_GRV;
+    if (shad == shadow->gsv) return TT_SHAD_GSV;
+    if (shad == &shadow->hd) return TT_SHAD_HD;
+    if (shad == &shadow->io) return TT_SHAD_IO;
+    tassert(false && "taint trace: unknown shadow");
+    return TT_SHAD_NONE;
+}
+
+static inline uint64_t abs_addr(Shad *shad, uint64_t addr) {
+    return shad ? shad->frame_base() + addr : addr;
+}
+
+static void flush(void) {
+    if (trace_used) {
+        fwrite(trace_buf.data(), sizeof(TaintTraceOp), trace_used, trace_file);
+        trace_ops += trace_used;
+        trace_used = 0;
+    }
+}
+
+static inline TaintTraceOp *next_op(void) {
+    if (trace_used == trace_buf.size()) flush();
+    return &trace_buf[trace_used++];
+}
+
+// Ops are stamped with the instruction count of the block they're in.
+static inline void stamp(void) {
+    uint64_t instr = rr_get_guest_instr_count();
+    if (instr != trace_last_instr) {
+        trace_last_instr = instr;
+        TaintTraceOp *op = next_op();
+        memset(op, 0, sizeof(*op));
+        op->type = TT_INSTR;
+        op->dest_shad = op->src_shad = op->src2_shad = TT_SHAD_NONE;
+        op->dest = instr;
+    }
+}
+
+void taint_trace_op(TaintTraceOpType type,
+                    Shad *dest, uint64_t dest_addr, uint64_t dest_size,
+                    Shad *src, uint64_t src_addr, uint64_t src_size,
+                    Shad *src2, uint64_t src2_addr, uint64_t src2_size) {
+    stamp();
+    TaintTraceOp *op = next_op();
+    op->type = type;
+    op->dest_shad = shad_id(dest);
+    op->src_shad = shad_id(src);
+    op->src2_shad = shad_id(src2);
+    op->dest_size = dest_size;
+    op->src_size = src_size;
+    op->src2_size = src2_size;
+    op->dest = abs_addr(dest, dest_addr);
+    op->src = abs_addr(src, src_addr);
+    op->src2 = abs_addr(src2, src2_addr);
+}
+
+void taint_trace_label(Shad *dest, uint64_t dest_addr, uint64_t size,
+                       uint32_t label, bool positional, bool additive) {
+    stamp();
+    TaintTraceOp *op = next_op();
+    op->type = additive ? TT_LABEL_ADD : TT_LABEL;
+    op->dest_shad = shad_id(dest);
+    op->src_shad = op->src2_shad = TT_SHAD_NONE;
+    op->dest_size = size;
+    op->src_size = op->src2_size = 0;
+    op->dest = abs_addr(dest, dest_addr);
+    op->src = label;
+    op->src2 = positional;
+}
+
+void taint_trace_save(Shad *shad, uint64_t addr, uint64_t size,
+                      uint64_t slot, bool restore) {
+    stamp();
+    TaintTraceOp *op = next_op();
+    memset(op, 0, sizeof(*op));
+    op->type = TT_COPY;
+    op->src2_shad = TT_SHAD_NONE;
+    op->dest_size = op->src_size = size;
+    if (restore) {
+        op->dest_shad = shad_id(shad);
+        op->dest = abs_addr(shad, addr);
+        op->src_shad = TT_SHAD_SAVED;
+        op->src = slot;
+    } else {
+        op->dest_shad = TT_SHAD_SAVED;
+        op->dest = slot;
+        op->src_shad = shad_id(shad);
+        op->src = abs_addr(shad, addr);
+    }
+}
+
+bool taint_trace_open(const char *path) {
+    trace_file = fopen(path, "wb");
+    if (trace_file == NULL) {
+        fprintf(stderr, PANDA_MSG "couldn't open taint op trace %s\n", path);
+        return false;
+    }
+    uint32_t version = TAINT_TRACE_VERSION;
+    uint32_t record_size = sizeof(TaintTraceOp);
+    fwrite(TAINT_TRACE_MAGIC, 8, 1, trace_file);
+    fwrite(&version, sizeof(version), 1, trace_file);
+    fwrite(&record_size, sizeof(record_size), 1, trace_file);
+    trace_buf.resize(TAINT_TRACE_BUF_OPS);
+    taint_trace_on = true;
+    return true;
+}
+
+void taint_trace_close(void) {
+    if (!taint_trace_on) return;
+    taint_trace_on = false;
+    flush();
+    fclose(trace_file);
+    trace_file = NULL;
+    fprintf(stderr, PANDA_MSG "wrote %" PRIu64 " taint ops to the op trace\n",
+            trace_ops);
+    std::vector<TaintTraceOp>().swap(trace_buf);
+}
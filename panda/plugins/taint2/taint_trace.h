@@ -0,0 +1,125 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+/*
+ * Taint operation trace.
+ *
+ * With taint2:op_trace=<file>, every taint operation the instrumented code
+ * performs is also written out, with concrete shadow addresses, as a fixed
+ * size record. The trace doesn't depend on what is tainted: it records the
+ * data flow, and the taint_query tool (taint_query/) answers forward and
+ * backward taint questions over it afterwards, so one replay serves any
+ * number of source/sink choices.
+ *
+ * File layout:
+ *
+ *   char magic[8]         TAINT_TRACE_MAGIC
+ *   u32 version           TAINT_TRACE_VERSION
+ *   u32 record_size       sizeof(TaintTraceOp)
+ *   TaintTraceOp ops[]
+ *
+ * Operands are (shadow, addr, size) triples; LLVM register addresses are
+ * absolute, i.e. include the current frame. Semantics, with "mix" the union
+ * of all labels in a range:
+ *
+ *   TT_COPY      dest[i] = src[i]
+ *   TT_PCOMPUTE  dest[i] = src[i] | src2[i]
+ *   TT_MCOMPUTE  dest[*] = mix(src) | mix(src2)
+ *   TT_MIX       dest[*] = mix(src)
+ *   TT_SET       dest[*] = src[0]
+ *   TT_POINTER   dest[i] = src[i] | mix(src2)   (src2 is the pointer, src
+ *                                                may be TT_SHAD_NONE)
+ *   TT_DELETE    dest[*] = {}
+ *   TT_LABEL     dest[i] = {src (+ i if src2)}
+ *   TT_LABEL_ADD dest[i] |= {src (+ i if src2)}
+ *   TT_BRANCH    branch on mix(src)
+ *   TT_INSTR     guest instruction count is now dest
+ *
+ * TT_SHAD_SAVED holds taint that taint2 sets aside and puts back later (the
+ * i386 condition code taint around cpu_exec exits); saving and restoring it
+ * are traced as TT_COPYs to and from that shadow.
+ *
+ * Control bit masks and taint compute numbers aren't traced. Multiplies are
+ * traced as TT_MCOMPUTE, which over-approximates the "times untainted 0 or
+ * 1" special cases.
+ */
+
+#ifndef __TAINT_TRACE_H_
+#define __TAINT_TRACE_H_
+
+#include <cstdint>
+
+#define TAINT_TRACE_MAGIC "PANDATOT"
+#define TAINT_TRACE_VERSION 2
+
+enum TaintTraceShad {
+    TT_SHAD_RAM,
+    TT_SHAD_LLV,
+    TT_SHAD_RET,
+    TT_SHAD_GRV,
+    TT_SHAD_GSV,
+    TT_SHAD_HD,
+    TT_SHAD_IO,
+    TT_SHAD_SAVED,
+    TT_SHAD_COUNT,
+    TT_SHAD_NONE = 0xff,
+};
+
+enum TaintTraceOpType {
+    TT_COPY,
+    TT_PCOMPUTE,
+    TT_MCOMPUTE,
+    TT_MIX,
+    TT_SET,
+    TT_POINTER,
+    TT_DELETE,
+    TT_LABEL,
+    TT_LABEL_ADD,
+    TT_BRANCH,
+    TT_INSTR,
+};
+
+struct TaintTraceOp {
+    uint8_t type;
+    uint8_t dest_shad;
+    uint8_t src_shad;
+    uint8_t src2_shad;
+    uint32_t dest_size;
+    uint32_t src_size;
+    uint32_t src2_size;
+    uint64_t dest;
+    uint64_t src;
+    uint64_t src2;
+};
+
+#ifndef TAINT_TRACE_NO_RECORDER
+
+class Shad;
+
+extern bool taint_trace_on;
+
+bool taint_trace_open(const char *path);
+void taint_trace_close(void);
+
+// Shadow addresses are frame relative, as the taint ops get them.
+void taint_trace_op(TaintTraceOpType type,
+                    Shad *dest, uint64_t dest_addr, uint64_t dest_size,
+                    Shad *src, uint64_t src_addr, uint64_t src_size,
+                    Shad *src2 = nullptr, uint64_t src2_addr = 0,
+                    uint64_t src2_size = 0);
+void taint_trace_label(Shad *dest, uint64_t dest_addr, uint64_t size,
+                       uint32_t label, bool positional, bool additive);
+// Copy size bytes of shadow to TT_SHAD_SAVED at slot, or back with restore.
+void taint_trace_save(Shad *shad, uint64_t addr, uint64_t size,
+                      uint64_t slot, bool restore);
+
+#define TAINT_TRACE(...) \
+    do { if (unlikely(taint_trace_on)) taint_trace_op(__VA_ARGS__); } while (0)
+
+#endif
+
+#endif
@@ -0,0 +1,204 @@
+/*
+ * label_set_bench.cpp
+ * Microbenchmark comparing the flat, interned label sets in label_set.cpp
+ * against the std::set based label sets taint2 used previously.
+ *
+ * The workload mimics what taint propagation does to label sets: a small
+ * shadow memory is seeded with singleton labels (as file_taint does when
+ * labeling a buffer), then bytes are repeatedly mixed into each other while
+ * fresh labels keep trickling in.  Each implementation is run in its own child process so the
+ * resident memory growth can be reported separately.
+ *
+ * Usage: label_set_bench [num_labels] [num_unions] [max_card] [seed]
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <chrono>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "label_set.h"
+
+// The previous implementation, kept here as the baseline.
+namespace legacy {
+
+typedef const std::set<uint32_t> *LabelSetP;
+
+struct PairHash {
+    size_t operator()(const std::pair<LabelSetP, LabelSetP> &labels) const {
+        return std::hash<LabelSetP>()(labels.first) ^
+            (std::hash<LabelSetP>()(labels.second) << (sizeof(LabelSetP) / 2));
+    }
+};
+
+struct SetHash {
+    size_t operator()(const std::set<uint32_t> &labels) const {
+        uint64_t result = 0;
+        for (uint32_t l : labels) {
+            result ^= l;
+            result = result << 11 | result >> 53;
+        }
+        return result;
+    }
+};
+
+static std::unordered_set<std::set<uint32_t>, SetHash> label_sets;
+static std::unordered_map<std::pair<LabelSetP, LabelSetP>, LabelSetP, PairHash>
+    memoized_unions;
+
+LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
+    if (ls1 == ls2) {
+        return ls1;
+    } else if (ls1 && ls2) {
+        LabelSetP min = std::min(ls1, ls2);
+        LabelSetP max = std::max(ls1, ls2);
+        std::pair<LabelSetP, LabelSetP> minmax(min, max);
+
+        auto it = memoized_unions.find(minmax);
+        if (it != memoized_unions.end()) {
+            return it->second;
+        }
+
+        std::set<uint32_t> temp(*min);
+        for (auto l : *max) {
+            temp.insert(l);
+        }
+
+        LabelSetP result = &(*label_sets.insert(temp).first);
+        memoized_unions.insert(std::make_pair(minmax, result));
+        return result;
+    } else if (ls1) {
+        return ls1;
+    } else {
+        return ls2;
+    }
+}
+
+LabelSetP label_set_singleton(uint32_t label) {
+    // the original arena allocated these; plain new is close enough
+    return new std::set<uint32_t>{label};
+}
+
+} // namespace legacy
+
+#define BENCH_SHADOW_SLOTS 4096
+
+struct Workload {
+    uint32_t num_labels;
+    uint32_t num_unions;
+    uint32_t max_card;
+    uint32_t seed;
+};
+
+// Returns resident set size in bytes.
+static uint64_t rss_bytes() {
+    long pages = 0, resident = 0;
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (f) {
+        if (fscanf(f, "%ld %ld", &pages, &resident) != 2) resident = 0;
+        fclose(f);
+    }
+    return (uint64_t)resident * sysconf(_SC_PAGESIZE);
+}
+
+template <typename SetP, typename Singleton, typename Union, typename Card>
+static void run(const char *name, const Workload &w, Singleton singleton,
+                Union set_union, Card card) {
+    std::mt19937 rng(w.seed);
+
+    // stand-in for shadow memory: a fixed number of bytes, each holding a
+    // label set that gets overwritten as taint propagates
+    std::vector<SetP> shadow(BENCH_SHADOW_SLOTS);
+
+    uint64_t rss_before = rss_bytes();
+    auto start = std::chrono::steady_clock::now();
+
+    uint32_t next_label = 0;
+    for (size_t i = 0; i < shadow.size(); i++) {
+        shadow[i] = singleton(next_label++ % w.num_labels);
+    }
+
+    uint64_t total_card = 0;
+    for (uint32_t i = 0; i < w.num_unions; i++) {
+        // every so often a taint source introduces fresh labels
+        if (i % 16 == 0) {
+            shadow[rng() % shadow.size()] =
+                singleton(next_label++ % w.num_labels);
+        }
+        // mix two bytes into a third, preferring nearby bytes
+        size_t a = rng() % shadow.size();
+        size_t b = (a + rng() % 64) % shadow.size();
+        size_t dest = (rng() % 4 == 0) ? rng() % shadow.size() : b;
+        SetP result = set_union(shadow[a], shadow[b]);
+        total_card += card(result);
+        // like taint2's max_taintset_card, stop tracking sets that get huge
+        shadow[dest] = card(result) > w.max_card ?
+            singleton(next_label++ % w.num_labels) : result;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(end - start).count();
+    uint64_t rss_after = rss_bytes();
+
+    printf("%-8s %10.3f s %10.1f ns/union %10.1f MiB rss growth"
+           "  (avg card %.1f)\n",
+           name, secs, secs * 1e9 / (w.num_unions ? w.num_unions : 1),
+           (rss_after - rss_before) / (1024.0 * 1024.0),
+           w.num_unions ? (double)total_card / w.num_unions : 0.0);
+}
+
+static void run_flat(const Workload &w) {
+    run<LabelSetP>("flat", w, label_set_singleton, label_set_union,
+                   [](LabelSetP ls) { return ls->size(); });
+    LabelSetStats stats = label_set_stats();
+    printf("         %lu sets, %lu arena bytes, %.1f%% union cache hits\n",
+           (unsigned long)stats.num_sets, (unsigned long)stats.arena_bytes,
+           stats.union_calls ?
+               100.0 * stats.union_cache_hits / stats.union_calls : 0.0);
+}
+
+static void run_legacy(const Workload &w) {
+    run<legacy::LabelSetP>("std::set", w, legacy::label_set_singleton,
+                           legacy::label_set_union,
+                           [](legacy::LabelSetP ls) { return ls->size(); });
+    printf("         %lu sets, %lu memoized unions\n",
+           (unsigned long)legacy::label_sets.size(),
+           (unsigned long)legacy::memoized_unions.size());
+}
+
+static void in_child(void (*fn)(const Workload &), const Workload &w) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        fn(w);
+        fflush(stdout);
+        _exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+}
+
+int main(int argc, char **argv) {
+    Workload w;
+    w.num_labels = argc > 1 ? strtoul(argv[1], NULL, 0) : 50000;
+    w.num_unions = argc > 2 ? strtoul(argv[2], NULL, 0) : 200000;
+    w.max_card = argc > 3 ? strtoul(argv[3], NULL, 0) : 64;
+    w.seed = argc > 4 ? strtoul(argv[4], NULL, 0) : 1;
+
+    printf("label_set_bench: %u labels, %u unions, max card %u, seed %u\n",
+           w.num_labels, w.num_unions, w.max_card, w.seed);
+    in_child(run_flat, w);
+    in_child(run_legacy, w);
+    return 0;
+}
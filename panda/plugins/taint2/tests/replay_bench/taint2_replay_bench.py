@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""End-to-end benchmark for taint2 shadow memory configurations.
+
+Replays the same recording several times with taint2 loaded, once per
+configuration, and reports wall time, peak resident memory and (if perf is
+available) last level cache misses for each.  By default it compares the
+regular 16 byte shadow entries against the compact 8 byte ones; use
+--config to compare other taint2 arguments, e.g. ram_shad=paged.
+
+Something has to apply taint labels for the comparison to mean anything,
+so pass the labeling plugin through --panda, e.g.
+
+% taint2_replay_bench.py --qemu i386-softmmu/panda-system-i386 \\
+      --replay /path/to/cat_passwd -m 128 \\
+      --panda file_taint:filename=passwd --panda tainted_instr
+
+Anything after the known options is handed to qemu unchanged.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+DEFAULT_CONFIGS = [
+    ("fast", ""),
+    ("compact", "compact=true"),
+]
+
+def run_one(args, name, taint2_args, extra):
+    cmd = [args.qemu, "-replay", args.replay]
+    taint2 = "taint2" + (":" + taint2_args if taint2_args else "")
+    cmd += ["-panda", taint2]
+    for p in args.panda:
+        cmd += ["-panda", p]
+    cmd += extra
+
+    time_out = tempfile.NamedTemporaryFile(suffix=".time", delete=False)
+    time_out.close()
+    wrapped = ["/usr/bin/time", "-v", "-o", time_out.name]
+    perf_out = None
+    if args.perf and shutil.which("perf"):
+        perf_out = tempfile.NamedTemporaryFile(suffix=".perf", delete=False)
+        perf_out.close()
+        wrapped += ["perf", "stat", "-x", ",", "-o", perf_out.name,
+                    "-e", "cache-references,cache-misses,LLC-load-misses"]
+    wrapped += cmd
+
+    print("%s: %s" % (name, " ".join(cmd)), file=sys.stderr)
+    start = time.time()
+    with open(os.path.join(args.log_dir, name + ".log"), "w") as log:
+        subprocess.check_call(wrapped, stdout=log, stderr=subprocess.STDOUT)
+    elapsed = time.time() - start
+
+    result = {"name": name, "secs": elapsed, "rss_kb": None}
+    with open(time_out.name) as f:
+        m = re.search(r"Maximum resident set size \(kbytes\): (\d+)", f.read())
+        if m:
+            result["rss_kb"] = int(m.group(1))
+    os.unlink(time_out.name)
+
+    if perf_out:
+        with open(perf_out.name) as f:
+            for line in f:
+                fields = line.strip().split(",")
+                if len(fields) > 2 and fields[0].isdigit():
+                    result[fields[2]] = int(fields[0])
+        os.unlink(perf_out.name)
+    return result
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--qemu", required=True, help="panda-system-* binary")
+    parser.add_argument("--replay", required=True, help="recording name")
+    parser.add_argument("--panda", action="append", default=[],
+            help="additional -panda argument (repeatable)")
+    parser.add_argument("--config", action="append", default=[],
+            metavar="NAME=TAINT2ARGS",
+            help="taint2 configuration to run (repeatable), "
+                 "e.g. paged=ram_shad=paged,compact=true")
+    parser.add_argument("--no-perf", dest="perf", action="store_false",
+            help="don't collect cache statistics with perf")
+    parser.add_argument("--log-dir", default=".",
+            help="where to put the panda output of each run")
+    args, extra = parser.parse_known_args()
+
+    configs = DEFAULT_CONFIGS
+    if args.config:
+        configs = [tuple(c.split("=", 1)) if "=" in c else (c, "")
+                   for c in args.config]
+
+    results = [run_one(args, name, taint2_args, extra)
+               for (name, taint2_args) in configs]
+
+    base = results[0]
+    print("%-12s %10s %12s %16s %16s" %
+          ("config", "time (s)", "max rss (MB)", "cache misses", "LLC load misses"))
+    for r in results:
+        def fmt(key):
+            return "%d" % r[key] if key in r else "-"
+        print("%-12s %10.1f %12s %16s %16s" %
+              (r["name"], r["secs"],
+               "%.1f" % (r["rss_kb"] / 1024.0) if r["rss_kb"] else "-",
+               fmt("cache-misses"), fmt("LLC-load-misses")))
+    for r in results[1:]:
+        if r["rss_kb"] and base["rss_kb"]:
+            print("%s vs %s: %.1f%% of the peak memory, %.2fx the time" %
+                  (r["name"], base["name"], 100.0 * r["rss_kb"] / base["rss_kb"],
+                   r["secs"] / base["secs"]))
+
+if __name__ == "__main__":
+    main()
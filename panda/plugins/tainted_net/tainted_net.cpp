@@ -134,33 +134,47 @@ void taint_network_data(size_t packet_size, uint64_t buf_addr_rec)
         taint2_enable_taint();
     }
 
-    // Loop through each byte in the packet
-    for (uint32_t byte_offset = 0; byte_offset < packet_size; byte_offset++)
+    // Whole packets with uniform or sequential labels are labelled in bulk
+    if (bytes_to_taint.empty() && !semantic_labels &&
+        (!positional_labels || packet_size <= (ONE << packet_size_bits)))
     {
-        // If only specific bytes are to be tainted, check to see if this byte should be tainted
-        if(bytes_to_taint.empty() || (bytes_to_taint.find(byte_offset)!=bytes_to_taint.end()))
+        if (positional_labels)
         {
-            // Label is to be applied, increment the counter.
-            num_labels_applied++;
-
-            if (semantic_labels)
-            {
-                // With semantic labels, increment the counter and write out the packet count and byte offset.
-                // The IDA taint plugin will read this data so semantic labels can be displayed in IDA.
-                label_value=++label_count;
-                assert(fprintf(semantic_labels_file, "%u,%u-%u\n", label_value, packet_count, byte_offset) > 0);
-            }
-            else if (positional_labels)
+            label_value = packet_count << packet_size_bits;
+        }
+        taint2_label_io_range(buf_addr_rec, packet_size, label_value, positional_labels);
+        num_labels_applied = packet_size;
+    }
+    else
+    {
+        // Loop through each byte in the packet
+        for (uint32_t byte_offset = 0; byte_offset < packet_size; byte_offset++)
+        {
+            // If only specific bytes are to be tainted, check to see if this byte should be tainted
+            if(bytes_to_taint.empty() || (bytes_to_taint.find(byte_offset)!=bytes_to_taint.end()))
             {
-                // Compute taint label.
-                // Set the high order bits to be the packet number.
-                // Set the low order bits to be the byte offset.
-                label_value = (packet_count << packet_size_bits) |
-                    (byte_offset & ((ONE << packet_size_bits) - ONE));
-            }
+                // Label is to be applied, increment the counter.
+                num_labels_applied++;
 
-            // Apply taint label
-            taint2_label_io(buf_addr_rec + byte_offset, label_value);
+                if (semantic_labels)
+                {
+                    // With semantic labels, increment the counter and write out the packet count and byte offset.
+                    // The IDA taint plugin will read this data so semantic labels can be displayed in IDA.
+                    label_value=++label_count;
+                    assert(fprintf(semantic_labels_file, "%u,%u-%u\n", label_value, packet_count, byte_offset) > 0);
+                }
+                else if (positional_labels)
+                {
+                    // Compute taint label.
+                    // Set the high order bits to be the packet number.
+                    // Set the low order bits to be the byte offset.
+                    label_value = (packet_count << packet_size_bits) |
+                        (byte_offset & ((ONE << packet_size_bits) - ONE));
+                }
+
+                // Apply taint label
+                taint2_label_io(buf_addr_rec + byte_offset, label_value);
+            }
         }
     }
 
@@ -54,13 +54,14 @@ class hooking_mixins():
 
     def hook(self, addr, enabled=True, kernel=True, libraryname=None, procname=None):
         '''
-        Decorate a function to setup a hook: when a guest goes to execute a basic block beginning with addr,
-        the function will be called with args (CPUState, TranslationBlock)
+        Decorate a function to setup a hook: when a guest goes to execute the instruction at addr,
+        the function will be called with args (CPUState, TranslationBlock). Return True to
+        re-execute from the guest's (possibly changed) program counter
         '''
         if procname:
             self._register_internal_asid_changed_cb()
         def decorator(fun):
-            # Ultimately, our hook resolves as a before_block_exec_invalidate_opt callback so we must match its args
+            # Hooks take the same args as a before_block_exec_invalidate_opt callback
             hook_cb_type = self.callback.before_block_exec_invalidate_opt # (CPUState, TranslationBlock)
 
             if 'hooks' not in self.plugins:
@@ -2,9 +2,12 @@
 
 import sys
 import os
+import mmap
 import zlib
 import struct
 import itertools
+import collections
+from concurrent.futures import ThreadPoolExecutor
 from google.protobuf.json_format import MessageToJson
 from os.path import dirname, join, isdir
 
@@ -43,10 +46,51 @@ if 'plog_pb2' not in sys.modules:
 
 assert 'plog_pb2' in sys.modules, "Couldn't load module plog_pb2. Searched paths:\n\t%s" % "\n\t".join(searched_paths)
 
+# PlCodec values from panda/plog.h
+PL_CODEC_NONE, PL_CODEC_ZLIB, PL_CODEC_ZSTD, PL_CODEC_LZ4 = range(4)
+
+def decompress_chunk(codec, data, size_hint):
+    if codec == PL_CODEC_ZLIB:
+        return zlib.decompress(data, 15, size_hint)
+    if codec == PL_CODEC_NONE:
+        return data
+    if codec == PL_CODEC_ZSTD:
+        import zstandard
+        return zstandard.ZstdDecompressor().decompress(data, max_output_size=size_hint)
+    if codec == PL_CODEC_LZ4:
+        import lz4.frame
+        return lz4.frame.decompress(data)
+    raise ValueError("unknown pandalog codec %d" % codec)
+
+# Sidecar index written next to a log as <log>.idx, see panda/plog-mmap.hpp
+PL_INDEX_MAGIC = b'PLOGIDX1'
+PL_NO_INSTR = (1 << 64) - 1
+
+class PLogChunk:
+    def __init__(self, start_instr, pos, num_entries, zsize):
+        self.start_instr = start_instr
+        self.pos = pos
+        self.num_entries = num_entries
+        self.zsize = zsize
+        # until there's an index, a chunk could hold anything
+        self.first_instr = 0
+        self.last_instr = PL_NO_INSTR
+        self.fields = None
+
 class PLogReader:
+    """
+    Reads a pandalog. Iterating gives every entry in order; the log is also
+    mapped into memory so query() can decompress just the chunks it needs,
+    several at a time, using the <log>.idx sidecar index to skip chunks that
+    can't match.
+    """
     def __init__(self, fn):
+        self.fn = fn
         self.f = open(fn, "rb")
-        self.version, _, self.dir_pos, _, self.chunk_gsize = struct.unpack('<IIQII', self.f.read(24))
+        self.version, _, self.dir_pos, self.chunk_gsize, self.codec = struct.unpack('<IIQII', self.f.read(24))
+        if self.version < 3:
+            # the codec field was added in version 3, before that it's zlib
+            self.codec = PL_CODEC_ZLIB
 
         self.f.seek(self.dir_pos)
         self.nchunks, = struct.unpack('<I', self.f.read(4)) # number of chunks
@@ -55,6 +99,110 @@ class PLogReader:
         self.chunk_size = 0                                 # size of current chunk
         self.chunk_data = None                              # data of current chunk
         self.chunk_data_idx = 0
+        self.mm = mmap.mmap(self.f.fileno(), 0, access=mmap.ACCESS_READ)
+        self.indexed = False
+
+    def chunk_info(self):
+        if not hasattr(self, '_chunk_info'):
+            info = []
+            for i in range(self.nchunks):
+                instr, pos, nentries = struct.unpack_from('<QQQ', self.chunks, 24*i)
+                end = self.dir_pos if i + 1 == self.nchunks else \
+                    struct.unpack_from('<QQQ', self.chunks, 24*(i+1))[1]
+                info.append(PLogChunk(instr, pos, nentries, end - pos))
+            self._chunk_info = info
+        return self._chunk_info
+
+    def read_chunk(self, i):
+        c = self.chunk_info()[i]
+        return decompress_chunk(self.codec, self.mm[c.pos:c.pos + c.zsize], self.chunk_gsize)
+
+    def chunk_entries(self, i):
+        """ Packed entries of chunk i """
+        data = self.read_chunk(i)
+        idx = 0
+        for _ in range(self.chunk_info()[i].num_entries):
+            msg_size, = struct.unpack_from('<I', data, idx)
+            yield data[idx + 4:idx + 4 + msg_size]
+            idx += 4 + msg_size
+
+    def load_index(self):
+        """ Use <log>.idx if it is there and matches this log """
+        try:
+            with open(self.fn + '.idx', 'rb') as f:
+                data = f.read()
+        except IOError:
+            return False
+        magic, dir_pos, nchunks, _ = struct.unpack_from('<8sQII', data, 0)
+        if magic != PL_INDEX_MAGIC or dir_pos != self.dir_pos or nchunks != self.nchunks:
+            return False
+        off = 24
+        for c in self.chunk_info():
+            c.first_instr, c.last_instr, nfields = struct.unpack_from('<QQI', data, off)
+            off += 20
+            c.fields = set(struct.unpack_from('<%dI' % nfields, data, off))
+            off += 4 * nfields
+        self.indexed = True
+        return True
+
+    def build_index(self, workers=4):
+        """ Scan every chunk to record its instr range and fields """
+        def index_chunk(i):
+            c = self.chunk_info()[i]
+            c.first_instr, c.last_instr, c.fields = PL_NO_INSTR, 0, set()
+            for packed in self.chunk_entries(i):
+                msg = plog_pb2.LogEntry()
+                msg.MergeFromString(packed)
+                c.fields.update(fd.number for fd, _ in msg.ListFields())
+                # the bogus entry opening every log has instr -1
+                if msg.instr != PL_NO_INSTR:
+                    c.first_instr = min(c.first_instr, msg.instr)
+                    c.last_instr = max(c.last_instr, msg.instr)
+        with ThreadPoolExecutor(workers) as ex:
+            list(ex.map(index_chunk, range(self.nchunks)))
+        self.indexed = True
+
+    def save_index(self):
+        out = [struct.pack('<8sQII', PL_INDEX_MAGIC, self.dir_pos, self.nchunks, 0)]
+        for c in self.chunk_info():
+            fields = sorted(c.fields)
+            out.append(struct.pack('<QQI%dI' % len(fields), c.first_instr, c.last_instr,
+                                   len(fields), *fields))
+        with open(self.fn + '.idx', 'wb') as f:
+            f.write(b''.join(out))
+
+    def query(self, field=None, start_instr=0, end_instr=PL_NO_INSTR, workers=4):
+        """
+        Yields, in log order, the entries with instr in [start_instr, end_instr]
+        that have field (a LogEntry field name, or None for any). Chunks are
+        decompressed by a pool of threads, at most 2*workers ahead of the
+        consumer; load_index() or build_index() first to skip the chunks that
+        can't match.
+        """
+        num = None
+        if field is not None:
+            num = plog_pb2.LogEntry.DESCRIPTOR.fields_by_name[field].number
+        chunks = [i for i, c in enumerate(self.chunk_info())
+                  if c.first_instr <= end_instr and c.last_instr >= start_instr
+                  and (num is None or not self.indexed or num in c.fields)]
+        ahead = 2 * workers
+        with ThreadPoolExecutor(workers) as ex:
+            pending = collections.deque()
+            todo = iter(chunks)
+            for i in itertools.islice(todo, ahead):
+                pending.append(ex.submit(lambda i: list(self.chunk_entries(i)), i))
+            while pending:
+                entries = pending.popleft().result()
+                for i in itertools.islice(todo, 1):
+                    pending.append(ex.submit(lambda i: list(self.chunk_entries(i)), i))
+                for packed in entries:
+                    msg = plog_pb2.LogEntry()
+                    msg.MergeFromString(packed)
+                    if not start_instr <= msg.instr <= end_instr:
+                        continue
+                    if num is not None and not any(fd.number == num for fd, _ in msg.ListFields()):
+                        continue
+                    yield msg
 
     def __iter__(self):
         return self
@@ -63,8 +211,9 @@ class PLogReader:
         return self
 
     def __exit__(self, exc_type, exc_val, exc_tb):
+        self.mm.close()
         self.f.close()
-        self.f = self.chunk_data = None
+        self.f = self.mm = self.chunk_data = None
 
     def __next__(self):
         # ran out of chunks
@@ -78,13 +227,12 @@ class PLogReader:
                 nxt = struct.unpack_from('<QQQ', self.chunks, 24*(self.chunk_idx+1))
                 zchunk_size = nxt[1] - cur[1]
             else:
-                # setting the compressed chunk size to -1 will
-                # result in reading the remaining of the file
-                zchunk_size = -1
+                # the last chunk ends where the directory starts
+                zchunk_size = self.dir_pos - cur[1]
 
             # read and decompress chunk data
             self.f.seek(cur[1])
-            self.chunk_data = zlib.decompress(self.f.read(zchunk_size), 15, self.chunk_gsize)
+            self.chunk_data = decompress_chunk(self.codec, self.f.read(zchunk_size), self.chunk_gsize)
             self.chunk_size = len(self.chunk_data)
             self.chunk_data_idx = 0
 
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+'''
+Columnar export of pandalogs.
+
+Loading a pandalog one protobuf at a time is far slower than the replay
+that wrote it. This turns selected LogEntry fields (asid_info,
+tainted_instr, syscall, ...) into one Parquet file each: a row per entry,
+keyed and sorted by (instr, pc), with one typed column per field of the
+sub-message. Sub-messages become structs, and repeated fields become lists.
+A sub-message field that is itself called instr or pc (e.g. the pc of a
+tainted_mmio_label) gets a column named after both, tainted_mmio_label_pc.
+
+Conversion follows PandaLog chunk boundaries. Chunks are decompressed and
+converted by a pool of processes, and each chunk becomes one row group.
+If the log has a <log>.idx sidecar (see plog.py), chunks without any of
+the selected fields are skipped.
+
+ColumnWriter can also be fed LogEntry messages directly, e.g. from a
+pypanda analysis, to write the same files without a pandalog in between.
+
+Needs pyarrow.
+
+    python3 plog_columns.py [-j N] [--codec zstd] log.plog outdir asid_info syscall
+'''
+
+import os
+import argparse
+import itertools
+import collections
+from concurrent.futures import ProcessPoolExecutor
+
+import pyarrow as pa
+import pyarrow.parquet as pq
+from google.protobuf.descriptor import FieldDescriptor as FD
+
+try:
+    from .plog import PLogReader, plog_pb2
+except ImportError:
+    from plog import PLogReader, plog_pb2
+
+_SCALAR_TYPES = {
+    FD.TYPE_INT32: pa.int32(),  FD.TYPE_SINT32: pa.int32(),  FD.TYPE_SFIXED32: pa.int32(),
+    FD.TYPE_UINT32: pa.uint32(), FD.TYPE_FIXED32: pa.uint32(),
+    FD.TYPE_INT64: pa.int64(),  FD.TYPE_SINT64: pa.int64(),  FD.TYPE_SFIXED64: pa.int64(),
+    FD.TYPE_UINT64: pa.uint64(), FD.TYPE_FIXED64: pa.uint64(),
+    FD.TYPE_BOOL: pa.bool_(), FD.TYPE_FLOAT: pa.float32(), FD.TYPE_DOUBLE: pa.float64(),
+    FD.TYPE_STRING: pa.string(), FD.TYPE_BYTES: pa.binary(), FD.TYPE_ENUM: pa.int32(),
+}
+
+SORT_KEY = ['instr', 'pc']
+
+def _is_repeated(fd):
+    r = getattr(fd, 'is_repeated', None)   # newer protobuf dropped label
+    return r if r is not None else fd.label == FD.LABEL_REPEATED
+
+def _arrow_type(fd):
+    if fd.type == FD.TYPE_MESSAGE:
+        t = pa.struct([pa.field(f.name, _arrow_type(f)) for f in fd.message_type.fields])
+    else:
+        t = _SCALAR_TYPES[fd.type]
+    return pa.list_(t) if _is_repeated(fd) else t
+
+def _value(fd, v):
+    return _to_dict(v) if fd.type == FD.TYPE_MESSAGE else v
+
+def _to_dict(msg):
+    ''' msg as nested dicts, with None for unset optional fields '''
+    d = {}
+    for fd in msg.DESCRIPTOR.fields:
+        v = getattr(msg, fd.name)
+        if _is_repeated(fd):
+            d[fd.name] = [_value(fd, x) for x in v]
+        elif msg.HasField(fd.name):
+            d[fd.name] = _value(fd, v)
+        else:
+            d[fd.name] = None
+    return d
+
+def _column_name(name, f):
+    ''' column for field f of LogEntry field name's sub-message '''
+    return name + '_' + f.name if f.name in SORT_KEY else f.name
+
+def _columns(name):
+    ''' (column name, arrow type) for the export of LogEntry field name '''
+    fd = plog_pb2.LogEntry.DESCRIPTOR.fields_by_name[name]
+    cols = [('instr', pa.uint64()), ('pc', pa.uint64())]
+    if fd.type == FD.TYPE_MESSAGE:
+        cols += [(_column_name(name, f), _arrow_type(f)) for f in fd.message_type.fields]
+    else:
+        cols.append(('value', _SCALAR_TYPES[fd.type]))
+    return cols
+
+def schema(name):
+    return pa.schema([pa.field(c, t) for c, t in _columns(name)])
+
+class _Rows:
+    ''' Column-wise buffer of the rows for one exported field '''
+    def __init__(self, name):
+        fd = plog_pb2.LogEntry.DESCRIPTOR.fields_by_name[name]
+        self.name = name
+        self.repeated = _is_repeated(fd)
+        self.is_msg = fd.type == FD.TYPE_MESSAGE
+        self.cols = _columns(name)
+        self.data = {c: [] for c, _ in self.cols}
+
+    def add(self, entry):
+        if self.repeated:
+            items = getattr(entry, self.name)
+        elif entry.HasField(self.name):
+            items = [getattr(entry, self.name)]
+        else:
+            return
+        for item in items:
+            self.data['instr'].append(entry.instr)
+            self.data['pc'].append(entry.pc)
+            if self.is_msg:
+                for fd in item.DESCRIPTOR.fields:
+                    v = getattr(item, fd.name)
+                    if _is_repeated(fd):
+                        v = [_value(fd, x) for x in v]
+                    elif item.HasField(fd.name):
+                        v = _value(fd, v)
+                    else:
+                        v = None
+                    self.data[_column_name(self.name, fd)].append(v)
+            else:
+                self.data['value'].append(item)
+
+    def __len__(self):
+        return len(self.data['instr'])
+
+    def table(self):
+        t = pa.table([pa.array(self.data[c], type=t) for c, t in self.cols],
+                     schema=schema(self.name))
+        self.data = {c: [] for c, _ in self.cols}
+        return t
+
+class ColumnWriter:
+    '''
+    Writes <outdir>/<field>.parquet for each selected LogEntry field. Feed it
+    entries in log order with add(), and it writes a row group every
+    rows_per_group rows of a field, or on flush().
+    '''
+    def __init__(self, outdir, fields, codec='zstd', rows_per_group=1 << 20):
+        os.makedirs(outdir, exist_ok=True)
+        self.rows_per_group = rows_per_group
+        self.rows = {f: _Rows(f) for f in fields}
+        self.writers = {}
+        for f in fields:
+            cols = [c for c, _ in _columns(f)]
+            opts = dict(
+                compression={c: codec for c in cols},
+                # the sort key is increasing: store it as deltas
+                use_dictionary=[c for c in cols if c not in SORT_KEY],
+                column_encoding={c: 'DELTA_BINARY_PACKED' for c in SORT_KEY},
+            )
+            try:
+                opts['sorting_columns'] = [pq.SortingColumn(0), pq.SortingColumn(1)]
+                self.writers[f] = pq.ParquetWriter(os.path.join(outdir, f + '.parquet'),
+                                                   schema(f), **opts)
+            except (AttributeError, TypeError):
+                # older pyarrow, no sorting column metadata
+                del opts['sorting_columns']
+                self.writers[f] = pq.ParquetWriter(os.path.join(outdir, f + '.parquet'),
+                                                   schema(f), **opts)
+
+    def add(self, entry):
+        for f, rows in self.rows.items():
+            rows.add(entry)
+            if len(rows) >= self.rows_per_group:
+                self.writers[f].write_table(rows.table())
+
+    def write_tables(self, tables):
+        ''' Append already converted tables, {field: pyarrow.Table} '''
+        for f, t in tables.items():
+            if t.num_rows:
+                self.writers[f].write_table(t)
+
+    def flush(self):
+        for f, rows in self.rows.items():
+            if len(rows):
+                self.writers[f].write_table(rows.table())
+
+    def close(self):
+        self.flush()
+        for w in self.writers.values():
+            w.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.close()
+
+_worker_reader = None
+
+def _convert_chunk(fn, i, fields):
+    global _worker_reader
+    if _worker_reader is None or _worker_reader.fn != fn:
+        _worker_reader = PLogReader(fn)
+    rows = {f: _Rows(f) for f in fields}
+    for packed in _worker_reader.chunk_entries(i):
+        entry = plog_pb2.LogEntry()
+        entry.MergeFromString(packed)
+        for r in rows.values():
+            r.add(entry)
+    return {f: r.table() for f, r in rows.items()}
+
+def export(fn, outdir, fields, workers=os.cpu_count(), codec='zstd'):
+    ''' Convert pandalog fn, one chunk per task, into outdir '''
+    with PLogReader(fn) as plr:
+        plr.load_index()
+        nums = set(plog_pb2.LogEntry.DESCRIPTOR.fields_by_name[f].number for f in fields)
+        chunks = [i for i, c in enumerate(plr.chunk_info())
+                  if not plr.indexed or nums & c.fields]
+    with ColumnWriter(outdir, fields, codec) as w, ProcessPoolExecutor(workers) as ex:
+        # submitted in order and written in order, so row groups stay sorted;
+        # at most 2*workers converted chunks are held at once
+        pending = collections.deque()
+        todo = iter(chunks)
+        for i in itertools.islice(todo, 2 * workers):
+            pending.append(ex.submit(_convert_chunk, fn, i, fields))
+        while pending:
+            tables = pending.popleft().result()
+            for i in itertools.islice(todo, 1):
+                pending.append(ex.submit(_convert_chunk, fn, i, fields))
+            w.write_tables(tables)
+
+if __name__ == '__main__':
+    ap = argparse.ArgumentParser(description='Export pandalog fields as Parquet')
+    ap.add_argument('plog')
+    ap.add_argument('outdir')
+    ap.add_argument('fields', nargs='+', help='LogEntry fields, e.g. asid_info syscall')
+    ap.add_argument('-j', '--jobs', type=int, default=os.cpu_count())
+    ap.add_argument('--codec', default='zstd', help='Parquet column compression')
+    args = ap.parse_args()
+    export(args.plog, args.outdir, args.fields, args.jobs, args.codec)
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+'''
+Replay a recording with a hook that asks for its instruction to be re-executed.
+
+A restarting hook must not change the guest instruction count, or the replay
+drifts from its recording. Replay once without hooks and once with a hook on
+system_call that always returns True; both must end at the same count.
+'''
+
+from os import remove, path
+from panda import Panda, blocking
+
+arch = "i386"
+panda = Panda(generic=arch)
+
+recording_name = "hook_restart.recording"
+for f in [recording_name+"-rr-nondet.log", recording_name+"-rr-snp"]:
+    if path.isfile(f): remove(f)
+
+####################### Symbols and recording ####################
+kallsyms = {}
+@blocking
+def record_with_symbols():
+    global kallsyms
+    panda.revert_sync("root")
+    syms = panda.run_serial_cmd("cat /boot/System.map*")
+    for line in syms.split("\n"):
+        line = line.strip()
+        kallsyms[line.split(" ")[-1]] = int(line.split(" ")[0], 16)
+    panda.record_cmd("cat /proc/self/environ; ls /", recording_name=recording_name)
+    panda.stop_run()
+
+panda.queue_async(record_with_symbols)
+panda.run()
+assert('system_call' in kallsyms), "Couldn't find system_call"
+
+####################### Replays ####################
+syscalls = []
+last_count = 0
+
+@panda.cb_before_block_exec()
+def before_block_exec(env, tb):
+    global last_count
+    last_count = panda.rr_get_guest_instr_count()
+
+def replay():
+    global last_count
+    last_count = 0
+    panda.run_replay(recording_name)
+    return last_count
+
+plain_count = replay()
+
+restarts = 0
+@panda.hook(kallsyms["system_call"])
+def restart_hook(env, tb):
+    global restarts
+    # Each hit restarts once; the hooks plugin doesn't call us again for the
+    # re-execution of the same instruction.
+    restarts += 1
+    syscalls.append((env.env_ptr.regs[0], panda.rr_get_guest_instr_count()))
+    return True
+
+hooked_count = replay()
+
+assert(restarts > 0), "Restarting hook never ran"
+assert(hooked_count == plain_count), \
+    f"Replay with restarting hook ended at {hooked_count}, expected {plain_count}"
+assert(len(set(syscalls)) == len(syscalls)), \
+    "Restarted syscalls were counted twice"
+
+for f in [recording_name+"-rr-nondet.log", recording_name+"-rr-snp"]:
+    if path.isfile(f): remove(f)
+
+print(f"Test finished successfully. Hook restarted {restarts} instructions")
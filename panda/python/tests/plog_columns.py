@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+# Export pandalog entries whose sub-messages have their own pc field and
+# check every column comes back with one value per row.
+import tempfile
+from os import path
+
+import pyarrow.parquet as pq
+from panda.plog import plog_pb2
+from panda.plog_columns import ColumnWriter
+
+fields = ['tainted_branch_summary', 'tainted_instr_summary']
+entries = []
+for i in range(3):
+    e = plog_pb2.LogEntry()
+    e.instr = 100 + i
+    e.pc = 0x1000 + i
+    e.tainted_branch_summary.asid = 0x42
+    e.tainted_branch_summary.pc = 0x2000 + i
+    entries.append(e)
+e = plog_pb2.LogEntry()
+e.instr = 200
+e.pc = 0x1100
+e.tainted_instr_summary.asid = 0x43
+e.tainted_instr_summary.pc = 0x3000
+entries.append(e)
+
+with tempfile.TemporaryDirectory() as outdir:
+    with ColumnWriter(outdir, fields) as w:
+        for e in entries:
+            w.add(e)
+
+    t = pq.read_table(path.join(outdir, 'tainted_branch_summary.parquet')).to_pydict()
+    assert t['instr'] == [100, 101, 102], t
+    assert t['pc'] == [0x1000, 0x1001, 0x1002], t
+    assert t['asid'] == [0x42] * 3, t
+    assert t['tainted_branch_summary_pc'] == [0x2000, 0x2001, 0x2002], t
+
+    t = pq.read_table(path.join(outdir, 'tainted_instr_summary.parquet')).to_pydict()
+    assert t['instr'] == [200] and t['pc'] == [0x1100], t
+    assert t['asid'] == [0x43], t
+    assert t['tainted_instr_summary_pc'] == [0x3000], t
+
+print("plog_columns test passed")
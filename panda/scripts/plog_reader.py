@@ -30,10 +30,29 @@ for dc in itertools.product(top_dirs, build_dirs, arch_dirs):
 
 assert 'plog_pb2' in sys.modules, "Couldn't load module plog_pb2. Searched paths:\n\t%s" % "\n\t".join(searched_paths)
 
+# PlCodec values from panda/plog.h
+PL_CODEC_NONE, PL_CODEC_ZLIB, PL_CODEC_ZSTD, PL_CODEC_LZ4 = range(4)
+
+def decompress_chunk(codec, data, size_hint):
+    if codec == PL_CODEC_ZLIB:
+        return zlib.decompress(data, 15, size_hint)
+    if codec == PL_CODEC_NONE:
+        return data
+    if codec == PL_CODEC_ZSTD:
+        import zstandard
+        return zstandard.ZstdDecompressor().decompress(data, max_output_size=size_hint)
+    if codec == PL_CODEC_LZ4:
+        import lz4.frame
+        return lz4.frame.decompress(data)
+    raise ValueError("unknown pandalog codec %d" % codec)
+
 class PLogReader:
     def __init__(self, fn):
         self.f = open(fn)
-        self.version, _, self.dir_pos, _, self.chunk_gsize = struct.unpack('<IIQII', self.f.read(24))
+        self.version, _, self.dir_pos, self.chunk_gsize, self.codec = struct.unpack('<IIQII', self.f.read(24))
+        if self.version < 3:
+            # the codec field was added in version 3, before that it's zlib
+            self.codec = PL_CODEC_ZLIB
 
         self.f.seek(self.dir_pos)
         self.nchunks, = struct.unpack('<I', self.f.read(4)) # number of chunks
@@ -65,13 +84,12 @@ class PLogReader:
                 nxt = struct.unpack_from('<QQQ', self.chunks, 24*(self.chunk_idx+1))
                 zchunk_size = nxt[1] - cur[1]
             else:
-                # setting the compressed chunk size to -1 will
-                # result in reading the remaining of the file
-                zchunk_size = -1
+                # the last chunk ends where the directory starts
+                zchunk_size = self.dir_pos - cur[1]
 
             # read and decompress chunk data
             self.f.seek(cur[1])
-            self.chunk_data = zlib.decompress(self.f.read(zchunk_size), 15, self.chunk_gsize)
+            self.chunk_data = decompress_chunk(self.codec, self.f.read(zchunk_size), self.chunk_gsize)
             self.chunk_size = len(self.chunk_data)
             self.chunk_data_idx = 0
 
@@ -27,8 +27,12 @@ if os.path.exists(outfname):
 # Get number of instructions
 try:
     with open(base + '-rr-nondet.log', 'rb') as f:
-        # num_guest_insns is 64-bit int at offset 16
-        f.seek(16)
+        if f.read(8) == 'PANDARR2':
+            # chunked log: num_guest_insns follows the magic
+            f.seek(8)
+        else:
+            # num_guest_insns is 64-bit int at offset 16
+            f.seek(16)
         num_guest_insns = struct.unpack("<Q", f.read(8))[0]
 except EnvironmentError:
     print >>sys.stderr, "Failed to open", base + '-rr-nondet.log. Aborting.'
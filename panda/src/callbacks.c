@@ -30,8 +30,10 @@ PANDAENDCOMMENT */
 #include "panda/helper_runtime.h"
 #endif
 
+#include "exec/exec-all.h"
 #include "panda/common.h"
 #include "panda/rr/rr_api.h"
+#include "panda/callbacks/cb-dispatch.h"
 
 #define LIBRARY_DIR "/" TARGET_NAME "-softmmu/libpanda-" TARGET_NAME ".so"
 #define PLUGIN_DIR "/" TARGET_NAME "-softmmu/panda/plugins/"
@@ -48,6 +50,21 @@ WARNING: This is all gloriously thread-unsafe!!!
 // Array of pointers to PANDA callback lists, one per callback type
 panda_cb_list *panda_cbs[PANDA_CB_LAST];
 
+// Enabled callbacks of each type, rebuilt from panda_cbs (see cb-dispatch.h)
+panda_cb_table panda_cb_tables[PANDA_CB_LAST];
+bool panda_cb_profiling = false;
+
+// Tables and list entries that a dispatch in progress may still be using
+static GPtrArray *panda_cb_retired;
+
+static void panda_cb_retire(void *ptr)
+{
+    if (panda_cb_retired == NULL) {
+        panda_cb_retired = g_ptr_array_new_with_free_func(g_free);
+    }
+    g_ptr_array_add(panda_cb_retired, ptr);
+}
+
 // Storage for command line options
 const gchar *panda_argv[MAX_PANDA_PLUGIN_ARGS];
 int panda_argc;
@@ -66,6 +83,8 @@ bool panda_please_flush_tb = false;
 bool panda_update_pc = false;
 bool panda_use_memcb = false;
 bool panda_tb_chaining = true;
+bool panda_llvm_bypass = false;
+bool panda_bypass_llvm_block = false;
 
 bool panda_help_wanted = false;
 bool panda_plugin_load_failed = false;
@@ -371,6 +390,7 @@ void panda_unload_plugin_idx(int plugin_idx)
     }
     panda_plugin_to_unload = true;
     panda_plugins_to_unload[plugin_idx] = true;
+    panda_stop_chaining();
 }
 
 void panda_unload_plugins(void)
@@ -404,6 +424,8 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb)
 {
     panda_cb_list *plist_last = NULL;
 
+    panda_stop_chaining();
+
     panda_cb_list *new_list = g_new0(panda_cb_list, 1);
     new_list->entry = cb;
     new_list->owner = plugin;
@@ -423,6 +445,7 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb)
     } else {
         panda_cbs[type] = new_list;
     }
+    panda_cb_table_rebuild(type);
 }
 
 /**
@@ -461,6 +484,7 @@ void panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb)
             if (plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr) {
                 found = true;
                 plist->enabled = false;
+                panda_cb_table_rebuild(type);
 
                 // break out of the loop - the same plugin can register the same
                 // callback only once
@@ -491,6 +515,8 @@ void panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb)
             if (plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr) {
                 found = true;
                 plist->enabled = true;
+                panda_cb_table_rebuild(type);
+                panda_stop_chaining();
 
                 // break out of the loop - the same plugin can register the same
                 // callback only once
@@ -534,8 +560,9 @@ void panda_unregister_callbacks(void *plugin)
                     if (plist == plist_head)
                         plist_head = plist->next;
                 }
-                // Free the entry we just unlinked
-                g_free(del_plist);
+                // Free the entry we just unlinked, once nothing can be
+                // dispatching through it
+                panda_cb_retire(del_plist);
                 // there should only be one callback in list for this plugin so
                 // done
                 done = true;
@@ -544,6 +571,7 @@ void panda_unregister_callbacks(void *plugin)
         }
         // update head
         panda_cbs[i] = plist_head;
+        panda_cb_table_rebuild(i);
     }
 }
 
@@ -565,7 +593,9 @@ void panda_enable_plugin(void *plugin)
             }
             plist = plist->next;
         }
+        panda_cb_table_rebuild(i);
     }
+    panda_stop_chaining();
 }
 
 /**
@@ -586,6 +616,7 @@ void panda_disable_plugin(void *plugin)
             }
             plist = plist->next;
         }
+        panda_cb_table_rebuild(i);
     }
 }
 
@@ -615,6 +646,191 @@ bool panda_flush_tb(void)
 void panda_do_flush_tb(void)
 {
     panda_please_flush_tb = true;
+    panda_stop_chaining();
+}
+
+unsigned panda_tb_flush_count(void)
+{
+    return atomic_read(&tcg_ctx.tb_ctx.tb_flush_count);
+}
+
+void panda_stop_chaining(void)
+{
+    CPUState *cpu;
+
+    CPU_FOREACH(cpu) {
+        cpu->rr_chain_budget = 0;
+    }
+}
+
+bool panda_block_callbacks_enabled(void)
+{
+    static const panda_cb_type types[] = {
+        PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT,
+        PANDA_CB_BEFORE_BLOCK_EXEC,
+        PANDA_CB_AFTER_BLOCK_EXEC,
+    };
+    int i;
+
+    for (i = 0; i < ARRAY_SIZE(types); i++) {
+        if (panda_cb_any(types[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Rebuilds the dispatch table for a callback type from its list.
+ *
+ * The new array replaces the old one, which is retired rather than freed
+ * because a callback that caused the rebuild may be running from it.
+ */
+void panda_cb_table_rebuild(panda_cb_type type)
+{
+    panda_cb_table *table = &panda_cb_tables[type];
+    panda_cb_slot *slots = NULL;
+    int num = 0;
+
+    for (panda_cb_list *plist = panda_cbs[type]; plist != NULL;
+         plist = plist->next) {
+        if (plist->enabled) {
+            num++;
+        }
+    }
+    if (num > 0) {
+        slots = g_new(panda_cb_slot, num);
+        num = 0;
+        for (panda_cb_list *plist = panda_cbs[type]; plist != NULL;
+             plist = plist->next) {
+            if (plist->enabled) {
+                slots[num].entry = plist->entry;
+                slots[num].node = plist;
+                num++;
+            }
+        }
+    }
+
+    if (table->slots) {
+        panda_cb_retire(table->slots);
+    }
+    table->num = 0;
+    table->slots = slots;
+    table->num = num;
+}
+
+void panda_cb_account(panda_cb_table *table, panda_cb_slot *slot,
+                      int64_t start)
+{
+    int64_t ticks = cpu_get_host_ticks() - start;
+
+    table->ticks += ticks;
+    slot->node->calls++;
+    slot->node->ticks += ticks;
+}
+
+/**
+ * @brief Frees tables and list entries replaced since the last call.
+ *
+ * Must only be called when no callback dispatch is in progress.
+ */
+void panda_cb_free_retired(void)
+{
+    if (panda_cb_retired && panda_cb_retired->len > 0) {
+        g_ptr_array_set_size(panda_cb_retired, 0);
+    }
+}
+
+static const char *panda_cb_type_names[PANDA_CB_LAST] = {
+    [PANDA_CB_BEFORE_BLOCK_TRANSLATE] = "before_block_translate",
+    [PANDA_CB_AFTER_BLOCK_TRANSLATE] = "after_block_translate",
+    [PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT] = "before_block_exec_invalidate_opt",
+    [PANDA_CB_BEFORE_BLOCK_EXEC] = "before_block_exec",
+    [PANDA_CB_AFTER_BLOCK_EXEC] = "after_block_exec",
+    [PANDA_CB_INSN_TRANSLATE] = "insn_translate",
+    [PANDA_CB_INSN_EXEC] = "insn_exec",
+    [PANDA_CB_AFTER_INSN_TRANSLATE] = "after_insn_translate",
+    [PANDA_CB_AFTER_INSN_EXEC] = "after_insn_exec",
+    [PANDA_CB_VIRT_MEM_BEFORE_READ] = "virt_mem_before_read",
+    [PANDA_CB_VIRT_MEM_BEFORE_WRITE] = "virt_mem_before_write",
+    [PANDA_CB_PHYS_MEM_BEFORE_READ] = "phys_mem_before_read",
+    [PANDA_CB_PHYS_MEM_BEFORE_WRITE] = "phys_mem_before_write",
+    [PANDA_CB_VIRT_MEM_AFTER_READ] = "virt_mem_after_read",
+    [PANDA_CB_VIRT_MEM_AFTER_WRITE] = "virt_mem_after_write",
+    [PANDA_CB_PHYS_MEM_AFTER_READ] = "phys_mem_after_read",
+    [PANDA_CB_PHYS_MEM_AFTER_WRITE] = "phys_mem_after_write",
+    [PANDA_CB_MMIO_AFTER_READ] = "mmio_after_read",
+    [PANDA_CB_MMIO_BEFORE_WRITE] = "mmio_before_write",
+    [PANDA_CB_HD_READ] = "hd_read",
+    [PANDA_CB_HD_WRITE] = "hd_write",
+    [PANDA_CB_GUEST_HYPERCALL] = "guest_hypercall",
+    [PANDA_CB_MONITOR] = "monitor",
+    [PANDA_CB_CPU_RESTORE_STATE] = "cpu_restore_state",
+    [PANDA_CB_BEFORE_LOADVM] = "before_loadvm",
+    [PANDA_CB_ASID_CHANGED] = "asid_changed",
+    [PANDA_CB_REPLAY_HD_TRANSFER] = "replay_hd_transfer",
+    [PANDA_CB_REPLAY_NET_TRANSFER] = "replay_net_transfer",
+    [PANDA_CB_REPLAY_SERIAL_RECEIVE] = "replay_serial_receive",
+    [PANDA_CB_REPLAY_SERIAL_READ] = "replay_serial_read",
+    [PANDA_CB_REPLAY_SERIAL_SEND] = "replay_serial_send",
+    [PANDA_CB_REPLAY_SERIAL_WRITE] = "replay_serial_write",
+    [PANDA_CB_REPLAY_BEFORE_DMA] = "replay_before_dma",
+    [PANDA_CB_REPLAY_AFTER_DMA] = "replay_after_dma",
+    [PANDA_CB_REPLAY_HANDLE_PACKET] = "replay_handle_packet",
+    [PANDA_CB_AFTER_CPU_EXEC_ENTER] = "after_cpu_exec_enter",
+    [PANDA_CB_BEFORE_CPU_EXEC_EXIT] = "before_cpu_exec_exit",
+    [PANDA_CB_AFTER_MACHINE_INIT] = "after_machine_init",
+    [PANDA_CB_AFTER_LOADVM] = "after_loadvm",
+    [PANDA_CB_TOP_LOOP] = "top_loop",
+    [PANDA_CB_DURING_MACHINE_INIT] = "during_machine_init",
+    [PANDA_CB_MAIN_LOOP_WAIT] = "main_loop_wait",
+    [PANDA_CB_PRE_SHUTDOWN] = "pre_shutdown",
+    [PANDA_CB_UNASSIGNED_IO_READ] = "unassigned_io_read",
+    [PANDA_CB_UNASSIGNED_IO_WRITE] = "unassigned_io_write",
+    [PANDA_CB_BEFORE_HANDLE_EXCEPTION] = "before_handle_exception",
+    [PANDA_CB_BEFORE_HANDLE_INTERRUPT] = "before_handle_interrupt",
+};
+
+static const char *panda_cb_owner_name(void *owner)
+{
+    for (int i = 0; i < nb_panda_plugins; i++) {
+        if (panda_plugins[i].plugin == owner) {
+            return panda_plugins[i].name;
+        }
+    }
+    return "?";
+}
+
+/**
+ * @brief Prints dispatch counts per callback type and, when profiling,
+ * the calls and host ticks of each callback that is still registered.
+ */
+void panda_cb_stats_dump(FILE *f)
+{
+    fprintf(f, PANDA_MSG_FMT "callback dispatch statistics\n", PANDA_CORE_NAME);
+    fprintf(f, "%-34s %14s %18s\n", "callback", "dispatches", "host ticks");
+    for (int i = 0; i < PANDA_CB_LAST; i++) {
+        panda_cb_table *table = &panda_cb_tables[i];
+        if (table->calls == 0) {
+            continue;
+        }
+        if (panda_cb_type_names[i]) {
+            fprintf(f, "%-34s", panda_cb_type_names[i]);
+        } else {
+            fprintf(f, "%-34d", i);
+        }
+        fprintf(f, " %14" PRIu64 " %18" PRIu64 "\n", table->calls,
+                table->ticks);
+        for (panda_cb_list *plist = panda_cbs[i]; plist != NULL;
+             plist = plist->next) {
+            if (plist->calls == 0) {
+                continue;
+            }
+            fprintf(f, "  %-32s %14" PRIu64 " %18" PRIu64 "\n",
+                    panda_cb_owner_name(plist->owner), plist->calls,
+                    plist->ticks);
+        }
+    }
 }
 
 void panda_enable_precise_pc(void)
@@ -637,6 +853,133 @@ void panda_disable_memcb(void)
     panda_use_memcb = false;
 }
 
+/*
+ * Selective memory callbacks.  Pages covered by a watch get TLB_PANDA_WATCH
+ * in their TLB entries when they are filled, so accesses to them (and only
+ * them) leave the inline fast path for the _panda softmmu helpers, which
+ * then check the access against the watches themselves.
+ */
+typedef struct {
+    bool used;
+    int kinds;
+    uint64_t start;
+    uint64_t end; // exclusive
+    target_ulong asid;
+} panda_memcb_watch_t;
+
+#define MAX_PANDA_MEMCB_WATCHES 256
+static panda_memcb_watch_t panda_memcb_watches[MAX_PANDA_MEMCB_WATCHES];
+static int panda_memcb_num_watches = 0; // highest used slot + 1
+bool panda_memcb_watching = false;
+
+static void panda_memcb_watches_changed(void)
+{
+    CPUState *cpu;
+    bool watching = false;
+    int i;
+
+    for (i = 0; i < panda_memcb_num_watches; i++) {
+        watching |= panda_memcb_watches[i].used;
+    }
+    if (watching != panda_memcb_watching) {
+        // code translated in the other mode calls the wrong slow path
+        panda_memcb_watching = watching;
+        panda_do_flush_tb();
+    }
+    // refill entries so they pick up (or drop) the watch bit
+    CPU_FOREACH(cpu) {
+        tlb_flush(cpu);
+    }
+}
+
+int panda_memcb_watch(uint64_t start, uint64_t len, int kinds, target_ulong asid)
+{
+    int i;
+
+    if (len == 0 || !(kinds & (PANDA_MEMCB_READ | PANDA_MEMCB_WRITE))) {
+        return -1;
+    }
+    for (i = 0; i < MAX_PANDA_MEMCB_WATCHES; i++) {
+        if (!panda_memcb_watches[i].used) break;
+    }
+    if (i == MAX_PANDA_MEMCB_WATCHES) {
+        return -1;
+    }
+
+    panda_memcb_watch_t *w = &panda_memcb_watches[i];
+    w->used = true;
+    w->kinds = kinds;
+    w->start = start;
+    w->end = (start + len < start) ? UINT64_MAX : start + len;
+    w->asid = asid;
+    if (i >= panda_memcb_num_watches) {
+        panda_memcb_num_watches = i + 1;
+    }
+    panda_memcb_watches_changed();
+    return i;
+}
+
+void panda_memcb_unwatch(int handle)
+{
+    if (handle < 0 || handle >= panda_memcb_num_watches ||
+            !panda_memcb_watches[handle].used) {
+        return;
+    }
+    panda_memcb_watches[handle].used = false;
+    while (panda_memcb_num_watches > 0 &&
+            !panda_memcb_watches[panda_memcb_num_watches - 1].used) {
+        panda_memcb_num_watches--;
+    }
+    panda_memcb_watches_changed();
+}
+
+// Which kinds of access to the page at vaddr / paddr some watch covers.
+// The ASID is ignored here: global pages stay in the TLB across address
+// space switches, so the ASID is checked per access instead.
+int panda_memcb_page_watched(target_ulong vaddr, uint64_t paddr)
+{
+    int kinds = 0;
+    int i;
+
+    for (i = 0; i < panda_memcb_num_watches; i++) {
+        panda_memcb_watch_t *w = &panda_memcb_watches[i];
+        uint64_t page = (w->kinds & PANDA_MEMCB_PHYS) ? paddr : vaddr;
+        if (w->used && w->start < page + TARGET_PAGE_SIZE && page < w->end) {
+            kinds |= w->kinds;
+        }
+    }
+    return kinds & (PANDA_MEMCB_READ | PANDA_MEMCB_WRITE);
+}
+
+bool panda_memcb_match(CPUState *cpu, target_ulong vaddr, uint64_t paddr,
+                       size_t size, bool is_write)
+{
+    int kind = is_write ? PANDA_MEMCB_WRITE : PANDA_MEMCB_READ;
+    bool have_asid = false;
+    target_ulong asid = 0;
+    int i;
+
+    for (i = 0; i < panda_memcb_num_watches; i++) {
+        panda_memcb_watch_t *w = &panda_memcb_watches[i];
+        uint64_t addr = (w->kinds & PANDA_MEMCB_PHYS) ? paddr : vaddr;
+        if (!w->used || !(w->kinds & kind) ||
+                !(w->start < addr + size && addr < w->end)) {
+            continue;
+        }
+        if (w->kinds & PANDA_MEMCB_ASID) {
+            if (!have_asid) {
+                asid = panda_current_asid(cpu);
+                have_asid = true;
+            }
+            if (asid != w->asid) {
+                continue;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
 void panda_enable_tb_chaining(void)
 {
     panda_tb_chaining = true;
@@ -670,6 +1013,21 @@ void panda_enable_llvm_helpers(void) {
 void panda_disable_llvm_helpers(void) {
     uninit_llvm_helpers();
 }
+
+void panda_enable_llvm_bypass(void) {
+    panda_do_flush_tb();
+    panda_llvm_bypass = true;
+}
+
+void panda_disable_llvm_bypass(void) {
+    panda_do_flush_tb();
+    panda_llvm_bypass = false;
+    panda_bypass_llvm_block = false;
+}
+
+void panda_bypass_llvm(void) {
+    panda_bypass_llvm_block = panda_llvm_bypass;
+}
 #endif
 
 void panda_memsavep(FILE *f) {
@@ -1235,11 +1593,8 @@ void hmp_panda_list_plugins(Monitor *mon, const QDict *qdict) {
 }
 
 void hmp_panda_plugin_cmd(Monitor *mon, const QDict *qdict) {
-    panda_cb_list *plist;
     const char *cmd = qdict_get_try_str(qdict, "cmd");
-    for(plist = panda_cbs[PANDA_CB_MONITOR]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.monitor(mon, cmd);
-    }
+    PANDA_CB_DISPATCH(PANDA_CB_MONITOR, slot->entry.monitor(mon, cmd));
 }
 
 #endif // CONFIG_SOFTMMU
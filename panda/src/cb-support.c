@@ -163,6 +163,8 @@ MAKE_CALLBACK(void, PRE_SHUTDOWN, pre_shutdown, void);
 // Non-standard callbacks below here
 
 void PCB(before_find_fast)(void) {
+    // Nothing on this thread is dispatching callbacks right now
+    panda_cb_free_retired();
     if (panda_plugin_to_unload) {
         panda_plugin_to_unload = false;
         for (int i = 0; i < MAX_PANDA_PLUGINS; i++) {
@@ -178,14 +180,9 @@ void PCB(before_find_fast)(void) {
 }
 bool PCB(after_find_fast)(CPUState *cpu, TranslationBlock *tb,
                           bool bb_invalidate_done, bool *invalidate) {
-    panda_cb_list *plist;
     if (!bb_invalidate_done) {
-        for (plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT];
-             plist != NULL; plist = panda_cb_list_next(plist)) {
-            if (plist->enabled)
-              *invalidate |=
-                  plist->entry.before_block_exec_invalidate_opt(cpu, tb);
-        }
+        PANDA_CB_DISPATCH(PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT,
+            *invalidate |= slot->entry.before_block_exec_invalidate_opt(cpu, tb));
         return true;
     }
     return false;
@@ -202,20 +199,16 @@ bool PCB(after_find_fast)(CPUState *cpu, TranslationBlock *tb,
 // change the current cpu exception.  Sorry.
 
 int32_t PCB(before_handle_exception)(CPUState *cpu, int32_t exception_index) {
-    panda_cb_list *plist;
     bool got_new_exception = false;
     int32_t new_exception;
 
-    for (plist = panda_cbs[PANDA_CB_BEFORE_HANDLE_EXCEPTION]; plist != NULL;
-         plist = panda_cb_list_next(plist)) {
-        if (plist->enabled) {
-            int32_t new_e = plist->entry.before_handle_exception(cpu, exception_index);
-            if (!got_new_exception && new_e != exception_index) {
-                got_new_exception = true;
-                new_exception = new_e;
-            }
+    PANDA_CB_DISPATCH(PANDA_CB_BEFORE_HANDLE_EXCEPTION, {
+        int32_t new_e = slot->entry.before_handle_exception(cpu, exception_index);
+        if (!got_new_exception && new_e != exception_index) {
+            got_new_exception = true;
+            new_exception = new_e;
         }
-    }
+    });
 
     if (got_new_exception)
         return new_exception;
@@ -225,20 +218,16 @@ int32_t PCB(before_handle_exception)(CPUState *cpu, int32_t exception_index) {
 
 
 int32_t PCB(before_handle_interrupt)(CPUState *cpu, int32_t interrupt_request) {
-    panda_cb_list *plist;
     bool got_new_interrupt = false;
     int32_t new_interrupt;
 
-    for (plist = panda_cbs[PANDA_CB_BEFORE_HANDLE_INTERRUPT]; plist != NULL;
-         plist = panda_cb_list_next(plist)) {
-        if (plist->enabled) {
-            int32_t new_i = plist->entry.before_handle_interrupt(cpu, interrupt_request);
-            if (!got_new_interrupt && new_i != interrupt_request) {
-                got_new_interrupt = true;
-                new_interrupt = new_i;
-            }
+    PANDA_CB_DISPATCH(PANDA_CB_BEFORE_HANDLE_INTERRUPT, {
+        int32_t new_i = slot->entry.before_handle_interrupt(cpu, interrupt_request);
+        if (!got_new_interrupt && new_i != interrupt_request) {
+            got_new_interrupt = true;
+            new_interrupt = new_i;
         }
-    }
+    });
 
     if (got_new_interrupt)
         return new_interrupt;
@@ -251,81 +240,58 @@ int32_t PCB(before_handle_interrupt)(CPUState *cpu, int32_t interrupt_request) {
 // ram_ptr is a possible pointer into host memory from the TLB code. Can be NULL.
 void PCB(mem_before_read)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
                           size_t data_size, void *ram_ptr) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_READ]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        if (plist->enabled) plist->entry.virt_mem_before_read(env, env->panda_guest_pc, addr,
-                                                              data_size);
-    }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]) {
+    PANDA_CB_DISPATCH(PANDA_CB_VIRT_MEM_BEFORE_READ,
+        slot->entry.virt_mem_before_read(env, env->panda_guest_pc, addr,
+                                         data_size));
+    if (panda_cb_any(PANDA_CB_PHYS_MEM_BEFORE_READ)) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]; plist != NULL;
-            plist = panda_cb_list_next(plist)) {
-            if (plist->enabled) plist->entry.phys_mem_before_read(env, env->panda_guest_pc,
-                                                                  paddr, data_size);
-        }
+        PANDA_CB_DISPATCH(PANDA_CB_PHYS_MEM_BEFORE_READ,
+            slot->entry.phys_mem_before_read(env, env->panda_guest_pc,
+                                             paddr, data_size));
     }
 }
 
 
 void PCB(mem_after_read)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
                          size_t data_size, uint64_t result, void *ram_ptr) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_READ]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        /* mstamat: Passing &result as the last cb arg doesn't make much sense. */
-        if (plist->enabled) plist->entry.virt_mem_after_read(env, env->panda_guest_pc, addr,
-                                         data_size, (uint8_t *)&result);
-    }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]) {
+    /* mstamat: Passing &result as the last cb arg doesn't make much sense. */
+    PANDA_CB_DISPATCH(PANDA_CB_VIRT_MEM_AFTER_READ,
+        slot->entry.virt_mem_after_read(env, env->panda_guest_pc, addr,
+                                        data_size, (uint8_t *)&result));
+    if (panda_cb_any(PANDA_CB_PHYS_MEM_AFTER_READ)) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]; plist != NULL;
-            plist = panda_cb_list_next(plist)) {
-            /* mstamat: Passing &result as the last cb arg doesn't make much sense. */
-            if (plist->enabled) plist->entry.phys_mem_after_read(env, env->panda_guest_pc, paddr,
-                                             data_size, (uint8_t *)&result);
-        }
+        PANDA_CB_DISPATCH(PANDA_CB_PHYS_MEM_AFTER_READ,
+            slot->entry.phys_mem_after_read(env, env->panda_guest_pc, paddr,
+                                            data_size, (uint8_t *)&result));
     }
 }
 
 
 void PCB(mem_before_write)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
                            size_t data_size, uint64_t val, void *ram_ptr) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_WRITE]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        /* mstamat: Passing &val as the last arg doesn't make much sense. */
-        if (plist->enabled) plist->entry.virt_mem_before_write(env, env->panda_guest_pc, addr,
-                                           data_size, (uint8_t *)&val);
-    }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]) {
+    /* mstamat: Passing &val as the last arg doesn't make much sense. */
+    PANDA_CB_DISPATCH(PANDA_CB_VIRT_MEM_BEFORE_WRITE,
+        slot->entry.virt_mem_before_write(env, env->panda_guest_pc, addr,
+                                          data_size, (uint8_t *)&val));
+    if (panda_cb_any(PANDA_CB_PHYS_MEM_BEFORE_WRITE)) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]; plist != NULL;
-            plist = panda_cb_list_next(plist)) {
-            /* mstamat: Passing &val as the last cb arg doesn't make much sense. */
-            if (plist->enabled) plist->entry.phys_mem_before_write(env, env->panda_guest_pc, paddr,
-                                               data_size, (uint8_t *)&val);
-        }
+        PANDA_CB_DISPATCH(PANDA_CB_PHYS_MEM_BEFORE_WRITE,
+            slot->entry.phys_mem_before_write(env, env->panda_guest_pc, paddr,
+                                              data_size, (uint8_t *)&val));
     }
 }
 
 
 void PCB(mem_after_write)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
                           size_t data_size, uint64_t val, void *ram_ptr) {
-    panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_WRITE]; plist != NULL;
-         plist = panda_cb_list_next(plist)) {
-        /* mstamat: Passing &val as the last cb arg doesn't make much sense. */
-        if (plist->enabled) plist->entry.virt_mem_after_write(env, env->panda_guest_pc, addr,
-                                          data_size, (uint8_t *)&val);
-    }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]) {
+    /* mstamat: Passing &val as the last cb arg doesn't make much sense. */
+    PANDA_CB_DISPATCH(PANDA_CB_VIRT_MEM_AFTER_WRITE,
+        slot->entry.virt_mem_after_write(env, env->panda_guest_pc, addr,
+                                         data_size, (uint8_t *)&val));
+    if (panda_cb_any(PANDA_CB_PHYS_MEM_AFTER_WRITE)) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for (plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]; plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-            /* mstamat: Passing &val as the last cb arg doesn't make much sense. */
-            if (plist->enabled) plist->entry.phys_mem_after_write(env, env->panda_guest_pc, paddr,
-                                              data_size, (uint8_t *)&val);
-        }
+        PANDA_CB_DISPATCH(PANDA_CB_PHYS_MEM_AFTER_WRITE,
+            slot->entry.phys_mem_after_write(env, env->panda_guest_pc, paddr,
+                                             data_size, (uint8_t *)&val));
     }
 }
@@ -3,6 +3,13 @@
  * Author: Ray Wang		raywang@mit.edu
  *
  * Provides functions to take, store, and restore replay checkpoints
+ *
+ * A checkpoint is the device state (the migration stream minus RAM) in a
+ * memfd plus the RAM pages that changed since the previous checkpoint.
+ * Pages are kept once each in a content-addressed store shared by all
+ * checkpoints, and every RAM page has a history of (checkpoint, page)
+ * versions so the content as of any checkpoint is a binary search away.
+ * Dirty pages are found with the migration dirty bitmap.
  */
 
 #include <stdio.h>
@@ -14,6 +21,8 @@
 
 #include "exec/exec-all.h"
 #include "exec/memory.h"
+#include "exec/ram_addr.h"
+#include "qemu/bitmap.h"
 #include "io/channel-file.h"
 #include "migration/migration.h"
 #include "migration/qemu-file.h"
@@ -42,13 +51,279 @@ static int memfd_create(const char *name, unsigned int flags) {
 #include "panda/checkpoint.h"
 
 extern RR_log_entry *rr_queue_head;
-Checkpoint* checkpoints[MAX_CHECKPOINTS] = {NULL}; 
+Checkpoint **checkpoints = NULL;
 
 extern unsigned long long rr_number_of_log_entries[RR_LAST];
 extern unsigned long long rr_size_of_log_entries[RR_LAST];
 extern unsigned long long rr_max_num_queue_entries;
 static size_t total_usage = 0;
+static size_t checkpoint_budget = 0; // 0 is unlimited
 static size_t next_checkpoint_num = 0;
+static size_t max_checkpoints = 0;
+static uint32_t next_seq = 0;
+
+// newest checkpoint taken or restored; RAM differs from it only in dirty
+static Checkpoint *base_checkpoint = NULL;
+
+typedef struct CheckpointPage {
+    uint64_t hash;
+    unsigned refs;
+    uint8_t *data;
+} CheckpointPage;
+
+typedef struct {
+    uint32_t seq; // checkpoint from which this content is current
+    CheckpointPage *page;
+} PageVersion;
+
+typedef struct {
+    PageVersion *v; // sorted by seq
+    uint32_t n;
+    uint32_t cap;
+} PageHistory;
+
+static GHashTable *page_store = NULL;
+static PageHistory *page_history = NULL; // indexed by ram_addr page
+static unsigned long *dirty = NULL;      // pages written since base
+static size_t num_ram_pages = 0;
+
+static uint64_t page_hash(const uint8_t *data) {
+    const uint64_t *w = (const uint64_t *)data;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    int i;
+    for (i = 0; i < TARGET_PAGE_SIZE / sizeof(uint64_t); i++) {
+        h = (h ^ w[i]) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+static guint page_store_hash(gconstpointer key) {
+    return ((const CheckpointPage *)key)->hash;
+}
+
+static gboolean page_store_equal(gconstpointer a, gconstpointer b) {
+    const CheckpointPage *pa = a, *pb = b;
+    return pa->hash == pb->hash &&
+        memcmp(pa->data, pb->data, TARGET_PAGE_SIZE) == 0;
+}
+
+// Returns a referenced store page with the contents of data.
+static CheckpointPage *page_store_get(const uint8_t *data) {
+    CheckpointPage key = { .hash = page_hash(data), .data = (uint8_t *)data };
+    CheckpointPage *page = g_hash_table_lookup(page_store, &key);
+    if (!page) {
+        page = g_malloc(sizeof(*page) + TARGET_PAGE_SIZE);
+        page->hash = key.hash;
+        page->refs = 0;
+        page->data = (uint8_t *)(page + 1);
+        memcpy(page->data, data, TARGET_PAGE_SIZE);
+        g_hash_table_insert(page_store, page, page);
+        total_usage += TARGET_PAGE_SIZE;
+    }
+    page->refs++;
+    return page;
+}
+
+static void page_store_put(CheckpointPage *page) {
+    if (--page->refs == 0) {
+        g_hash_table_remove(page_store, page);
+        total_usage -= TARGET_PAGE_SIZE;
+        g_free(page);
+    }
+}
+
+// index of the last version with seq <= seq, or -1
+static int64_t page_history_find(PageHistory *h, uint32_t seq) {
+    int64_t lo = 0, hi = h->n;
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (h->v[mid].seq <= seq) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo - 1;
+}
+
+static void checkpoint_add_page(Checkpoint *checkpoint, uint64_t page) {
+    if (checkpoint->num_pages == checkpoint->max_pages) {
+        checkpoint->max_pages = MAX(64, 2 * checkpoint->max_pages);
+        checkpoint->pages = g_renew(uint64_t, checkpoint->pages,
+                                    checkpoint->max_pages);
+    }
+    checkpoint->pages[checkpoint->num_pages++] = page;
+}
+
+// Grow per-page state to cover RAM blocks added since the last call.
+// New pages count as dirty.
+static void checkpoint_track_ram(void) {
+    size_t pages = last_ram_offset() >> TARGET_PAGE_BITS;
+    if (pages <= num_ram_pages) return;
+
+    page_history = g_renew(PageHistory, page_history, pages);
+    memset(page_history + num_ram_pages, 0,
+           (pages - num_ram_pages) * sizeof(PageHistory));
+
+    unsigned long *new_dirty = bitmap_new(pages);
+    if (dirty) {
+        bitmap_copy(new_dirty, dirty, num_ram_pages);
+        g_free(dirty);
+    }
+    bitmap_set(new_dirty, num_ram_pages, pages - num_ram_pages);
+    dirty = new_dirty;
+    num_ram_pages = pages;
+}
+
+static int sync_dirty_block(const char *name, void *host, ram_addr_t offset,
+                            ram_addr_t length, void *opaque) {
+    int64_t real_dirty_pages = 0;
+    cpu_physical_memory_sync_dirty_bitmap(dirty, offset, length,
+                                          &real_dirty_pages);
+    return 0;
+}
+
+// Collect pages written since the last call into dirty.
+static void checkpoint_sync_dirty(void) {
+    CPUState *cpu;
+
+    checkpoint_track_ram();
+    qemu_ram_foreach_block(sync_dirty_block, NULL);
+    // cleaned pages have to take the notdirty path on their next write
+    CPU_FOREACH(cpu) {
+        tlb_flush(cpu);
+    }
+}
+
+// index of checkpoint in checkpoints[], which is sorted by seq
+static size_t checkpoint_index(Checkpoint *checkpoint) {
+    size_t lo = 0, hi = next_checkpoint_num;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (checkpoints[mid]->seq < checkpoint->seq) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    assert(lo < next_checkpoint_num && checkpoints[lo] == checkpoint);
+    return lo;
+}
+
+// Mark the pages that changed between checkpoints from and to (indices,
+// from <= to) as dirty.
+static void mark_changed_pages(size_t from, size_t to) {
+    size_t i, j;
+    for (i = from + 1; i <= to; i++) {
+        for (j = 0; j < checkpoints[i]->num_pages; j++) {
+            set_bit(checkpoints[i]->pages[j], dirty);
+        }
+    }
+}
+
+static int save_dirty_block(const char *name, void *host, ram_addr_t offset,
+                            ram_addr_t length, void *opaque) {
+    Checkpoint *checkpoint = opaque;
+    unsigned long start = offset >> TARGET_PAGE_BITS;
+    unsigned long end = (offset + length) >> TARGET_PAGE_BITS;
+    unsigned long p;
+
+    for (p = find_next_bit(dirty, end, start); p < end;
+            p = find_next_bit(dirty, end, p + 1)) {
+        CheckpointPage *page = page_store_get(
+                (uint8_t *)host + ((p - start) << TARGET_PAGE_BITS));
+        PageHistory *h = &page_history[p];
+        if (h->n && h->v[h->n - 1].page == page) {
+            // same as in the newest checkpoint
+            page_store_put(page);
+            continue;
+        }
+        if (h->n == h->cap) {
+            h->cap = MAX(2, 2 * h->cap);
+            h->v = g_renew(PageVersion, h->v, h->cap);
+        }
+        h->v[h->n].seq = checkpoint->seq;
+        h->v[h->n].page = page;
+        h->n++;
+        checkpoint_add_page(checkpoint, p);
+    }
+    return 0;
+}
+
+static int restore_dirty_block(const char *name, void *host, ram_addr_t offset,
+                               ram_addr_t length, void *opaque) {
+    Checkpoint *checkpoint = opaque;
+    unsigned long start = offset >> TARGET_PAGE_BITS;
+    unsigned long end = (offset + length) >> TARGET_PAGE_BITS;
+    unsigned long p;
+
+    for (p = find_next_bit(dirty, end, start); p < end;
+            p = find_next_bit(dirty, end, p + 1)) {
+        PageHistory *h = &page_history[p];
+        int64_t i = page_history_find(h, checkpoint->seq);
+        // pages of RAM blocks added after the checkpoint are left alone
+        if (i >= 0) {
+            memcpy((uint8_t *)host + ((p - start) << TARGET_PAGE_BITS),
+                   h->v[i].page->data, TARGET_PAGE_SIZE);
+        }
+    }
+    return 0;
+}
+
+// Drop checkpoints[i] (neither first nor last), folding the page versions
+// it introduced into the following checkpoint.
+static void checkpoint_drop(size_t i) {
+    Checkpoint *checkpoint = checkpoints[i];
+    Checkpoint *next = checkpoints[i + 1];
+    size_t j;
+
+    for (j = 0; j < checkpoint->num_pages; j++) {
+        PageHistory *h = &page_history[checkpoint->pages[j]];
+        int64_t k = page_history_find(h, checkpoint->seq);
+        assert(k >= 0 && h->v[k].seq == checkpoint->seq);
+        if (k + 1 < h->n && h->v[k + 1].seq == next->seq) {
+            page_store_put(h->v[k].page);
+            memmove(&h->v[k], &h->v[k + 1], (h->n - k - 1) * sizeof(PageVersion));
+            h->n--;
+        } else {
+            h->v[k].seq = next->seq;
+            checkpoint_add_page(next, checkpoint->pages[j]);
+        }
+    }
+
+    close(checkpoint->memfd);
+    total_usage -= checkpoint->memfd_usage;
+    g_free(checkpoint->pages);
+    g_free(checkpoint);
+    memmove(&checkpoints[i], &checkpoints[i + 1],
+            (next_checkpoint_num - i - 1) * sizeof(Checkpoint *));
+    next_checkpoint_num--;
+}
+
+// While over budget, drop the checkpoint whose neighbours are closest
+// together, so the remaining ones stay spread over the replay.
+static void checkpoint_evict(void) {
+    while (checkpoint_budget && total_usage > checkpoint_budget) {
+        size_t i, victim = 0;
+        uint64_t best = UINT64_MAX;
+        for (i = 1; i + 1 < next_checkpoint_num; i++) {
+            uint64_t gap = checkpoints[i + 1]->guest_instr_count -
+                checkpoints[i - 1]->guest_instr_count;
+            if (checkpoints[i] != base_checkpoint && gap < best) {
+                best = gap;
+                victim = i;
+            }
+        }
+        if (victim == 0) break;
+        checkpoint_drop(victim);
+    }
+}
+
+void panda_checkpoint_set_budget(size_t bytes) {
+    checkpoint_budget = bytes;
+    checkpoint_evict();
+}
 
 /*
  * Returns closest checkpoint containing target_instr_count 
@@ -56,24 +331,24 @@ static size_t next_checkpoint_num = 0;
  * Return -1 if not found
  */
 int get_closest_checkpoint_num(uint64_t target_instr_count) {
-
-    // Check base cases 
-    if (checkpoints[next_checkpoint_num-1]->guest_instr_count < target_instr_count) {
-        return next_checkpoint_num;
-    } 
-
+    if (next_checkpoint_num == 0) {
+        return -1;
+    }
     if (target_instr_count == 0) {
         return 1;
     }
 
-    for (int i = 1; i < next_checkpoint_num; i++) {
-        if (checkpoints[i-1]->guest_instr_count < target_instr_count && target_instr_count <= checkpoints[i]->guest_instr_count) {
-            return i; 
+    // number of checkpoints strictly before target
+    size_t lo = 0, hi = next_checkpoint_num;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (checkpoints[mid]->guest_instr_count < target_instr_count) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
-
-    return -1;
-
+    return lo > 0 ? lo : -1;
 }
 
 size_t get_num_checkpoints(void) {
@@ -85,7 +360,9 @@ size_t get_num_checkpoints(void) {
  * If idx <= 0, return last one
  */
 Checkpoint* get_checkpoint(int num) {
-    if (num <= 0) {
+    if (next_checkpoint_num == 0) {
+        return NULL;
+    } else if (num <= 0) {
         return checkpoints[next_checkpoint_num-1]; 
     } else if (num <= next_checkpoint_num) {
         return checkpoints[num-1];
@@ -97,30 +374,36 @@ Checkpoint* get_checkpoint(int num) {
 /*
  * Perform replay checkpoint which we can later rewind to.
  *
+ * Checkpoints are kept in instruction order. Asking for one at or before
+ * the newest (e.g. when running forward again after a restore) returns the
+ * closest existing checkpoint instead.
+ *
  * Returns: checkpoint ID for later resume.
  */
 void *panda_checkpoint(void) {
     assert(rr_in_replay());
 
-    if (next_checkpoint_num >= MAX_CHECKPOINTS) { 
-        printf("panda_checkpoint: Cannot make any more checkpoints!\n");
-        return NULL;
-    }
-
     uint64_t instr_count = rr_get_guest_instr_count();
 
-    /* Find last existing checkpoint before this point */
-    //Checkpoint *check = NULL;
-    //for (int i = 0; i < next_checkpoint_num; i++) {
-        //check = checkpoints[i];
-        //if (check->guest_instr_count > instr_count) break;
-    //}
+    if (next_checkpoint_num > 0 &&
+            instr_count <= checkpoints[next_checkpoint_num-1]->guest_instr_count) {
+        int num = get_closest_checkpoint_num(instr_count + 1);
+        return num > 0 ? get_checkpoint(num) : NULL;
+    }
 
-    Checkpoint *checkpoint = (Checkpoint *)malloc(sizeof(Checkpoint));
+    if (!page_store) {
+        page_store = g_hash_table_new(page_store_hash, page_store_equal);
+        memory_global_dirty_log_start();
+    }
+    checkpoint_sync_dirty();
+    // after a restore RAM is relative to an older checkpoint than the newest
+    if (base_checkpoint) {
+        mark_changed_pages(checkpoint_index(base_checkpoint),
+                           next_checkpoint_num - 1);
+    }
 
-    // TODO: Do we want to insert checkpoint in list in order?
-    checkpoints[next_checkpoint_num] = checkpoint;
-    next_checkpoint_num++;
+    Checkpoint *checkpoint = g_new0(Checkpoint, 1);
+    checkpoint->seq = next_seq++;
     checkpoint->guest_instr_count = instr_count;
     checkpoint->nondet_log_position = rr_queue_head
         ? rr_queue_head->header.file_pos
@@ -133,6 +416,11 @@ void *panda_checkpoint(void) {
     checkpoint->max_num_queue_entries = rr_max_num_queue_entries;
     checkpoint->next_progress = rr_next_progress;
 
+    size_t store_usage = total_usage;
+    qemu_ram_foreach_block(save_dirty_block, checkpoint);
+    bitmap_zero(dirty, num_ram_pages);
+    store_usage = total_usage - store_usage;
+
     checkpoint->memfd = memfd_create("checkpoint", 0);
     assert(checkpoint->memfd >= 0);
 
@@ -140,22 +428,32 @@ void *panda_checkpoint(void) {
     QEMUFile *file = qemu_fopen_channel_output(QIO_CHANNEL(iochannel));
 
     global_state_store_running();
-    qemu_savevm_state(file, NULL);
+    qemu_save_device_state(file);
 
     qemu_fflush(file);
     checkpoint->memfd_usage = lseek(checkpoint->memfd, 0, SEEK_CUR);
     total_usage += checkpoint->memfd_usage;
 
-    printf("Created checkpoint @ %" PRIu64 ". Size %.1f MB. Total usage %.1f GB\n",
-            instr_count, ((float) checkpoint->memfd_usage) / (1 << 20),
+    if (next_checkpoint_num == max_checkpoints) {
+        max_checkpoints = MAX(64, 2 * max_checkpoints);
+        checkpoints = g_renew(Checkpoint *, checkpoints, max_checkpoints);
+    }
+    checkpoints[next_checkpoint_num++] = checkpoint;
+    base_checkpoint = checkpoint;
+
+    printf("Created checkpoint @ %" PRIu64 ". %zu pages changed, %.1f MB new. Total usage %.1f GB\n",
+            instr_count, checkpoint->num_pages,
+            ((float) (checkpoint->memfd_usage + store_usage)) / (1 << 20),
             ((float) total_usage) / (1 << 30));
 
+    checkpoint_evict();
     return checkpoint;
 }
 
-
 void panda_restore_by_num(int num) {
-    if (num <= 0) {
+    if (next_checkpoint_num == 0) {
+        return;
+    } else if (num <= 0) {
         panda_restore(checkpoints[next_checkpoint_num-1]); 
     } else if (num <= next_checkpoint_num) {
         if (checkpoints[num-1] != NULL) {
@@ -170,11 +468,24 @@ void panda_restore(void *opaque) {
     Checkpoint *checkpoint = (Checkpoint *)opaque;
     printf("Restarting checkpoint @ instr count %" PRIu64 "\n", checkpoint->guest_instr_count);
         
+    qemu_system_reset(VMRESET_SILENT);
+
+    // RAM goes back first since device post_load hooks may look at it.
+    // Bring back the pages that differ from the checkpoint: everything
+    // written since the base (the reset included) plus whatever changed
+    // between the base and the checkpoint.
+    checkpoint_sync_dirty();
+    size_t from = checkpoint_index(base_checkpoint);
+    size_t to = checkpoint_index(checkpoint);
+    mark_changed_pages(MIN(from, to), MAX(from, to));
+    qemu_ram_foreach_block(restore_dirty_block, checkpoint);
+    bitmap_zero(dirty, num_ram_pages);
+    base_checkpoint = checkpoint;
+
     lseek(checkpoint->memfd, 0, SEEK_SET);
 
     QIOChannelFile *iochannel = qio_channel_file_new_fd(checkpoint->memfd);
     QEMUFile *file = qemu_fopen_channel_input(QIO_CHANNEL(iochannel));
-    qemu_system_reset(VMRESET_SILENT);
     MigrationIncomingState* mis = migration_incoming_get_current();
     mis->from_src_file = file;
 
@@ -182,12 +493,11 @@ void panda_restore(void *opaque) {
     assert(snapshot_ret >= 0);
 
     migration_incoming_state_destroy();
+    tb_flush(first_cpu);
 
     first_cpu->rr_guest_instr_count = checkpoint->guest_instr_count;
     first_cpu->panda_guest_pc = panda_current_pc(first_cpu);
-    rr_nondet_log->bytes_read = checkpoint->nondet_log_position;
-    fseek(rr_nondet_log->fp, checkpoint->nondet_log_position, SEEK_SET);
-    rr_queue_head = rr_queue_tail = NULL;
+    rr_replay_seek(checkpoint->nondet_log_position);
 
     memcpy(rr_number_of_log_entries, checkpoint->number_of_log_entries,
             sizeof(rr_number_of_log_entries));
@@ -6,6 +6,7 @@
 #include "panda/debug.h"
 #include "panda/plugin.h"
 #include "panda/common.h"
+#include "panda/callbacks/cb-dispatch.h"
 #include "panda/plog.h"
 #include "panda/plog-cc-bridge.h"
 
@@ -190,6 +191,9 @@ void panda_set_os_name(char *os_name) {
 }
 
 void panda_cleanup(void) {
+    if (panda_cb_profiling) {
+        panda_cb_stats_dump(stderr);
+    }
     // PANDA: unload plugins
     panda_unload_plugins();
     if (pandalog) {
@@ -224,6 +228,102 @@ MemoryRegion* panda_find_ram(void) {
     return ram;
 }
 
+PandaV2PEntry *panda_v2p_fill(CPUState *cpu, target_ulong page) {
+    struct PandaV2PCache *c = cpu->panda_v2p_cache;
+    PandaV2PEntry *e;
+    MemoryRegion *mr;
+    hwaddr l = TARGET_PAGE_SIZE;
+    hwaddr addr1;
+    hwaddr ppage = cpu_get_phys_page_debug(cpu, page);
+
+    if (ppage == -1) {
+        return NULL;
+    }
+    if (c == NULL) {
+        c = cpu->panda_v2p_cache = g_new(struct PandaV2PCache, 1);
+        panda_v2p_cache_flush(cpu);
+    }
+
+    e = &c->e[(page >> TARGET_PAGE_BITS) & (PANDA_V2P_CACHE_SIZE - 1)];
+    e->vpage = page;
+    e->ppage = ppage;
+    e->host = NULL;
+    e->host_writable = false;
+
+    // keep a host pointer only if the whole page is directly accessible
+    rcu_read_lock();
+    mr = address_space_translate(&address_space_memory, ppage, &addr1, &l, false);
+    if (l == TARGET_PAGE_SIZE && memory_access_is_direct(mr, false)) {
+        e->host = qemu_map_ram_ptr(mr->ram_block, addr1);
+        e->host_writable = memory_access_is_direct(mr, true);
+    }
+    rcu_read_unlock();
+    return e;
+}
+
+void panda_v2p_cache_flush(CPUState *cpu) {
+    struct PandaV2PCache *c = cpu->panda_v2p_cache;
+    int i;
+
+    if (c == NULL) {
+        return;
+    }
+    for (i = 0; i < PANDA_V2P_CACHE_SIZE; i++) {
+        c->e[i].vpage = -1;
+    }
+}
+
+void panda_v2p_cache_flush_page(CPUState *cpu, target_ulong addr) {
+    // Entries are 4K pieces of whatever mapping covered them, and the guest
+    // drops a large page by flushing just one address in it.  QEMU only
+    // widens that to a full flush for large pages in its own TLB, so we
+    // can't tell which of our entries go with it; the cache is small, drop
+    // everything.
+    panda_v2p_cache_flush(cpu);
+}
+
+int panda_virtual_memory_readv(CPUState *env, PandaVirtRead *reads, int n) {
+    PandaVirtRead *r;
+    PandaV2PEntry *e;
+    target_ulong page;
+    bool changed_priv = false;
+    int failed = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        r = &reads[i];
+        page = r->addr & TARGET_PAGE_MASK;
+
+        // the common case: a field within one RAM page
+        if (r->len > 0 && (r->addr + r->len - 1) - page < TARGET_PAGE_SIZE) {
+            e = panda_v2p_lookup(env, page);
+            if (e == NULL && !changed_priv && (changed_priv = enter_priv(env))) {
+                e = panda_v2p_lookup(env, page);
+            }
+            if (e != NULL && e->host != NULL) {
+                memcpy(r->buf, e->host + (r->addr & ~TARGET_PAGE_MASK), r->len);
+                r->ret = 0;
+                continue;
+            }
+        }
+
+        // spans pages, isn't mapped, or isn't RAM. enter_priv() doesn't
+        // nest, so leave privileged mode to panda_virtual_memory_rw().
+        if (changed_priv) {
+            exit_priv(env);
+            changed_priv = false;
+        }
+        r->ret = panda_virtual_memory_rw(env, r->addr, r->buf, r->len, false);
+        if (r->ret != 0) {
+            failed++;
+        }
+    }
+    if (changed_priv) {
+        exit_priv(env);
+    }
+    return failed;
+}
+
 #ifdef TARGET_ARM
 #define CPSR_M (0x1fU)
 #define ARM_CPU_MODE_SVC 0x13
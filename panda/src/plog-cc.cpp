@@ -1,16 +1,195 @@
 
+#include <algorithm>
 #include <cinttypes>
 #include <iostream>
 #include <math.h>
 #include <fstream>
 #include <memory>
+#include "config-host.h"
 #include "panda/plog-cc.hpp"
 #include "panda/plog-cc-bridge.h"
 
+#ifdef CONFIG_ZSTD
+#include <zstd.h>
+#endif
+#ifdef CONFIG_LZ4
+#include <lz4frame.h>
+#endif
+
 using namespace std; 
 
 extern int panda_in_main_loop;
 
+// Codecs. Compression can always be given a buffer of pl_compress_bound
+// bytes; decompression reports a buffer that is too small so the caller can
+// grow it, up to PL_MAX_UNCOMPRESSED. Anything bigger is a corrupt chunk.
+
+enum { PL_UNCOMPRESS_OK, PL_UNCOMPRESS_GROW, PL_UNCOMPRESS_ERROR };
+
+#define PL_MAX_UNCOMPRESSED (1UL << 30)
+
+bool pl_codec_supported(PlCodec codec) {
+    switch (codec) {
+    case PL_CODEC_NONE:
+    case PL_CODEC_ZLIB:
+        return true;
+#ifdef CONFIG_ZSTD
+    case PL_CODEC_ZSTD:
+        return true;
+#endif
+#ifdef CONFIG_LZ4
+    case PL_CODEC_LZ4:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+static size_t pl_compress_bound(PlCodec codec, size_t n) {
+    switch (codec) {
+    case PL_CODEC_ZLIB:
+        return compressBound(n);
+#ifdef CONFIG_ZSTD
+    case PL_CODEC_ZSTD:
+        return ZSTD_compressBound(n);
+#endif
+#ifdef CONFIG_LZ4
+    case PL_CODEC_LZ4:
+        return LZ4F_compressFrameBound(n, NULL);
+#endif
+    default:
+        return n;
+    }
+}
+
+// Returns the compressed size, 0 on error
+static size_t pl_compress(PlCodec codec, int level, unsigned char *dst,
+                          size_t dst_cap, const unsigned char *src, size_t n) {
+    switch (codec) {
+    case PL_CODEC_NONE:
+        memcpy(dst, src, n);
+        return n;
+    case PL_CODEC_ZLIB: {
+        unsigned long zlen = dst_cap;
+        if (compress2(dst, &zlen, src, n, level) != Z_OK) return 0;
+        return zlen;
+    }
+#ifdef CONFIG_ZSTD
+    case PL_CODEC_ZSTD: {
+        size_t zlen = ZSTD_compress(dst, dst_cap, src, n, level);
+        return ZSTD_isError(zlen) ? 0 : zlen;
+    }
+#endif
+#ifdef CONFIG_LZ4
+    case PL_CODEC_LZ4: {
+        LZ4F_preferences_t prefs;
+        memset(&prefs, 0, sizeof(prefs));
+        prefs.compressionLevel = level;
+        prefs.frameInfo.contentSize = n;
+        size_t zlen = LZ4F_compressFrame(dst, dst_cap, src, n, &prefs);
+        return LZ4F_isError(zlen) ? 0 : zlen;
+    }
+#endif
+    default:
+        return 0;
+    }
+}
+
+static int pl_uncompress(PlCodec codec, unsigned char *dst, unsigned long *dst_len,
+                         const unsigned char *src, size_t n) {
+    switch (codec) {
+    case PL_CODEC_NONE:
+        if (n > *dst_len) return PL_UNCOMPRESS_GROW;
+        memcpy(dst, src, n);
+        *dst_len = n;
+        return PL_UNCOMPRESS_OK;
+    case PL_CODEC_ZLIB: {
+        unsigned long cap = *dst_len;
+        int ret = uncompress(dst, dst_len, src, n);
+        // Z_BUF_ERROR with room left over means the input was cut short
+        if (ret == Z_BUF_ERROR && *dst_len == cap) return PL_UNCOMPRESS_GROW;
+        return ret == Z_OK ? PL_UNCOMPRESS_OK : PL_UNCOMPRESS_ERROR;
+    }
+#ifdef CONFIG_ZSTD
+    case PL_CODEC_ZSTD: {
+        size_t len = ZSTD_decompress(dst, *dst_len, src, n);
+        if (ZSTD_isError(len)) {
+            return ZSTD_getErrorCode(len) == ZSTD_error_dstSize_tooSmall ?
+                PL_UNCOMPRESS_GROW : PL_UNCOMPRESS_ERROR;
+        }
+        *dst_len = len;
+        return PL_UNCOMPRESS_OK;
+    }
+#endif
+#ifdef CONFIG_LZ4
+    case PL_CODEC_LZ4: {
+        LZ4F_dctx *dctx;
+        if (LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION))) {
+            return PL_UNCOMPRESS_ERROR;
+        }
+        size_t out = 0, in = 0, ret = 1;
+        while (ret != 0 && in < n && out < *dst_len) {
+            size_t out_sz = *dst_len - out, in_sz = n - in;
+            ret = LZ4F_decompress(dctx, dst + out, &out_sz, src + in, &in_sz, NULL);
+            if (LZ4F_isError(ret)) break;
+            out += out_sz;
+            in += in_sz;
+        }
+        LZ4F_freeDecompressionContext(dctx);
+        if (LZ4F_isError(ret)) return PL_UNCOMPRESS_ERROR;
+        if (ret != 0) {
+            return out == *dst_len ? PL_UNCOMPRESS_GROW : PL_UNCOMPRESS_ERROR;
+        }
+        *dst_len = out;
+        return PL_UNCOMPRESS_OK;
+    }
+#endif
+    default:
+        return PL_UNCOMPRESS_ERROR;
+    }
+}
+
+const char *pl_codec_name(PlCodec codec) {
+    switch (codec) {
+    case PL_CODEC_NONE: return "none";
+    case PL_CODEC_ZLIB: return "zlib";
+    case PL_CODEC_ZSTD: return "zstd";
+    case PL_CODEC_LZ4: return "lz4";
+    default: return "unknown";
+    }
+}
+
+bool pl_uncompress_chunk(PlCodec codec, const unsigned char *src, size_t n,
+                         std::vector<unsigned char> &out) {
+    if (out.size() < std::max<size_t>(n, 1 << 12)) {
+        out.resize(std::max<size_t>(n, 1 << 12));
+    }
+    for (;;) {
+        unsigned long len = out.size();
+        int ret = pl_uncompress(codec, out.data(), &len, src, n);
+        if (ret == PL_UNCOMPRESS_OK) {
+            out.resize(len);
+            return true;
+        }
+        if (ret != PL_UNCOMPRESS_GROW || out.size() >= PL_MAX_UNCOMPRESSED) {
+            return false;
+        }
+        out.resize(std::min<size_t>(out.size() * 2, PL_MAX_UNCOMPRESSED));
+    }
+}
+
+void PandaLog::set_codec(PlCodec codec, int level) {
+    assert(this->mode != PL_MODE_WRITE);
+    this->codec = codec;
+    this->level = level;
+}
+
+void PandaLog::set_threads(unsigned n) {
+    assert(this->mode != PL_MODE_WRITE);
+    this->nthreads = n;
+}
+
 void PandaLog::create(uint32_t chunk_size) {
     this->chunk.size = chunk_size;
     this->chunk.zsize = chunk_size;
@@ -29,6 +208,11 @@ void PandaLog::read_dir(){
     PlHeader *plh = read_header();
 
     printf("Header: version: %u dir_pos: %" PRIu64 " chunk_size: %u\n", plh->version, plh->dir_pos, plh->chunk_size);
+    if (plh->version > PL_CURRENT_VERSION) {
+        printf("Pandalog version %u is newer than this reader (%u)\n",
+               plh->version, PL_CURRENT_VERSION);
+        exit(1);
+    }
     
     this->chunk.size = plh->chunk_size;
     this->chunk.zsize = plh->chunk_size;
@@ -38,6 +222,13 @@ void PandaLog::read_dir(){
 
     this->chunk.zbuf = (unsigned char *) realloc(this->chunk.zbuf, this->chunk.size);
 
+    this->codec = plh->version >= 3 ? (PlCodec) plh->codec : PL_CODEC_ZLIB;
+    if (!pl_codec_supported(this->codec)) {
+        printf("Pandalog uses codec %s, which this build doesn't support\n",
+               pl_codec_name(this->codec));
+        exit(1);
+    }
+
     this->file->seekg(plh->dir_pos);
     uint32_t num_chunks;
     this->file->read((char*)&num_chunks, sizeof(num_chunks));
@@ -61,8 +252,9 @@ void PandaLog::read_dir(){
         printf("i: %d dirinstr: %" PRIu64 " dirpos: %" PRIu64 " dir.num_entries: %" PRIu64 "\n", i, dir.instr[i], dir.pos[i], dir.num_entries[i]);
     }
 
-    // a little hack so unmarshall_chunk will work
-    this->dir.pos[num_chunks] = plh->dir_pos;
+    // a little hack so unmarshall_chunk will work: the last chunk ends
+    // where the directory starts
+    this->dir.pos.push_back(plh->dir_pos);
 }
 
 PlHeader* PandaLog::read_header(){
@@ -110,6 +302,23 @@ void PandaLog::open(const char *path, const char* mode){
 void PandaLog::open_write(const char* filepath, uint32_t chunk_size){
     create(chunk_size);
 
+    // the chunk being filled, plus enough for every thread to be compressing
+    // one and one more finished chunk waiting for its turn to be written
+    unsigned num_jobs = this->nthreads == 0 ? 1 : this->nthreads + 2;
+    for (unsigned i = 0; i < num_jobs; i++) {
+        std::unique_ptr<PandalogCcJob> job(new PandalogCcJob());
+        job->buf.resize(chunk_size);
+        job->len = 0;
+        job->num_entries = 0;
+        this->free_jobs.push_back(job.get());
+        this->jobs.push_back(std::move(job));
+    }
+    this->cur = this->free_jobs.back();
+    this->free_jobs.pop_back();
+    for (unsigned i = 0; i < this->nthreads; i++) {
+        this->workers.push_back(std::thread(&PandaLog::worker, this));
+    }
+
     fstream *plog_file = new fstream();
 
     this->mode = PL_MODE_WRITE;
@@ -123,7 +332,9 @@ void PandaLog::open_write(const char* filepath, uint32_t chunk_size){
     // skip over header to be ready to write first chunk
     // NB: we will write the header later, when we write the directory.
     
-    this->file->seekg(this->chunk.start_pos);
+    this->file->seekp(this->chunk.start_pos);
+    printf("pandalog: %s chunks, level %d, %u compression threads\n",
+           pl_codec_name(this->codec), this->level, this->nthreads);
 
     this->chunk_num = 0;
     // write bogus initial chunk
@@ -200,7 +411,7 @@ std::unique_ptr<panda::LogEntry> PandaLog::read_entry(){
 
 void PandaLog::write_header(PlHeader* plh){
     //go to beginning of file
-    this->file->seekg(0);
+    this->file->seekp(0);
     this->file->write((char *)plh, sizeof(*plh));
 }
 
@@ -210,13 +421,15 @@ void PandaLog::write_dir(){
 
     //create header
     PlHeader plh;
+    memset(&plh, 0, sizeof(plh));
     plh.version = PL_CURRENT_VERSION;
     
     plh.dir_pos = this->file->tellp();
     plh.chunk_size = this->chunk.size;
+    plh.codec = this->codec;
 
-    printf("header: version=%d  dir_pos=%" PRIu64 " chunk_size=%d\n",
-            plh.version, plh.dir_pos, plh.chunk_size);
+    printf("header: version=%d  dir_pos=%" PRIu64 " chunk_size=%d codec=%s\n",
+            plh.version, plh.dir_pos, plh.chunk_size, pl_codec_name(this->codec));
 
     // now go ahead and write dir where we are in logfile
     this->file->write((char*) &num_chunks, sizeof(num_chunks));
@@ -231,19 +444,44 @@ void PandaLog::write_dir(){
     write_header(&plh);
 }
 
-void PandaLog::add_dir_entry(){
+void PandaLog::add_dir_entry(PandalogCcJob *job, uint64_t pos){
     // this is start instr and start file position for this chunk
-    this->dir.instr.push_back(this->chunk.start_instr);
-    this->dir.pos.push_back(this->chunk.start_pos);
+    this->dir.instr.push_back(job->start_instr);
+    this->dir.pos.push_back(pos);
     // and this is the number of entries in this chunk
-    this->dir.num_entries.push_back(this->chunk.ind_entry);
+    this->dir.num_entries.push_back(job->num_entries);
 }
 
 int PandaLog::close(){
 
     if (this->mode == PL_MODE_WRITE){
-        write_current_chunk();
-        add_dir_entry();
+        if (this->nthreads == 0) {
+            write_current_chunk();
+        } else {
+            // hand off the last chunk and wait for everything to be written
+            std::unique_lock<std::mutex> lock(this->mtx);
+            this->cur->seq = this->chunk_num++;
+            this->cur->start_instr = this->chunk.start_instr;
+            this->cur->done = false;
+            this->inflight.push_back(this->cur);
+            this->todo.push_back(this->cur);
+            this->cur = NULL;
+            this->work_cv.notify_one();
+            while (!this->inflight.empty()) {
+                this->free_cv.wait(lock);
+            }
+            this->stopping = true;
+            this->work_cv.notify_all();
+            lock.unlock();
+            for (auto &t : this->workers) {
+                t.join();
+            }
+            this->workers.clear();
+            if (this->stalls > 0) {
+                printf("pandalog: waited for a chunk to be compressed %" PRIu64 " times\n",
+                       this->stalls);
+            }
+        }
         write_dir();
     }
 
@@ -251,15 +489,73 @@ int PandaLog::close(){
     return 0;
 }
 
-// compress current chunk and write it to file,
-// also update directory map
+// compress a full chunk; runs on the compression threads
+void PandaLog::compress_job(PandalogCcJob *job){
+    size_t bound = pl_compress_bound(this->codec, job->len);
+    if (job->zbuf.size() < bound) {
+        job->zbuf.resize(bound);
+    }
+    job->zlen = pl_compress(this->codec, this->level, job->zbuf.data(),
+                            job->zbuf.size(), job->buf.data(), job->len);
+    assert(job->zlen > 0 || job->len == 0);
+}
+
+// append a compressed chunk to the file and the directory; chunks must
+// come through here in order
+void PandaLog::write_job(PandalogCcJob *job){
+    printf("writing chunk %u of pandalog, %zu / %zu = %.2f compression, %u entries\n",
+            job->seq, job->len, job->zlen, ((float)job->len) / job->zlen,
+            job->num_entries);
+    if (job->num_entries == 0) {
+        printf("WARNING: Empty chunk written to pandalog. Did you forget?\n");
+    }
+
+    uint64_t pos = this->file->tellp();
+    this->file->write((char*)job->zbuf.data(), job->zlen);
+    add_dir_entry(job, pos);
+}
+
+void PandaLog::worker(){
+    std::unique_lock<std::mutex> lock(this->mtx);
+    for (;;) {
+        while (this->todo.empty() && !this->stopping) {
+            this->work_cv.wait(lock);
+        }
+        if (this->todo.empty()) {
+            return;
+        }
+        PandalogCcJob *job = this->todo.front();
+        this->todo.pop_front();
+        lock.unlock();
+        compress_job(job);
+        lock.lock();
+        job->done = true;
+
+        // Write out whatever is ready at the front, one thread at a time,
+        // so the chunks and the directory stay in order
+        if (this->writing) {
+            continue;
+        }
+        this->writing = true;
+        while (!this->inflight.empty() && this->inflight.front()->done) {
+            PandalogCcJob *ready = this->inflight.front();
+            this->inflight.pop_front();
+            lock.unlock();
+            write_job(ready);
+            lock.lock();
+            ready->len = 0;
+            ready->num_entries = 0;
+            this->free_jobs.push_back(ready);
+            this->free_cv.notify_all();
+        }
+        this->writing = false;
+    }
+}
+
+// hand the current chunk off to be compressed and written,
+// and start a new one
 void PandaLog::write_current_chunk(){
 #ifndef PLOG_READER 
-    //uncompressed chunk size
-    unsigned long chunk_sz = this->chunk.buf_p - this->chunk.buf;
-    unsigned long ccs = this->chunk.zsize;
-    int ret;
-
     if (this->filename == NULL) {
       fprintf(stderr,"ERROR: Attempted to write to pandalog  but there isn't one! Did " \
                      " you run with -pandalog [filename]?\n");
@@ -268,41 +564,65 @@ void PandaLog::write_current_chunk(){
       return;
     }
 
-    // loop allows compress2 to fail and resize output buffer as needed
-    uint32_t i;
-    for (i=0; i<10; i++) {
-        ret = compress2(this->chunk.zbuf, &ccs, this->chunk.buf, chunk_sz, Z_BEST_COMPRESSION);
-        
-        if (ret == Z_OK) break;
-        // bigger output buffer needed to perform compression?
-        this->chunk.zsize *= 2;
-        this->chunk.zbuf = (unsigned char *) realloc(this->chunk.zbuf, this->chunk.zsize);
-        assert (this->chunk.zbuf != NULL);
-    }
-
-    // ccs is final compressed chunk size
-    assert(ret == Z_OK);
-    printf("writing chunk %u of pandalog, %lu / %lu = %.2f compression, %u entries\n",
-            this->chunk_num, chunk_sz, ccs, ((float)chunk_sz) / ccs,
-            this->chunk.ind_entry);
-    if (this->chunk.ind_entry == 0) {
-        printf("WARNING: Empty chunk written to pandalog. Did you forget?\n");
+    PandalogCcJob *job = this->cur;
+    job->seq = this->chunk_num++;
+    job->start_instr = this->chunk.start_instr;
+    job->done = false;
+    // reset start instr
+    this->chunk.start_instr = rr_get_guest_instr_count();
+
+    if (this->nthreads == 0) {
+        compress_job(job);
+        write_job(job);
+        job->len = 0;
+        job->num_entries = 0;
+        return;
     }
 
-    this->file->write((char*)this->chunk.zbuf, ccs);
-    //assert(this->)
-    add_dir_entry();
-    // reset start instr / pos
-    this->chunk.start_instr = rr_get_guest_instr_count();
-    this->chunk.start_pos = this->file->tellg();
-    // rewind chunk buf and inc chunk #
-    this->chunk.buf_p = this->chunk.buf;
-    this->chunk_num ++;
-    this->chunk.ind_entry = 0;
+    std::unique_lock<std::mutex> lock(this->mtx);
+    this->inflight.push_back(job);
+    this->todo.push_back(job);
+    this->work_cv.notify_one();
+    if (this->free_jobs.empty()) {
+        this->stalls++;
+        while (this->free_jobs.empty()) {
+            this->free_cv.wait(lock);
+        }
+    }
+    this->cur = this->free_jobs.back();
+    this->free_jobs.pop_back();
 #endif
 }
 
-uint64_t last_instr_entry = -1;
+unsigned char *PandaLog::reserve_entry(size_t n, uint64_t instr){
+    PandalogCcJob *job = this->cur;
+
+    // invariant: all log entries for an instruction belong in a single chunk
+    if(this->last_instr_entry != (uint64_t)-1
+        && (this->last_instr_entry != instr)
+        && (job->len + n >= this->chunk.size)) {
+        // if entry won't fit in current chunk
+        // and new entry is a different instr from last entry written
+        write_current_chunk();
+        job = this->cur;
+    }
+
+    // grow the chunk if need be
+    if (job->len + sizeof(uint32_t) + n > job->buf.size()) {
+        job->buf.resize(std::max(job->buf.size() * 2,
+                                 job->len + sizeof(uint32_t) + n));
+    }
+
+    // entries are stored as size then entry itself
+    uint32_t size = n;
+    memcpy(job->buf.data() + job->len, &size, sizeof(size));
+    unsigned char *p = job->buf.data() + job->len + sizeof(size);
+    job->len += sizeof(size) + n;
+    // remember instr for last entry
+    this->last_instr_entry = instr;
+    job->num_entries ++;
+    return p;
+}
 
 void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
 #ifndef PLOG_READER 
@@ -316,36 +636,14 @@ void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
     }
 
     size_t n = entry->ByteSize();
+    unsigned char *p = reserve_entry(n, entry->instr());
+    entry->SerializeToArray(p, n);
+#endif
+}
 
-    // invariant: all log entries for an instruction belong in a single chunk
-    if(last_instr_entry != -1 
-        && (last_instr_entry != entry->instr())
-        && (this->chunk.buf_p + n  >= this->chunk.buf + this->chunk.size)) {
-        // if entry won't fit in current chunk
-        // and new entry is a different instr from last entry written
-            write_current_chunk();
-    }
-
-    // create another chunk
-    if (this->chunk.buf_p + sizeof(uint32_t) + n
-        >= this->chunk.buf + ((int)(floor(this->chunk.size)))) {
-
-        uint32_t offset = this->chunk.buf_p - this->chunk.buf;
-        uint32_t new_size = offset * 2;
-        this->chunk.buf = (unsigned char *) realloc(this->chunk.buf, new_size);
-        this->chunk.buf_p = this->chunk.buf + offset;
-        assert (this->chunk.buf != NULL);
-    }
-
-    // now write the entry itself to the buffer.  size then entry itself
-    *((uint32_t *) this->chunk.buf_p) = n;
-    this->chunk.buf_p += sizeof(uint32_t);
-    // and then the entry itself (packed)
-    entry->SerializeToArray(this->chunk.buf_p, n);
-    this->chunk.buf_p += n;
-    // remember instr for last entry
-    last_instr_entry = entry->instr();
-    this->chunk.ind_entry ++;
+void PandaLog::write_packed(const unsigned char *buf, size_t n, uint64_t instr){
+#ifndef PLOG_READER 
+    memcpy(reserve_entry(n, instr), buf, n);
 #endif
 }
 
@@ -355,8 +653,12 @@ void PandaLog::unmarshall_chunk(uint32_t chunk_num){
     // read compressed chunk data off disk
     this->file->seekg(this->dir.pos[chunk_num]);
 
-    unsigned long compressed_size = this->dir.pos[chunk_num+1] - this->dir.pos[chunk_num] + 1;
-     this->file->read((char* ) chunk->zbuf, compressed_size);
+    unsigned long compressed_size = this->dir.pos[chunk_num+1] - this->dir.pos[chunk_num];
+    if (compressed_size > chunk->zsize) {
+        chunk->zsize = compressed_size;
+        chunk->zbuf = (unsigned char *) realloc(chunk->zbuf, chunk->zsize);
+    }
+    this->file->read((char* ) chunk->zbuf, compressed_size);
     assert (this->file->gcount() == compressed_size);
     unsigned long uncompressed_size = chunk->size;
 
@@ -365,11 +667,12 @@ void PandaLog::unmarshall_chunk(uint32_t chunk_num){
 
     int ret;
     while (true) {
-        ret = uncompress(chunk->buf, &uncompressed_size, chunk->zbuf, compressed_size);
+        ret = pl_uncompress(this->codec, chunk->buf, &uncompressed_size,
+                            chunk->zbuf, compressed_size);
 
         printf ("ret = %d\n", ret);
 
-        if (ret == Z_BUF_ERROR) {
+        if (ret == PL_UNCOMPRESS_GROW) {
             // need a bigger buffer
             // make sure we won't int overflow
             assert (chunk->size < UINT32_MAX/2);
@@ -379,7 +682,7 @@ void PandaLog::unmarshall_chunk(uint32_t chunk_num){
             chunk->buf = (unsigned char *)malloc(chunk->size);
             chunk->buf_p = chunk->buf;
             uncompressed_size = chunk->size;
-        } else if (ret == Z_OK) {
+        } else if (ret == PL_UNCOMPRESS_OK) {
             break;
         } else {
             assert(false && "Decompression failed");
@@ -507,6 +810,38 @@ void pandalog_cc_close(){
     globalLog.close();
 }
 
+bool pandalog_cc_set_codec(const char *spec){
+    static const PlCodec codecs[] = {
+        PL_CODEC_NONE, PL_CODEC_ZLIB, PL_CODEC_ZSTD, PL_CODEC_LZ4
+    };
+    std::string name(spec);
+    int level = -1;
+    size_t colon = name.find(':');
+    if (colon != std::string::npos) {
+        level = atoi(name.c_str() + colon + 1);
+        name.resize(colon);
+    }
+    for (PlCodec codec : codecs) {
+        if (name != pl_codec_name(codec)) continue;
+        if (!pl_codec_supported(codec)) return false;
+        if (level < 0) {
+            level = codec == PL_CODEC_ZSTD ? PL_ZSTD_LEVEL :
+                    codec == PL_CODEC_LZ4 ? PL_LZ4_LEVEL : PL_Z_LEVEL;
+        }
+        globalLog.set_codec(codec, level);
+        return true;
+    }
+    return false;
+}
+
+void pandalog_cc_set_threads(unsigned n){
+    globalLog.set_threads(n);
+}
+
+void pandalog_cc_write_packed(const unsigned char *buf, size_t n, uint64_t instr){
+    globalLog.write_packed(buf, n, instr);
+}
+
 
 // Unpack entry from buffer into C++ protobuf object
 // and write it to the log
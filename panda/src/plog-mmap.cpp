@@ -0,0 +1,350 @@
+/**
+ *
+ * Random-access pandalog reader, see panda/plog-mmap.hpp
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include "panda/plog-mmap.hpp"
+
+// LogEntry's required instr field, see panda/scripts/pp.py
+#define PL_FIELD_INSTR panda::LogEntry::kInstrFieldNumber
+
+static bool read_varint(const unsigned char *&p, const unsigned char *end,
+                        uint64_t *val) {
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        unsigned char b = *p++;
+        v |= (uint64_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            *val = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Walk the top-level fields of a packed LogEntry without parsing it,
+// calling on_field(number, value) for each (value is only meaningful for
+// varints). Returns false on anything unexpected.
+template <typename F>
+static bool scan_entry(const unsigned char *p, size_t n, F on_field) {
+    const unsigned char *end = p + n;
+    while (p < end) {
+        uint64_t tag, val = 0;
+        if (!read_varint(p, end, &tag)) return false;
+        switch (tag & 7) {
+        case 0:
+            if (!read_varint(p, end, &val)) return false;
+            break;
+        case 1:
+            p += 8;
+            break;
+        case 2:
+            if (!read_varint(p, end, &val) || val > (uint64_t)(end - p)) return false;
+            p += val;
+            break;
+        case 5:
+            p += 4;
+            break;
+        default:
+            // groups are not used in pandalog protos
+            return false;
+        }
+        if (p > end) return false;
+        on_field((uint32_t)(tag >> 3), val);
+    }
+    return true;
+}
+
+bool PandaLogMmap::open(const char *path) {
+    close();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < PL_HEADER_SIZE) {
+        ::close(fd);
+        return false;
+    }
+    void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) return false;
+    this->path = path;
+    this->base = (const unsigned char *) p;
+    this->size = st.st_size;
+
+    memcpy(&this->header, this->base, sizeof(PlHeader));
+    if (this->header.version > PL_CURRENT_VERSION
+        || this->header.dir_pos + sizeof(uint32_t) > this->size) {
+        close();
+        return false;
+    }
+    this->codec = this->header.version >= 3 ?
+        (PlCodec) this->header.codec : PL_CODEC_ZLIB;
+    if (!pl_codec_supported(this->codec)) {
+        printf("Pandalog uses codec %s, which this build doesn't support\n",
+               pl_codec_name(this->codec));
+        close();
+        return false;
+    }
+
+    // directory: u32 num_chunks, then (instr, pos, num_entries) per chunk
+    const unsigned char *d = this->base + this->header.dir_pos;
+    uint32_t num_chunks;
+    memcpy(&num_chunks, d, sizeof(num_chunks));
+    d += sizeof(num_chunks);
+    if (this->header.dir_pos + sizeof(uint32_t) + num_chunks * 24ULL > this->size) {
+        close();
+        return false;
+    }
+    this->chunks.resize(num_chunks);
+    for (uint32_t i = 0; i < num_chunks; i++) {
+        PandalogChunkInfo &c = this->chunks[i];
+        uint64_t v[3];
+        memcpy(v, d + i * sizeof(v), sizeof(v));
+        c.start_instr = v[0];
+        c.pos = v[1];
+        c.num_entries = v[2];
+        // until there's an index, a chunk could hold anything
+        c.first_instr = 0;
+        c.last_instr = UINT64_MAX;
+    }
+    // chunks are laid out in order between the header and the directory; a
+    // truncated or corrupt log would otherwise have us read past the file
+    for (uint32_t i = 0; i < num_chunks; i++) {
+        uint64_t next = i + 1 < num_chunks ? this->chunks[i+1].pos : this->header.dir_pos;
+        if (this->chunks[i].pos < PL_HEADER_SIZE || this->chunks[i].pos > next) {
+            close();
+            return false;
+        }
+        this->chunks[i].zsize = next - this->chunks[i].pos;
+    }
+    return true;
+}
+
+void PandaLogMmap::close() {
+    if (this->base) {
+        munmap((void *) this->base, this->size);
+    }
+    this->base = NULL;
+    this->size = 0;
+    this->indexed = false;
+    this->chunks.clear();
+}
+
+bool PandaLogMmap::read_chunk(uint32_t i, std::vector<unsigned char> &out) const {
+    const PandalogChunkInfo &c = this->chunks[i];
+    if (out.size() < this->header.chunk_size) {
+        out.resize(this->header.chunk_size);
+    }
+    return pl_uncompress_chunk(this->codec, this->base + c.pos, c.zsize, out);
+}
+
+uint32_t PandaLogMmap::field_number(const char *name) {
+    const google::protobuf::FieldDescriptor *fd =
+        panda::LogEntry::descriptor()->FindFieldByName(name);
+    return fd ? fd->number() : 0;
+}
+
+void PandaLogMmap::parallel_for(const std::vector<uint32_t> &which,
+                                const std::function<void(uint32_t)> &work) const {
+    std::atomic<size_t> next(0);
+    auto run = [&]() {
+        for (size_t k; (k = next++) < which.size(); ) {
+            work(which[k]);
+        }
+    };
+    std::vector<std::thread> threads;
+    unsigned n = std::min<size_t>(this->nthreads, which.size());
+    for (unsigned t = 1; t < n; t++) {
+        threads.push_back(std::thread(run));
+    }
+    run();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+void PandaLogMmap::index_chunk(uint32_t i) {
+    PandalogChunkInfo &c = this->chunks[i];
+    std::vector<unsigned char> buf;
+    std::vector<bool> seen;
+    c.first_instr = UINT64_MAX;
+    c.last_instr = 0;
+    c.fields.clear();
+    if (!read_chunk(i, buf)) {
+        // keep the chunk a candidate for every query
+        c.first_instr = 0;
+        c.last_instr = UINT64_MAX;
+        return;
+    }
+
+    const unsigned char *p = buf.data(), *end = p + buf.size();
+    for (uint64_t e = 0; e < c.num_entries && p + sizeof(uint32_t) <= end; e++) {
+        uint32_t n;
+        memcpy(&n, p, sizeof(n));
+        p += sizeof(n);
+        if (n > (size_t)(end - p)) break;
+        auto note = [&](uint32_t field, uint64_t val) {
+            if (field >= seen.size()) seen.resize(field + 1);
+            seen[field] = true;
+            // the bogus entry opening every log has instr -1
+            if (field == PL_FIELD_INSTR && val != UINT64_MAX) {
+                c.first_instr = std::min(c.first_instr, val);
+                c.last_instr = std::max(c.last_instr, val);
+            }
+        };
+        if (!scan_entry(p, n, note)) {
+            // let protobuf make sense of it
+            panda::LogEntry ple;
+            ple.ParseFromArray(p, n);
+            std::vector<const google::protobuf::FieldDescriptor *> fds;
+            ple.GetReflection()->ListFields(ple, &fds);
+            for (auto fd : fds) {
+                note(fd->number(), ple.instr());
+            }
+        }
+        p += n;
+    }
+    for (uint32_t f = 0; f < seen.size(); f++) {
+        if (seen[f]) c.fields.push_back(f);
+    }
+}
+
+void PandaLogMmap::build_index() {
+    std::vector<uint32_t> all(this->chunks.size());
+    for (uint32_t i = 0; i < all.size(); i++) all[i] = i;
+    parallel_for(all, [this](uint32_t i) { index_chunk(i); });
+    this->indexed = true;
+}
+
+bool PandaLogMmap::load_index() {
+    std::ifstream f(index_path(), std::ios::binary);
+    if (!f) return false;
+    char magic[8];
+    uint64_t dir_pos;
+    uint32_t num_chunks, reserved;
+    f.read(magic, sizeof(magic));
+    f.read((char *) &dir_pos, sizeof(dir_pos));
+    f.read((char *) &num_chunks, sizeof(num_chunks));
+    f.read((char *) &reserved, sizeof(reserved));
+    if (!f || memcmp(magic, PL_INDEX_MAGIC, sizeof(magic)) != 0
+        || dir_pos != this->header.dir_pos || num_chunks != this->chunks.size()) {
+        return false;
+    }
+    std::vector<PandalogChunkInfo> chunks = this->chunks;
+    for (auto &c : chunks) {
+        uint32_t num_fields;
+        f.read((char *) &c.first_instr, sizeof(c.first_instr));
+        f.read((char *) &c.last_instr, sizeof(c.last_instr));
+        f.read((char *) &num_fields, sizeof(num_fields));
+        if (!f) return false;
+        c.fields.resize(num_fields);
+        f.read((char *) c.fields.data(), num_fields * sizeof(uint32_t));
+    }
+    if (!f) return false;
+    this->chunks.swap(chunks);
+    this->indexed = true;
+    return true;
+}
+
+bool PandaLogMmap::save_index() const {
+    if (!this->indexed) return false;
+    std::ofstream f(index_path(), std::ios::binary | std::ios::trunc);
+    if (!f) return false;
+    uint32_t num_chunks = this->chunks.size(), reserved = 0;
+    f.write(PL_INDEX_MAGIC, 8);
+    f.write((const char *) &this->header.dir_pos, sizeof(this->header.dir_pos));
+    f.write((const char *) &num_chunks, sizeof(num_chunks));
+    f.write((const char *) &reserved, sizeof(reserved));
+    for (auto &c : this->chunks) {
+        uint32_t num_fields = c.fields.size();
+        f.write((const char *) &c.first_instr, sizeof(c.first_instr));
+        f.write((const char *) &c.last_instr, sizeof(c.last_instr));
+        f.write((const char *) &num_fields, sizeof(num_fields));
+        f.write((const char *) c.fields.data(), num_fields * sizeof(uint32_t));
+    }
+    return (bool) f;
+}
+
+// The slow check, for entries scan_entry couldn't make sense of
+static bool entry_matches(const panda::LogEntry &ple, uint32_t field,
+                          uint64_t start_instr, uint64_t end_instr) {
+    if (ple.instr() < start_instr || ple.instr() > end_instr) return false;
+    if (field == 0) return true;
+    const google::protobuf::FieldDescriptor *fd =
+        panda::LogEntry::descriptor()->FindFieldByNumber(field);
+    if (!fd) return false;
+    const google::protobuf::Reflection *r = ple.GetReflection();
+    return fd->is_repeated() ? r->FieldSize(ple, fd) > 0 : r->HasField(ple, fd);
+}
+
+void PandaLogMmap::query(uint32_t field, uint64_t start_instr, uint64_t end_instr,
+        const std::function<void(std::unique_ptr<panda::LogEntry>)> &f) const {
+    std::vector<uint32_t> candidates;
+    for (uint32_t i = 0; i < this->chunks.size(); i++) {
+        const PandalogChunkInfo &c = this->chunks[i];
+        if (c.first_instr > end_instr || c.last_instr < start_instr) continue;
+        if (this->indexed && field != 0
+            && !std::binary_search(c.fields.begin(), c.fields.end(), field)) {
+            continue;
+        }
+        candidates.push_back(i);
+    }
+
+    // Decompress and parse a window of chunks in parallel, then hand their
+    // entries over in order. The window bounds how much is held in memory.
+    size_t window = 2 * this->nthreads;
+    std::vector<std::vector<std::unique_ptr<panda::LogEntry>>> results(this->chunks.size());
+    for (size_t w = 0; w < candidates.size(); w += window) {
+        std::vector<uint32_t> batch(candidates.begin() + w,
+            candidates.begin() + std::min(w + window, candidates.size()));
+        parallel_for(batch, [&](uint32_t i) {
+            std::vector<unsigned char> buf;
+            if (!read_chunk(i, buf)) {
+                fprintf(stderr, "pandalog: can't decompress chunk %u\n", i);
+                return;
+            }
+            const unsigned char *p = buf.data(), *end = p + buf.size();
+            for (uint64_t e = 0; e < this->chunks[i].num_entries
+                    && p + sizeof(uint32_t) <= end; e++) {
+                uint32_t n;
+                memcpy(&n, p, sizeof(n));
+                p += sizeof(n);
+                if (n > (size_t)(end - p)) break;
+                // only parse entries that can match
+                bool has_field = field == 0, in_range = false;
+                bool ok = scan_entry(p, n, [&](uint32_t fld, uint64_t val) {
+                    if (fld == field) has_field = true;
+                    if (fld == PL_FIELD_INSTR) {
+                        in_range = start_instr <= val && val <= end_instr;
+                    }
+                });
+                if (ok && !(has_field && in_range)) {
+                    p += n;
+                    continue;
+                }
+                std::unique_ptr<panda::LogEntry> ple(new panda::LogEntry());
+                ple->ParseFromArray(p, n);
+                if (ok || entry_matches(*ple, field, start_instr, end_instr)) {
+                    results[i].push_back(std::move(ple));
+                }
+                p += n;
+            }
+        });
+        for (uint32_t i : batch) {
+            for (auto &ple : results[i]) {
+                f(std::move(ple));
+            }
+            results[i].clear();
+        }
+    }
+}
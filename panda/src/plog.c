@@ -5,13 +5,15 @@
   ---------------------
   Bytes 0 .. PL_HEADER_SIZE-1
 
-  Currently, the header consists of just three ints
+  Currently, the header consists of just four ints
 
   u32 version      (a version number)
   u64 dir_pos     (file position of directory)
   u32 chunk_size  (size of an uncompressed chunk for this log)
+  u32 codec       (PlCodec used for the chunks, since version 3;
+                   older logs are always zlib)
 
-  That's just 16 bytes.  Header is currently 128 so lots of room
+  That's just 24 bytes with padding.  Header is currently 128 so lots of room
 
 
   Section 2: The chunks
@@ -21,7 +23,9 @@
   This is where the compressed chunks go.  As we write the pandalog,
   we fill a buffer with raw, uncompressed entries.  When we have gone
   over the chunk_size and done with all entries for an instruction, we
-  compress that chunk of pandalog and write it to the file, keeping
+  hand that chunk to a pool of compression threads
+  (-pandalog-threads, -pandalog-codec) and start filling another one.
+  Compressed chunks are written to the file strictly in order, keeping
   track in an array the file position of the start of each chunk.  The
   next compressed chunk data will go right after the previous
   compressed chunk data.
@@ -65,6 +69,11 @@
 #include <zlib.h>
 
 #include "panda/plog.h"
+#include "panda/plog-cc-bridge.h"
+
+#ifndef PLOG_READER
+extern int panda_in_main_loop;
+#endif
 
 // Externed functions that are wrappers around the C++ pandalog functions
 extern void pandalog_write_packed(size_t entry_size, unsigned char* buf);
@@ -79,14 +88,29 @@ void pandalog_open_read(const char *path, uint32_t pl_mode);
 
 
 void pandalog_write_entry(Panda__LogEntry *entry) {
-	// Pack this entry and pass it on to a C++ interface
-		
+#ifndef PLOG_READER
+	// Stamp the entry and pack it straight into a buffer we keep around,
+	// so the C++ side can copy the bytes into the chunk without parsing them
+	static __thread unsigned char *buf = NULL;
+	static __thread size_t buf_size = 0;
+
+	if (panda_in_main_loop) {
+		entry->pc = panda_current_pc(first_cpu);
+		entry->instr = rr_get_guest_instr_count();
+	} else {
+		entry->pc = -1;
+		entry->instr = -1;
+	}
+
 	size_t packed_size = panda__log_entry__get_packed_size(entry);
-	unsigned char* buf = malloc(packed_size);
+	if (packed_size > buf_size) {
+		buf_size = MAX(packed_size, 2 * buf_size);
+		buf = g_realloc(buf, buf_size);
+	}
 	panda__log_entry__pack(entry, buf);
 
-	pandalog_write_packed(packed_size, buf);
-  free(buf);
+	pandalog_cc_write_packed(buf, packed_size, entry->instr);
+#endif
 }
 
 void pandalog_open_read(const char *path, uint32_t pl_mode) {
@@ -14,6 +14,7 @@
 
 #include <fstream>
 #include "panda/plog-cc.hpp"
+#include "panda/plog-mmap.hpp"
 
 /* plog-cc.cpp dependencies.
 
@@ -53,9 +54,40 @@ int main (int argc, char **argv) {
     memset(&cpus, 0, sizeof(cpus));
 
     if (argc < 2) {
-         printf("USAGE: %s <plog>\n", argv[0]);
+         printf("USAGE: %s <plog> [field [start_instr [end_instr]]]\n", argv[0]);
+         printf("       with a field (e.g. tainted_branch, or 'all'), only print\n"
+                "       entries that have it, using <plog>.idx (built if missing)\n"
+                "       to skip chunks\n");
          exit(1);
     }
+
+    // query through the random-access reader
+    if (argc > 2) {
+        PandaLogMmap p;
+        if (!p.open(argv[1])) {
+            printf("Can't open pandalog %s\n", argv[1]);
+            exit(1);
+        }
+        uint32_t field = 0;
+        if (strcmp(argv[2], "all") != 0) {
+            field = PandaLogMmap::field_number(argv[2]);
+            if (field == 0) {
+                printf("LogEntry has no field %s\n", argv[2]);
+                exit(1);
+            }
+        }
+        uint64_t start = argc > 3 ? strtoull(argv[3], NULL, 0) : 0;
+        uint64_t end = argc > 4 ? strtoull(argv[4], NULL, 0) : UINT64_MAX;
+        p.set_threads(std::thread::hardware_concurrency());
+        if (!p.load_index()) {
+            p.build_index();
+            p.save_index();
+        }
+        p.query(field, start, end, [](std::unique_ptr<panda::LogEntry> ple) {
+            printf("%s\n", ple->ShortDebugString().c_str());
+        });
+        return 0;
+    }
     
     //write the pandalog
     /*{*/
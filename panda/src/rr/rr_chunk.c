@@ -0,0 +1,441 @@
+/*
+ * Chunked, compressed nondet log (v2).  See rr_chunk.h for the layout.
+ *
+ * This file has no QEMU dependencies so that rr_print can link it.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+#include <zlib.h>
+
+#include "panda/rr/rr_chunk.h"
+
+// In the logical (v1) stream the entries follow a u64 last instr count.
+#define RR_V1_HEADER_SIZE sizeof(uint64_t)
+
+// Like rr_assert in rr_log.c: a failed write or read of the log is fatal.
+#define rr_chunk_check(exp)                                                    \
+    if (!(exp)) {                                                              \
+        rr_chunk_check_fail(#exp, __FILE__, __LINE__);                         \
+    }
+
+static void rr_chunk_check_fail(const char *exp, const char *file, int line) {
+    printf("RR rr_assertion `%s' failed at %s:%d\n", exp, file, line);
+    abort();
+}
+
+static void rr_chunked_write_header(RR_chunked_log *log, uint64_t dir_pos) {
+    uint8_t header[RR_CHUNK_HEADER_SIZE] = {0};
+    uint64_t magic = RR_CHUNK_MAGIC;
+    uint32_t version = RR_CHUNK_VERSION;
+
+    memcpy(header, &magic, 8);
+    memcpy(header + 8, &log->last_instr, 8);
+    memcpy(header + 16, &dir_pos, 8);
+    memcpy(header + 24, &version, 4);
+    memcpy(header + 28, &log->chunk_size, 4);
+
+    fseek(log->fp, 0, SEEK_SET);
+    size_t n = fwrite(header, sizeof(header), 1, log->fp);
+    rr_chunk_check(n == 1);
+}
+
+static void rr_chunked_reserve(uint8_t **buf, size_t *cap, size_t len) {
+    if (*cap < len) {
+        *cap = MAX(len, 2 * *cap);
+        *buf = g_realloc(*buf, *cap);
+    }
+}
+
+/* WRITE */
+
+RR_chunked_log *rr_chunked_open_write(const char *path, uint32_t chunk_size) {
+    RR_chunked_log *log = g_new0(RR_chunked_log, 1);
+
+    log->fp = fopen(path, "w");
+    if (!log->fp) {
+        g_free(log);
+        return NULL;
+    }
+    log->writing = true;
+    log->chunk_size = chunk_size ? chunk_size : RR_CHUNK_DEFAULT_SIZE;
+    rr_chunked_reserve(&log->buf, &log->buf_cap, log->chunk_size);
+    log->cur_chunk = -1;
+    log->offset = RR_V1_HEADER_SIZE;
+
+    // placeholder, rewritten by rr_chunked_close
+    rr_chunked_write_header(log, 0);
+    return log;
+}
+
+// Compress len bytes of buf into *zbuf; returns the compressed size.
+static uint32_t rr_chunked_compress(uint8_t **zbuf, size_t *zcap,
+                                    const uint8_t *buf, size_t len) {
+    rr_chunked_reserve(zbuf, zcap, compressBound(len));
+    unsigned long zsize = *zcap;
+    int ret = compress2(*zbuf, &zsize, buf, len, Z_DEFAULT_COMPRESSION);
+    assert(ret == Z_OK);
+    return zsize;
+}
+
+// Append a directory entry for the buffered entries; file_pos and zsize are
+// filled in once the chunk is written.
+static RR_chunk_dir_entry *rr_chunked_add_dir_entry(RR_chunked_log *log) {
+    if (log->num_chunks == log->max_chunks) {
+        log->max_chunks = log->max_chunks ? 2 * log->max_chunks : 128;
+        log->dir = g_renew(RR_chunk_dir_entry, log->dir, log->max_chunks);
+    }
+    RR_chunk_dir_entry *de = &log->dir[log->num_chunks++];
+    de->start_instr = log->entry_instr;
+    de->start_offset = log->offset - log->buf_len;
+    de->size = log->buf_len;
+    return de;
+}
+
+/* BACKGROUND WRITER */
+
+// Full chunks are queued for a writer thread, which compresses them and
+// writes them out in order.  At most max_bufs chunk buffers exist (the one
+// being filled included); when none is free the producer blocks.
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t cap;
+    uint32_t chunk; // directory index
+} RR_chunk_job;
+
+typedef struct RR_chunk_writer {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+
+    unsigned max_bufs;
+    unsigned num_bufs;  // allocated so far
+    RR_chunk_job *jobs; // ring of queued chunks
+    unsigned head;
+    unsigned count;
+    RR_chunk_job *spare; // written chunks whose buffers can be reused
+    unsigned num_spare;
+    bool stop;
+
+    uint64_t stalls;
+    uint8_t *zbuf; // owned by the writer thread
+    size_t zbuf_cap;
+} RR_chunk_writer;
+
+static void *rr_chunk_writer_main(void *opaque) {
+    RR_chunked_log *log = opaque;
+    RR_chunk_writer *w = log->writer;
+
+    pthread_mutex_lock(&w->lock);
+    for (;;) {
+        while (w->count == 0 && !w->stop) {
+            pthread_cond_wait(&w->cond, &w->lock);
+        }
+        if (w->count == 0) break;
+        RR_chunk_job job = w->jobs[w->head];
+        pthread_mutex_unlock(&w->lock);
+
+        uint64_t file_pos = ftell(log->fp);
+        uint32_t zsize = rr_chunked_compress(&w->zbuf, &w->zbuf_cap,
+                                             job.buf, job.len);
+        size_t n = fwrite(w->zbuf, 1, zsize, log->fp);
+        rr_chunk_check(n == zsize);
+
+        pthread_mutex_lock(&w->lock);
+        log->dir[job.chunk].file_pos = file_pos;
+        log->dir[job.chunk].zsize = zsize;
+        w->head = (w->head + 1) % w->max_bufs;
+        w->count--;
+        w->spare[w->num_spare++] = job;
+        pthread_cond_broadcast(&w->cond);
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+}
+
+// Hand the buffered chunk to the writer thread and, unless closing, get an
+// empty buffer to continue in.
+static void rr_chunk_writer_submit(RR_chunked_log *log, bool closing) {
+    RR_chunk_writer *w = log->writer;
+
+    pthread_mutex_lock(&w->lock);
+    rr_chunked_add_dir_entry(log);
+    RR_chunk_job *job = &w->jobs[(w->head + w->count) % w->max_bufs];
+    job->buf = log->buf;
+    job->len = log->buf_len;
+    job->cap = log->buf_cap;
+    job->chunk = log->num_chunks - 1;
+    w->count++;
+    pthread_cond_broadcast(&w->cond);
+
+    log->buf = NULL;
+    log->buf_cap = 0;
+    log->buf_len = 0;
+    if (!closing) {
+        if (w->num_spare == 0 && w->num_bufs == w->max_bufs) {
+            w->stalls++;
+            while (w->num_spare == 0) {
+                pthread_cond_wait(&w->cond, &w->lock);
+            }
+        }
+        if (w->num_spare > 0) {
+            RR_chunk_job *spare = &w->spare[--w->num_spare];
+            log->buf = spare->buf;
+            log->buf_cap = spare->cap;
+        } else {
+            w->num_bufs++;
+        }
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    if (!closing && log->buf == NULL) {
+        rr_chunked_reserve(&log->buf, &log->buf_cap, log->chunk_size);
+    }
+}
+
+void rr_chunked_start_writer(RR_chunked_log *log, unsigned max_bufs) {
+    assert(log->writing && log->writer == NULL && max_bufs >= 2);
+
+    RR_chunk_writer *w = g_new0(RR_chunk_writer, 1);
+    w->max_bufs = max_bufs;
+    w->num_bufs = 1; // log->buf
+    w->jobs = g_new0(RR_chunk_job, max_bufs);
+    w->spare = g_new0(RR_chunk_job, max_bufs);
+    pthread_mutex_init(&w->lock, NULL);
+    pthread_cond_init(&w->cond, NULL);
+    log->writer = w;
+    int ret = pthread_create(&w->thread, NULL, rr_chunk_writer_main, log);
+    if (ret != 0) {
+        // keep compressing and writing chunks on the calling thread
+        printf("RR: couldn't start the log writer thread, writing inline\n");
+        log->writer = NULL;
+        pthread_mutex_destroy(&w->lock);
+        pthread_cond_destroy(&w->cond);
+        g_free(w->jobs);
+        g_free(w->spare);
+        g_free(w);
+    }
+}
+
+uint64_t rr_chunked_writer_stalls(RR_chunked_log *log) {
+    RR_chunk_writer *w = log->writer;
+    if (!w) return 0;
+
+    pthread_mutex_lock(&w->lock);
+    uint64_t stalls = w->stalls;
+    pthread_mutex_unlock(&w->lock);
+    return stalls;
+}
+
+// Write out everything queued and stop the writer thread.
+static void rr_chunk_writer_finish(RR_chunked_log *log) {
+    RR_chunk_writer *w = log->writer;
+    unsigned i;
+
+    if (log->buf_len > 0) {
+        rr_chunk_writer_submit(log, true);
+    }
+    pthread_mutex_lock(&w->lock);
+    w->stop = true;
+    pthread_cond_broadcast(&w->cond);
+    pthread_mutex_unlock(&w->lock);
+    pthread_join(w->thread, NULL);
+
+    for (i = 0; i < w->num_spare; i++) {
+        g_free(w->spare[i].buf);
+    }
+    pthread_mutex_destroy(&w->lock);
+    pthread_cond_destroy(&w->cond);
+    g_free(w->jobs);
+    g_free(w->spare);
+    g_free(w->zbuf);
+    g_free(w);
+    log->writer = NULL;
+}
+
+// compress the buffered entries and append them as a new chunk
+static void rr_chunked_flush(RR_chunked_log *log) {
+    if (log->buf_len == 0) return;
+
+    if (log->writer) {
+        rr_chunk_writer_submit(log, false);
+        return;
+    }
+
+    RR_chunk_dir_entry *de = rr_chunked_add_dir_entry(log);
+    de->file_pos = ftell(log->fp);
+    de->zsize = rr_chunked_compress(&log->zbuf, &log->zbuf_cap,
+                                    log->buf, log->buf_len);
+    size_t n = fwrite(log->zbuf, 1, de->zsize, log->fp);
+    rr_chunk_check(n == de->zsize);
+    log->buf_len = 0;
+}
+
+void rr_chunked_begin_entry(RR_chunked_log *log, uint64_t instr) {
+    if (log->buf_len >= log->chunk_size) {
+        rr_chunked_flush(log);
+    }
+    if (log->buf_len == 0) {
+        log->entry_instr = instr;
+    }
+}
+
+void rr_chunked_write(RR_chunked_log *log, const void *ptr, size_t len) {
+    // entries never straddle chunks, so a big one just grows this chunk
+    rr_chunked_reserve(&log->buf, &log->buf_cap, log->buf_len + len);
+    memcpy(log->buf + log->buf_len, ptr, len);
+    log->buf_len += len;
+    log->offset += len;
+}
+
+/* READ */
+
+RR_chunked_log *rr_chunked_open_read(const char *path) {
+    uint8_t header[RR_CHUNK_HEADER_SIZE];
+    uint64_t magic, dir_pos;
+    uint32_t version;
+
+    FILE *fp = fopen(path, "r");
+    if (!fp) return NULL;
+    if (fread(header, sizeof(header), 1, fp) != 1) {
+        fclose(fp);
+        return NULL;
+    }
+    memcpy(&magic, header, 8);
+    memcpy(&version, header + 24, 4);
+    if (magic != RR_CHUNK_MAGIC || version != RR_CHUNK_VERSION) {
+        fclose(fp);
+        return NULL;
+    }
+
+    RR_chunked_log *log = g_new0(RR_chunked_log, 1);
+    log->fp = fp;
+    log->cur_chunk = -1;
+    memcpy(&log->last_instr, header + 8, 8);
+    memcpy(&dir_pos, header + 16, 8);
+    memcpy(&log->chunk_size, header + 28, 4);
+
+    // past the magic this is a v2 log, so a missing directory (e.g. from a
+    // crashed recording) is an error rather than a raw v1 stream
+    int ret = fseek(fp, dir_pos, SEEK_SET);
+    rr_chunk_check(ret == 0);
+    size_t n = fread(&log->num_chunks, sizeof(log->num_chunks), 1, fp);
+    rr_chunk_check(n == 1);
+    log->max_chunks = log->num_chunks;
+    log->dir = g_new(RR_chunk_dir_entry, log->num_chunks);
+    n = fread(log->dir, sizeof(RR_chunk_dir_entry), log->num_chunks, fp);
+    rr_chunk_check(n == log->num_chunks);
+
+    log->offset = log->num_chunks
+        ? log->dir[log->num_chunks - 1].start_offset +
+              log->dir[log->num_chunks - 1].size
+        : RR_V1_HEADER_SIZE;
+    return log;
+}
+
+uint64_t rr_chunked_size(RR_chunked_log *log) {
+    return log->offset;
+}
+
+// index of the last chunk whose start_offset is <= offset
+static uint32_t rr_chunked_find_offset(RR_chunked_log *log, uint64_t offset) {
+    uint32_t lo = 0, hi = log->num_chunks;
+    while (hi - lo > 1) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (log->dir[mid].start_offset <= offset) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void rr_chunked_load(RR_chunked_log *log, uint32_t i) {
+    RR_chunk_dir_entry *de = &log->dir[i];
+    if (log->cur_chunk == i) return;
+
+    rr_chunked_reserve(&log->zbuf, &log->zbuf_cap, de->zsize);
+    rr_chunked_reserve(&log->buf, &log->buf_cap, de->size);
+    fseek(log->fp, de->file_pos, SEEK_SET);
+    size_t n = fread(log->zbuf, 1, de->zsize, log->fp);
+    rr_chunk_check(n == de->zsize);
+
+    unsigned long size = de->size;
+    int ret = uncompress(log->buf, &size, log->zbuf, de->zsize);
+    rr_chunk_check(ret == Z_OK && size == de->size);
+    log->buf_len = size;
+    log->cur_chunk = i;
+}
+
+// Copy len bytes of the logical stream starting at offset into ptr.
+// Returns the number of bytes copied, short only at the end of the log.
+size_t rr_chunked_read(RR_chunked_log *log, uint64_t offset, void *ptr,
+                       size_t len) {
+    uint8_t *out = ptr;
+    size_t done = 0;
+
+    // the v1 header is synthesized from ours
+    while (done < len && offset < RR_V1_HEADER_SIZE) {
+        out[done++] = ((uint8_t *)&log->last_instr)[offset++];
+    }
+    while (done < len && offset < log->offset) {
+        if (log->cur_chunk < 0 ||
+                offset < log->dir[log->cur_chunk].start_offset ||
+                offset >= log->dir[log->cur_chunk].start_offset + log->buf_len) {
+            rr_chunked_load(log, rr_chunked_find_offset(log, offset));
+        }
+        uint64_t start = log->dir[log->cur_chunk].start_offset;
+        size_t n = MIN(len - done, start + log->buf_len - offset);
+        memcpy(out + done, log->buf + (offset - start), n);
+        done += n;
+        offset += n;
+    }
+    return done;
+}
+
+void rr_chunked_to_stream(RR_chunked_log *log, FILE *out) {
+    uint32_t i;
+
+    size_t n = fwrite(&log->last_instr, sizeof(log->last_instr), 1, out);
+    rr_chunk_check(n == 1);
+    for (i = 0; i < log->num_chunks; i++) {
+        rr_chunked_load(log, i);
+        n = fwrite(log->buf, 1, log->buf_len, out);
+        rr_chunk_check(n == log->buf_len);
+    }
+}
+
+void rr_chunked_close(RR_chunked_log *log) {
+    if (log->writing) {
+        if (log->writer) {
+            rr_chunk_writer_finish(log);
+        } else {
+            rr_chunked_flush(log);
+        }
+        uint64_t dir_pos = ftell(log->fp);
+        size_t n = fwrite(&log->num_chunks, sizeof(log->num_chunks), 1,
+                          log->fp);
+        rr_chunk_check(n == 1);
+        n = fwrite(log->dir, sizeof(RR_chunk_dir_entry), log->num_chunks,
+                   log->fp);
+        rr_chunk_check(n == log->num_chunks);
+        rr_chunked_write_header(log, dir_pos);
+    }
+    fclose(log->fp);
+    g_free(log->dir);
+    g_free(log->buf);
+    g_free(log->zbuf);
+    g_free(log);
+}
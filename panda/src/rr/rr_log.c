@@ -46,6 +46,7 @@
 #include "hmp.h"
 #include "panda/rr/rr_log.h"
 #include "panda/rr/rr_api.h"
+#include "panda/rr/rr_chunk.h"
 #include "panda/plugin.h"
 #include "migration/migration.h"
 #include "include/exec/address-spaces.h"
@@ -57,6 +58,8 @@
 #include "panda/callbacks/cb-support.h"
 #include "exec/gdbstub.h"
 #include "sysemu/cpus.h"
+#include "qemu/atomic.h"
+#include "qemu/thread.h"
 
 /******************************************************************************************/
 /* GLOBALS */
@@ -257,6 +260,10 @@ static inline void rr_assert_fail(const char* exp, const char* file, int line,
 /******************************************************************************************/
 
 static inline size_t rr_fwrite(void *ptr, size_t size, size_t nmemb) {
+    if (rr_nondet_log->chunked) {
+        rr_chunked_write(rr_nondet_log->chunked, ptr, size * nmemb);
+        return nmemb;
+    }
     size_t result = fwrite(ptr, size, nmemb, rr_nondet_log->fp);
     rr_assert(result == nmemb);
     return result;
@@ -270,6 +277,10 @@ static inline void rr_write_item(RR_log_entry item)
     rr_assert(rr_nondet_log != NULL);
 
 #define RR_WRITE_ITEM(field) rr_fwrite(&(field), sizeof(field), 1)
+    if (rr_nondet_log->chunked) {
+        rr_chunked_begin_entry(rr_nondet_log->chunked,
+                               item.header.prog_point.guest_instr_count);
+    }
     // keep replay format the same.
     RR_WRITE_ITEM(item.header.prog_point.guest_instr_count);
     rr_fwrite(&(item.header.kind), 1, 1);
@@ -657,6 +668,78 @@ static inline void rr_record_end_of_log(void) {
 /* REPLAY */
 /******************************************************************************************/
 
+// Payload buffers of skipped calls come from power-of-two size classes and
+// are recycled through a single producer / single consumer free list per
+// class: free_entry_params (cpu thread) puts them back and rr_decode_item
+// (prefetch thread, or cpu thread when not prefetching) takes them.
+#define RR_SLAB_MIN_SHIFT 6
+#define RR_SLAB_CLASSES 12 // 64 bytes .. 128 KB
+#define RR_SLAB_FREE_LEN 1024
+
+typedef union {
+    unsigned cls;
+    uint64_t align[2];
+} RR_slab_hdr;
+
+typedef struct {
+    RR_slab_hdr *slots[RR_SLAB_FREE_LEN];
+    unsigned put;
+    unsigned take;
+} RR_slab_free_list;
+
+static RR_slab_free_list rr_slab_free_lists[RR_SLAB_CLASSES];
+
+static void *rr_slab_alloc(size_t len) {
+    unsigned cls = 0;
+    while (cls < RR_SLAB_CLASSES && ((size_t)1 << (cls + RR_SLAB_MIN_SHIFT)) < len) {
+        cls++;
+    }
+
+    RR_slab_hdr *hdr;
+    if (cls < RR_SLAB_CLASSES) {
+        RR_slab_free_list *fl = &rr_slab_free_lists[cls];
+        unsigned take = fl->take;
+        if (take != atomic_load_acquire(&fl->put)) {
+            hdr = fl->slots[take % RR_SLAB_FREE_LEN];
+            atomic_store_release(&fl->take, take + 1);
+        } else {
+            hdr = g_malloc(sizeof(*hdr) + ((size_t)1 << (cls + RR_SLAB_MIN_SHIFT)));
+        }
+    } else {
+        hdr = g_malloc(sizeof(*hdr) + len);
+    }
+    hdr->cls = cls;
+    return hdr + 1;
+}
+
+static void rr_slab_free(void *buf) {
+    if (!buf) return;
+
+    RR_slab_hdr *hdr = (RR_slab_hdr *)buf - 1;
+    if (hdr->cls < RR_SLAB_CLASSES) {
+        RR_slab_free_list *fl = &rr_slab_free_lists[hdr->cls];
+        unsigned put = fl->put;
+        if (put - atomic_load_acquire(&fl->take) < RR_SLAB_FREE_LEN) {
+            fl->slots[put % RR_SLAB_FREE_LEN] = hdr;
+            atomic_store_release(&fl->put, put + 1);
+            return;
+        }
+    }
+    g_free(hdr);
+}
+
+// Release every recycled buffer. Only call with the prefetch thread stopped.
+static void rr_slab_drain(void) {
+    unsigned cls;
+    for (cls = 0; cls < RR_SLAB_CLASSES; cls++) {
+        RR_slab_free_list *fl = &rr_slab_free_lists[cls];
+        while (fl->take != fl->put) {
+            g_free(fl->slots[fl->take % RR_SLAB_FREE_LEN]);
+            fl->take++;
+        }
+    }
+}
+
 static inline void free_entry_params(RR_log_entry* entry)
 {
     // mz cleanup associated resources
@@ -664,19 +747,19 @@ static inline void free_entry_params(RR_log_entry* entry)
     case RR_SKIPPED_CALL:
         switch (entry->variant.call_args.kind) {
         case RR_CALL_CPU_MEM_RW:
-            g_free(entry->variant.call_args.variant.cpu_mem_rw_args.buf);
+            rr_slab_free(entry->variant.call_args.variant.cpu_mem_rw_args.buf);
             entry->variant.call_args.variant.cpu_mem_rw_args.buf = NULL;
             break;
         case RR_CALL_CPU_MEM_UNMAP:
-            g_free(entry->variant.call_args.variant.cpu_mem_unmap.buf);
+            rr_slab_free(entry->variant.call_args.variant.cpu_mem_unmap.buf);
             entry->variant.call_args.variant.cpu_mem_unmap.buf = NULL;
             break;
         case RR_CALL_CPU_REG_WRITE:
-            g_free(entry->variant.call_args.variant.cpu_reg_write_args.buf);
+            rr_slab_free(entry->variant.call_args.variant.cpu_reg_write_args.buf);
             entry->variant.call_args.variant.cpu_reg_write_args.buf = NULL;
             break;
         case RR_CALL_HANDLE_PACKET:
-            g_free(entry->variant.call_args.variant.handle_packet_args.buf);
+            rr_slab_free(entry->variant.call_args.variant.handle_packet_args.buf);
             entry->variant.call_args.variant.handle_packet_args.buf = NULL;
             break;
         default: break;
@@ -692,13 +775,26 @@ static inline void free_entry_params(RR_log_entry* entry)
     }
 }
 
-static inline size_t rr_fread(void *ptr, size_t size, size_t nmemb) {
-    size_t result = fread(ptr, size, nmemb, rr_nondet_log->fp);
-    rr_nondet_log->bytes_read += nmemb * size;
+// Read from offset *pos of the log, which for a v2 log is an offset into the
+// uncompressed stream (see rr_chunk.h).
+static inline size_t rr_fread_at(uint64_t *pos, void *ptr, size_t size,
+                                 size_t nmemb) {
+    size_t result;
+    if (rr_nondet_log->chunked) {
+        result = rr_chunked_read(rr_nondet_log->chunked, *pos, ptr,
+                                 size * nmemb) / size;
+    } else {
+        result = fread(ptr, size, nmemb, rr_nondet_log->fp);
+    }
+    *pos += nmemb * size;
     rr_assert(result == nmemb);
     return result;
 }
 
+static inline size_t rr_fread(void *ptr, size_t size, size_t nmemb) {
+    return rr_fread_at(&rr_nondet_log->bytes_read, ptr, size, nmemb);
+}
+
 static inline int rr_queue_size(void) {
     int distance = rr_queue_tail - rr_queue_head + 1 + RR_QUEUE_MAX_LEN;
     return distance % RR_QUEUE_MAX_LEN;
@@ -745,22 +841,17 @@ static inline void rr_queue_pop_front(void) {
     }
 }
 
-// Add an entry to the back of the queue.
-// Returns pointer to item just read.
-static RR_log_entry *rr_read_item(void) {
-    RR_log_entry *item = rr_queue_alloc_back();
-
-    rr_assert(rr_in_replay());
-    rr_assert(!rr_log_is_empty());
-    rr_assert(rr_nondet_log->fp != NULL);
+// Decode one entry at log offset *pos into item, advancing *pos past it.
+// Runs on the prefetch thread when it is enabled, so it must not touch
+// the queue or rr_nondet_log->bytes_read.
+static void rr_decode_item(uint64_t *pos, RR_log_entry *item) {
+    item->header.file_pos = *pos;
 
-    item->header.file_pos = rr_nondet_log->bytes_read;
-
-#define RR_READ_ITEM(field) rr_fread(&(field), sizeof(field), 1)
+#define RR_READ_ITEM(field) rr_fread_at(pos, &(field), sizeof(field), 1)
     // mz read header
     RR_READ_ITEM(item->header.prog_point.guest_instr_count);
-    rr_fread(&(item->header.kind), 1, 1);
-    rr_fread(&(item->header.callsite_loc), 1, 1);
+    rr_fread_at(pos, &(item->header.kind), 1, 1);
+    rr_fread_at(pos, &(item->header.callsite_loc), 1, 1);
 
     // mz read the rest of the item
     switch (item->header.kind) {
@@ -790,36 +881,36 @@ static RR_log_entry *rr_read_item(void) {
             break;
         case RR_SKIPPED_CALL: {
             RR_skipped_call_args* args = &item->variant.call_args;
-            rr_fread(&(args->kind), 1, 1);
+            rr_fread_at(pos, &(args->kind), 1, 1);
             switch (args->kind) {
                 case RR_CALL_CPU_MEM_RW:
                     RR_READ_ITEM(args->variant.cpu_mem_rw_args);
                     // mz buffer length in args->variant.cpu_mem_rw_args.len
                     args->variant.cpu_mem_rw_args.buf =
-                        g_malloc(args->variant.cpu_mem_rw_args.len);
+                        rr_slab_alloc(args->variant.cpu_mem_rw_args.len);
                     // mz read the buffer
-                    rr_fread(args->variant.cpu_mem_rw_args.buf, 1,
+                    rr_fread_at(pos, args->variant.cpu_mem_rw_args.buf, 1,
                             args->variant.cpu_mem_rw_args.len);
                     break;
                 case RR_CALL_CPU_MEM_UNMAP:
                     RR_READ_ITEM(args->variant.cpu_mem_unmap);
                     args->variant.cpu_mem_unmap.buf =
-                        g_malloc(args->variant.cpu_mem_unmap.len);
-                    rr_fread(args->variant.cpu_mem_unmap.buf, 1,
+                        rr_slab_alloc(args->variant.cpu_mem_unmap.len);
+                    rr_fread_at(pos, args->variant.cpu_mem_unmap.buf, 1,
                                 args->variant.cpu_mem_unmap.len);
                     break;
                 case RR_CALL_CPU_REG_WRITE:
                     RR_READ_ITEM(args->variant.cpu_reg_write_args);
                     args->variant.cpu_reg_write_args.buf =
-                        g_malloc(args->variant.cpu_reg_write_args.len);
-                    rr_fread(args->variant.cpu_reg_write_args.buf, 1,
+                        rr_slab_alloc(args->variant.cpu_reg_write_args.len);
+                    rr_fread_at(pos, args->variant.cpu_reg_write_args.buf, 1,
                                 args->variant.cpu_reg_write_args.len);
                     break;
                 case RR_CALL_MEM_REGION_CHANGE:
                     RR_READ_ITEM(args->variant.mem_region_change_args);
                     args->variant.mem_region_change_args.name =
                         g_malloc0(args->variant.mem_region_change_args.len + 1);
-                    rr_fread(args->variant.mem_region_change_args.name, 1,
+                    rr_fread_at(pos, args->variant.mem_region_change_args.name, 1,
                             args->variant.mem_region_change_args.len);
                     break;
                 case RR_CALL_HD_TRANSFER:
@@ -838,9 +929,9 @@ static RR_log_entry *rr_read_item(void) {
                     // mz always allocate a new one. we free it when the item is added
                     // to the recycle list
                     args->variant.handle_packet_args.buf =
-                        g_malloc(args->variant.handle_packet_args.size);
+                        rr_slab_alloc(args->variant.handle_packet_args.size);
                     // mz read the buffer
-                    rr_fread(args->variant.handle_packet_args.buf,
+                    rr_fread_at(pos, args->variant.handle_packet_args.buf,
                             args->variant.handle_packet_args.size, 1);
                     break;
                 case RR_CALL_SERIAL_RECEIVE:
@@ -868,9 +959,130 @@ static RR_log_entry *rr_read_item(void) {
             rr_assert(0 && "Unimplemented replay log entry!");
     }
 
+}
+#undef RR_READ_ITEM
+
+/* PREFETCH */
+
+// The prefetch thread decodes entries ahead of the cpu into a single
+// producer / single consumer ring.  The cpu thread only copies decoded
+// entries into rr_queue, so rr_fill_queue and get_next_entry behave exactly
+// as they do when reading synchronously.
+#define RR_PREFETCH_LEN 4096
+typedef struct {
+    RR_log_entry entry;
+    uint64_t size; // bytes the entry occupied in the log
+} RR_prefetch_slot;
+static RR_prefetch_slot rr_prefetch_ring[RR_PREFETCH_LEN];
+static unsigned rr_prefetch_put;  // written by prefetch thread only
+static unsigned rr_prefetch_take; // written by cpu thread only
+static uint64_t rr_prefetch_pos;  // file offset of the prefetch thread
+static bool rr_prefetch_stop;
+static bool rr_prefetch_running;
+static QemuThread rr_prefetch_thread;
+static QemuEvent rr_prefetch_data;  // an entry has been put
+static QemuEvent rr_prefetch_space; // an entry has been taken
+
+bool rr_prefetch_enabled = true;
+// number of times the cpu thread had to wait for the prefetch thread
+unsigned long long rr_prefetch_stalls;
+
+static void *rr_prefetch_main(void *opaque) {
+    while (rr_prefetch_pos < rr_nondet_log->size &&
+            !atomic_read(&rr_prefetch_stop)) {
+        unsigned put = rr_prefetch_put;
+        if (put - atomic_load_acquire(&rr_prefetch_take) == RR_PREFETCH_LEN) {
+            qemu_event_reset(&rr_prefetch_space);
+            if (put - atomic_load_acquire(&rr_prefetch_take) == RR_PREFETCH_LEN
+                    && !atomic_read(&rr_prefetch_stop)) {
+                qemu_event_wait(&rr_prefetch_space);
+            }
+            continue;
+        }
+
+        RR_prefetch_slot *slot = &rr_prefetch_ring[put % RR_PREFETCH_LEN];
+        memset(&slot->entry, 0, sizeof(slot->entry));
+        rr_decode_item(&rr_prefetch_pos, &slot->entry);
+        slot->size = rr_prefetch_pos - slot->entry.header.file_pos;
+        atomic_store_release(&rr_prefetch_put, put + 1);
+        qemu_event_set(&rr_prefetch_data);
+    }
+    return NULL;
+}
+
+// Start decoding from rr_nondet_log->bytes_read on a background thread.
+static void rr_prefetch_start(void) {
+    if (!rr_prefetch_enabled || rr_prefetch_running) return;
+
+    rr_prefetch_put = rr_prefetch_take = 0;
+    rr_prefetch_pos = rr_nondet_log->bytes_read;
+    rr_prefetch_stop = false;
+    qemu_event_init(&rr_prefetch_data, false);
+    qemu_event_init(&rr_prefetch_space, false);
+    rr_prefetch_running = true;
+    qemu_thread_create(&rr_prefetch_thread, "rr-prefetch", rr_prefetch_main,
+                       NULL, QEMU_THREAD_JOINABLE);
+}
+
+// Join the prefetch thread and drop anything it decoded that was never
+// consumed.  The file position is left wherever the thread stopped.
+static void rr_prefetch_finish(void) {
+    if (!rr_prefetch_running) return;
+
+    atomic_set(&rr_prefetch_stop, true);
+    qemu_event_set(&rr_prefetch_space);
+    qemu_thread_join(&rr_prefetch_thread);
+    while (rr_prefetch_take != rr_prefetch_put) {
+        free_entry_params(
+            &rr_prefetch_ring[rr_prefetch_take % RR_PREFETCH_LEN].entry);
+        rr_prefetch_take++;
+    }
+    qemu_event_destroy(&rr_prefetch_data);
+    qemu_event_destroy(&rr_prefetch_space);
+    rr_prefetch_running = false;
+}
+
+// Move the next decoded entry into item; returns its size in the log.
+static uint64_t rr_prefetch_take_item(RR_log_entry *item) {
+    unsigned take = rr_prefetch_take;
+    if (take == atomic_load_acquire(&rr_prefetch_put)) {
+        rr_prefetch_stalls++;
+        do {
+            qemu_event_reset(&rr_prefetch_data);
+            if (take == atomic_load_acquire(&rr_prefetch_put)) {
+                qemu_event_wait(&rr_prefetch_data);
+            }
+        } while (take == atomic_load_acquire(&rr_prefetch_put));
+    }
+
+    RR_prefetch_slot *slot = &rr_prefetch_ring[take % RR_PREFETCH_LEN];
+    uint64_t size = slot->size;
+    *item = slot->entry;
+    atomic_store_release(&rr_prefetch_take, take + 1);
+    qemu_event_set(&rr_prefetch_space);
+    return size;
+}
+
+// Add an entry to the back of the queue.
+// Returns pointer to item just read.
+static RR_log_entry *rr_read_item(void) {
+    RR_log_entry *item = rr_queue_alloc_back();
+    uint64_t size;
+
+    rr_assert(rr_in_replay());
+    rr_assert(!rr_log_is_empty());
+    rr_assert(rr_nondet_log->fp != NULL);
+
+    if (rr_prefetch_running) {
+        size = rr_prefetch_take_item(item);
+        rr_nondet_log->bytes_read = item->header.file_pos + size;
+    } else {
+        rr_decode_item(&rr_nondet_log->bytes_read, item);
+        size = rr_nondet_log->bytes_read - item->header.file_pos;
+    }
+
     // mz let's do some counting
-    rr_size_of_log_entries[item->header.kind] +=
-        rr_nondet_log->bytes_read - item->header.file_pos;
+    rr_size_of_log_entries[item->header.kind] += size;
     rr_number_of_log_entries[item->header.kind]++;
 
     return item;
@@ -1187,6 +1399,10 @@ void rr_replay_skipped_calls_internal(RR_callsite_id call_site)
 
 extern char* qemu_strdup(const char* str);
 
+// Chunk buffers the record writer may have in flight.  When all of them are
+// waiting to be written the cpu thread blocks until one is free.
+#define RR_RECORD_WRITE_BUFS 4
+
 // create record log
 void rr_create_record_log(const char* filename)
 {
@@ -1196,21 +1412,19 @@ void rr_create_record_log(const char* filename)
 
     rr_nondet_log->type = RECORD;
     rr_nondet_log->name = g_strdup(filename);
-    rr_nondet_log->fp = fopen(rr_nondet_log->name, "w");
-    rr_assert(rr_nondet_log->fp != NULL);
+    rr_nondet_log->chunked =
+        rr_chunked_open_write(rr_nondet_log->name, RR_CHUNK_DEFAULT_SIZE);
+    rr_assert(rr_nondet_log->chunked != NULL);
+    rr_nondet_log->fp = rr_nondet_log->chunked->fp;
+    // keep compression and disk writes off the cpu thread
+    rr_chunked_start_writer(rr_nondet_log->chunked, RR_RECORD_WRITE_BUFS);
 
     if (rr_debug_whisper()) {
         qemu_log("opened %s for write.\n", rr_nondet_log->name);
     }
     // mz It would be very handy to know how "far" we are in a particular replay
-    // execution.  To do this, let's store a header in the log (we'll fill it in
-    // again when we close the log) that includes the maximum instruction
-    // count as a monotonicly increasing measure of progress.
-    // This way, when we print progress, we can use something better than size
-    // of log consumed
-    //(as that can jump //sporadically).
-    rr_fwrite(&(rr_nondet_log->last_prog_point.guest_instr_count),
-            sizeof(rr_nondet_log->last_prog_point.guest_instr_count), 1);
+    // execution.  The v2 header carries the maximum instruction count as a
+    // monotonicly increasing measure of progress; rr_destroy_log fills it in.
 }
 
 // create replay log
@@ -1223,12 +1437,19 @@ void rr_create_replay_log(const char* filename)
 
     rr_nondet_log->type = REPLAY;
     rr_nondet_log->name = g_strdup(filename);
-    rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
-    rr_assert(rr_nondet_log->fp != NULL);
+    // logs written before the chunked format are a raw stream
+    rr_nondet_log->chunked = rr_chunked_open_read(rr_nondet_log->name);
+    if (rr_nondet_log->chunked) {
+        rr_nondet_log->fp = rr_nondet_log->chunked->fp;
+        rr_nondet_log->size = rr_chunked_size(rr_nondet_log->chunked);
+    } else {
+        rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
+        rr_assert(rr_nondet_log->fp != NULL);
 
-    // mz fill in log size
-    stat(rr_nondet_log->name, &statbuf);
-    rr_nondet_log->size = statbuf.st_size;
+        // mz fill in log size
+        stat(rr_nondet_log->name, &statbuf);
+        rr_nondet_log->size = statbuf.st_size;
+    }
     rr_nondet_log->bytes_read = 0;
     if (rr_debug_whisper()) {
         qemu_log("opened %s for read.  len=%llu bytes.\n", rr_nondet_log->name,
@@ -1237,18 +1458,46 @@ void rr_create_replay_log(const char* filename)
     // mz read the last program point from the log header.
     rr_fread(&(rr_nondet_log->last_prog_point.guest_instr_count),
             sizeof(rr_nondet_log->last_prog_point.guest_instr_count), 1);
+
+    rr_prefetch_stalls = 0;
+    rr_prefetch_start();
+}
+
+// Reposition replay at byte offset pos of the log, e.g. when restoring a
+// checkpoint.  Anything already queued or prefetched is discarded.
+void rr_replay_seek(uint64_t pos)
+{
+    bool prefetch = rr_prefetch_running;
+
+    rr_prefetch_finish();
+    while (!rr_queue_empty()) {
+        rr_queue_pop_front();
+    }
+    rr_nondet_log->bytes_read = pos;
+    if (!rr_nondet_log->chunked) {
+        fseek(rr_nondet_log->fp, pos, SEEK_SET);
+    }
+    if (prefetch) {
+        rr_prefetch_start();
+    }
 }
 
 // close file and free associated memory
 void rr_destroy_log(void)
 {
-    if (rr_nondet_log->fp) {
+    if (rr_nondet_log->type == REPLAY) {
+        rr_prefetch_finish();
+        rr_slab_drain();
+    }
+    if (rr_nondet_log->chunked) {
         // mz if in record, update the header with the last written prog point.
-        if (rr_nondet_log->type == RECORD) {
-            rewind(rr_nondet_log->fp);
-            rr_fwrite(&(rr_nondet_log->last_prog_point.guest_instr_count),
-                    sizeof(rr_nondet_log->last_prog_point.guest_instr_count), 1);
-        }
+        rr_nondet_log->chunked->last_instr =
+            rr_nondet_log->last_prog_point.guest_instr_count;
+        rr_chunked_close(rr_nondet_log->chunked);
+        rr_nondet_log->chunked = NULL;
+        rr_nondet_log->fp = NULL;
+    } else if (rr_nondet_log->fp) {
+        // replay of a raw (v1) log
         fclose(rr_nondet_log->fp);
         rr_nondet_log->fp = NULL;
     }
@@ -1281,7 +1530,7 @@ void replay_progress(void)
                 *(dot - 10) = '\0';
 
             printf("%s:  %10" PRIu64
-                   " (%6.2f%%) instrs. %7.2f sec. %5.2f GB ram.\n",
+                   " (%6.2f%%) instrs. %7.2f sec. %5.2f GB ram.",
                    name, rr_get_guest_instr_count(),
                    ((rr_get_guest_instr_count() * 100.0) /
                     rr_nondet_log->last_prog_point.guest_instr_count),
@@ -1290,6 +1539,10 @@ void replay_progress(void)
                    / 1024.0
 #endif
                    );
+            if (rr_prefetch_running) {
+                printf(" %llu log stalls.", rr_prefetch_stalls);
+            }
+            printf("\n");
             free(dup_name);
         }
     }
@@ -1490,6 +1743,8 @@ void rr_do_end_record(void)
     if (!panda_library_mode)  {
       printf("Time taken was: %ld seconds.\n", rr_end_time - rr_start_time);
       printf("Checksum of guest memory: %#08x\n", rr_checksum_memory_internal());
+      printf("Log writer stalls: %" PRIu64 "\n",
+             rr_chunked_writer_stalls(rr_nondet_log->chunked));
     }
 
     // log_all_cpu_states();
@@ -1620,6 +1875,9 @@ void rr_do_end_replay(int is_error)
           rr_size_of_log_entries[i] = 0;
       }
       printf("max_queue_len = %llu\n", rr_max_num_queue_entries);
+      if (rr_prefetch_enabled) {
+          printf("prefetch stalls = %llu\n", rr_prefetch_stalls);
+      }
       printf("Checksum of guest memory: %#08x\n", rr_checksum_memory_internal());
     }
     rr_max_num_queue_entries = 0;
@@ -1642,6 +1900,9 @@ void rr_do_end_replay(int is_error)
     rr_destroy_log();
     // turn off replay
     rr_control.mode = RR_OFF;
+    // TBs translated during replay check rr_chain_budget, which nothing
+    // refreshes outside replay, so they mustn't outlive it
+    tb_flush(first_cpu);
 
     rr_replay_complete = true;
 
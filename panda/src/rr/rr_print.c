@@ -6,6 +6,7 @@
 
 #define RR_LOG_STANDALONE
 #include "panda/include/panda/rr/rr_log.h"
+#include "panda/include/panda/rr/rr_chunk.h"
 #include "qemu/osdep.h"
 #include "cpu.h"
 
@@ -307,19 +308,99 @@ void rr_create_replay_log (const char *filename) {
 
   rr_nondet_log->type = REPLAY;
   rr_nondet_log->name = g_strdup(filename);
-  rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
-  assert(rr_nondet_log->fp != NULL);
+  RR_chunked_log *v2 = rr_chunked_open_read(rr_nondet_log->name);
+  if (v2) {
+    // a v2 log is read through its uncompressed (v1) stream
+    rr_nondet_log->fp = tmpfile();
+    assert(rr_nondet_log->fp != NULL);
+    rr_chunked_to_stream(v2, rr_nondet_log->fp);
+    rr_nondet_log->size = rr_chunked_size(v2);
+    rr_chunked_close(v2);
+    rewind(rr_nondet_log->fp);
+  } else {
+    rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
+    assert(rr_nondet_log->fp != NULL);
 
-  //mz fill in log size
-  stat(rr_nondet_log->name, &statbuf);
-  rr_nondet_log->size = statbuf.st_size;
+    //mz fill in log size
+    stat(rr_nondet_log->name, &statbuf);
+    rr_nondet_log->size = statbuf.st_size;
+  }
   fprintf (stdout, "opened %s for read.  len=%llu bytes.\n",
      rr_nondet_log->name, rr_nondet_log->size);
   //mz read the last program point from the log header.
   assert(fread(&(rr_nondet_log->last_prog_point), sizeof(RR_prog_point), 1, rr_nondet_log->fp) == 1);
 }
 
+static void rr_destroy_replay_log(void) {
+    fclose(rr_nondet_log->fp);
+    g_free(rr_nondet_log->name);
+    g_free(rr_nondet_log);
+    rr_nondet_log = NULL;
+}
+
+// Rewrite a nondet log (either version) as a chunked v2 log.
+static void rr_convert_to_v2(const char *in, const char *out) {
+    rr_create_replay_log(in);
+    RR_chunked_log *v2 = rr_chunked_open_write(out, RR_CHUNK_DEFAULT_SIZE);
+    assert(v2 != NULL);
+    GByteArray *raw = g_byte_array_new();
+    RR_log_entry *item = NULL;
+    while (!log_is_empty()) {
+        long start = ftell(rr_nondet_log->fp);
+        item = rr_read_item();
+        long end = ftell(rr_nondet_log->fp);
+
+        // copy the entry bytes verbatim
+        g_byte_array_set_size(raw, end - start);
+        fseek(rr_nondet_log->fp, start, SEEK_SET);
+        assert(fread(raw->data, 1, raw->len, rr_nondet_log->fp) == raw->len);
+        rr_chunked_begin_entry(v2, item->header.prog_point.guest_instr_count);
+        rr_chunked_write(v2, raw->data, raw->len);
+        free_entry_params(item);
+    }
+    v2->last_instr = rr_nondet_log->last_prog_point.guest_instr_count;
+    printf("wrote %s: %u chunks\n", out, v2->num_chunks);
+    rr_chunked_close(v2);
+    g_byte_array_free(raw, TRUE);
+    // rr_read_item hands out the same entry every time
+    g_free(item);
+    rr_destroy_replay_log();
+}
+
+// Rewrite a nondet log (either version) as a raw v1 log.
+static void rr_convert_to_v1(const char *in, const char *out) {
+    rr_create_replay_log(in);
+    FILE *fp = fopen(out, "w");
+    assert(fp != NULL);
+    char buf[1 << 16];
+    size_t n;
+    rewind(rr_nondet_log->fp);
+    while ((n = fread(buf, 1, sizeof(buf), rr_nondet_log->fp)) > 0) {
+        assert(fwrite(buf, 1, n, fp) == n);
+    }
+    fclose(fp);
+    printf("wrote %s\n", out);
+    rr_destroy_replay_log();
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s <nondet-log>\n"
+            "       %s -c <nondet-log> <new-nondet-log>   convert to chunked v2 format\n"
+            "       %s -x <nondet-log> <new-nondet-log>   convert to raw v1 format\n",
+            prog, prog, prog);
+    exit(1);
+}
+
 int main(int argc, char **argv) {
+    if (argc == 4 && !strcmp(argv[1], "-c")) {
+        rr_convert_to_v2(argv[2], argv[3]);
+        return 0;
+    } else if (argc == 4 && !strcmp(argv[1], "-x")) {
+        rr_convert_to_v1(argv[2], argv[3]);
+        return 0;
+    } else if (argc != 2) {
+        usage(argv[0]);
+    }
     rr_create_replay_log(argv[1]);
     printf("RR Log with %llu instructions\n", (unsigned long long) rr_nondet_log->last_prog_point.guest_instr_count);
     RR_log_entry *log_entry = NULL;
@@ -41,7 +41,12 @@ progress_fullout("random seed is %d" % seed)
 for binary in binaries:
     # ew -- ray this is grossssss
     with open(replaydir+"/%s-rr-nondet.log" % binary, 'rb') as f:
-        num_instrs = struct.unpack("<Q", f.read()[:8])
+        if f.read(8) == 'PANDARR2':
+            # chunked log: num_guest_insns follows the magic
+            pass
+        else:
+            f.seek(0)
+        num_instrs = struct.unpack("<Q", f.read(8))
         num_instrs = num_instrs[0]
 
 #    random.seed()
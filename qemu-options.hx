@@ -4167,10 +4167,24 @@ DEF("replay", HAS_ARG, QEMU_OPTION_replay,
     "-replay </path/to/snapshot-prefix>\n"
     "                replay the recording that starts at <snapshot>\n", QEMU_ARCH_ALL)
 
+DEF("replay-no-prefetch", 0, QEMU_OPTION_replay_no_prefetch,
+    "-replay-no-prefetch\n"
+    "                read the nondet log on the cpu thread during replay\n", QEMU_ARCH_ALL)
+
 DEF("pandalog", HAS_ARG, QEMU_OPTION_pandalog,
     "-pandalog <filename>\n"
     "                enable panda logging to file\n", QEMU_ARCH_ALL)
 
+DEF("pandalog-codec", HAS_ARG, QEMU_OPTION_pandalog_codec,
+    "-pandalog-codec <codec[:level]>\n"
+    "                compress pandalog chunks with none, zlib (default, level 9),\n"
+    "                zstd (level 3) or lz4 (level 0)\n", QEMU_ARCH_ALL)
+
+DEF("pandalog-threads", HAS_ARG, QEMU_OPTION_pandalog_threads,
+    "-pandalog-threads <n>\n"
+    "                compress pandalog chunks on n threads (default 2,\n"
+    "                0 compresses on the emulation thread)\n", QEMU_ARCH_ALL)
+
 DEF("panda-plugin", HAS_ARG, QEMU_OPTION_panda_plugin,
     "-panda-plugin <file>\n"
     "                load PANDA plugin from <file>\n", QEMU_ARCH_ALL)
@@ -4184,6 +4198,10 @@ DEF("panda", HAS_ARG, QEMU_OPTION_panda_plugins,
     "               load <plugin1> with <opt1=val1> and <opt2=val2>; load <plugin2>\n"
     "               uses qemubuilddir/panda_plugins/panda_%s.so by default\n", QEMU_ARCH_ALL)
 
+DEF("panda-cb-stats", 0, QEMU_OPTION_panda_cb_stats,
+    "-panda-cb-stats\n"
+    "                time PANDA callbacks and print per-callback totals at exit\n", QEMU_ARCH_ALL)
+
 DEF("os", HAS_ARG, QEMU_OPTION_panda_os_name,
     "-os os_name\n"
     "               inform panda about guest operating system\n", QEMU_ARCH_ALL)
@@ -131,7 +131,7 @@ WORD_TYPE helper_le_ld_name(CPUArchState *env, target_ulong addr,
     }
 
     /* Handle an IO access.  */
-    if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
+    if (unlikely(tlb_addr & ~(TARGET_PAGE_MASK | TLB_PANDA_WATCH))) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
             goto do_unaligned_access;
         }
@@ -199,7 +199,7 @@ WORD_TYPE helper_be_ld_name(CPUArchState *env, target_ulong addr,
     }
 
     /* Handle an IO access.  */
-    if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
+    if (unlikely(tlb_addr & ~(TARGET_PAGE_MASK | TLB_PANDA_WATCH))) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
             goto do_unaligned_access;
         }
@@ -290,7 +290,7 @@ void helper_le_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
     }
 
     /* Handle an IO access.  */
-    if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
+    if (unlikely(tlb_addr & ~(TARGET_PAGE_MASK | TLB_PANDA_WATCH))) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
             goto do_unaligned_access;
         }
@@ -366,7 +366,7 @@ void helper_be_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
     }
 
     /* Handle an IO access.  */
-    if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
+    if (unlikely(tlb_addr & ~(TARGET_PAGE_MASK | TLB_PANDA_WATCH))) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
             goto do_unaligned_access;
         }
@@ -423,10 +423,6 @@ WORD_TYPE glue(helper_le_ld_name, _panda)(CPUArchState *env, target_ulong addr,
     CPUState *cpu = ENV_GET_CPU(env);
     uintptr_t haddr = 0;
 
-    if ((addr & TARGET_PAGE_MASK) == tlb_addr) { // hit!
-        haddr = addr + env->tlb_table[mmu_idx][index].addend;
-    }
-
     /*
      * rwhelan: Hack to deal with the fact that we don't have the retaddr
      * available at the time when we are translating from TCG, retaddr is
@@ -436,6 +432,30 @@ WORD_TYPE glue(helper_le_ld_name, _panda)(CPUArchState *env, target_ulong addr,
         retaddr = GETPC();
     }
 
+    /* Only watched pages want callbacks; misses, IO and notdirty pages
+       come here too.  LLVM code always calls these helpers and keeps
+       calling back for everything.  */
+    if (!panda_use_memcb && !execute_llvm) {
+        if ((addr & TARGET_PAGE_MASK)
+             != (tlb_addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
+            if (!VICTIM_TLB_HIT(addr_read, addr)) {
+                tlb_fill(cpu, addr, READ_ACCESS_TYPE, mmu_idx, retaddr);
+            }
+            tlb_addr = env->tlb_table[mmu_idx][index].addr_read;
+        }
+        if (!(tlb_addr & TLB_PANDA_WATCH) ||
+            !panda_memcb_match(cpu, addr,
+                               env->iotlb[mmu_idx][index].panda_paddr
+                               + (addr & ~TARGET_PAGE_MASK),
+                               DATA_SIZE, false)) {
+            return helper_le_ld_name(env, addr, oi, retaddr);
+        }
+    }
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) { // hit!
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
     panda_callbacks_mem_before_read(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (void *)haddr);
     WORD_TYPE ret = helper_le_ld_name(env, addr, oi, retaddr);
     panda_callbacks_mem_after_read(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)ret, (void *)haddr);
@@ -452,10 +472,6 @@ void glue(helper_le_st_name, _panda)(CPUArchState *env, target_ulong addr,
     CPUState *cpu = ENV_GET_CPU(env);
     uintptr_t haddr = 0;
 
-    if ((addr & TARGET_PAGE_MASK) == tlb_addr) { // hit!
-        haddr = addr + env->tlb_table[mmu_idx][index].addend;
-    }
-
     /*
      * rwhelan: Hack to deal with the fact that we don't have the retaddr
      * available at the time when we are translating from TCG, retaddr is
@@ -465,6 +481,31 @@ void glue(helper_le_st_name, _panda)(CPUArchState *env, target_ulong addr,
         retaddr = GETPC();
     }
 
+    /* Only watched pages want callbacks; misses, IO and notdirty pages
+       come here too.  LLVM code always calls these helpers and keeps
+       calling back for everything.  */
+    if (!panda_use_memcb && !execute_llvm) {
+        if ((addr & TARGET_PAGE_MASK)
+             != (tlb_addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
+            if (!VICTIM_TLB_HIT(addr_write, addr)) {
+                tlb_fill(cpu, addr, MMU_DATA_STORE, mmu_idx, retaddr);
+            }
+            tlb_addr = env->tlb_table[mmu_idx][index].addr_write;
+        }
+        if (!(tlb_addr & TLB_PANDA_WATCH) ||
+            !panda_memcb_match(cpu, addr,
+                               env->iotlb[mmu_idx][index].panda_paddr
+                               + (addr & ~TARGET_PAGE_MASK),
+                               DATA_SIZE, true)) {
+            helper_le_st_name(env, addr, val, oi, retaddr);
+            return;
+        }
+    }
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) { // hit!
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
     panda_callbacks_mem_before_write(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)val, (void *)haddr);
     helper_le_st_name(env, addr, val, oi, retaddr);
     panda_callbacks_mem_after_write(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)val, (void *)haddr);
@@ -480,10 +521,6 @@ WORD_TYPE glue(helper_be_ld_name, _panda)(CPUArchState *env, target_ulong addr,
     CPUState *cpu = ENV_GET_CPU(env);
     uintptr_t haddr = 0;
 
-    if ((addr & TARGET_PAGE_MASK) == tlb_addr) { // hit!
-        haddr = addr + env->tlb_table[mmu_idx][index].addend;
-    }
-
     /*
      * rwhelan: Hack to deal with the fact that we don't have the retaddr
      * available at the time when we are translating from TCG, retaddr is
@@ -493,6 +530,30 @@ WORD_TYPE glue(helper_be_ld_name, _panda)(CPUArchState *env, target_ulong addr,
         retaddr = GETPC();
     }
 
+    /* Only watched pages want callbacks; misses, IO and notdirty pages
+       come here too.  LLVM code always calls these helpers and keeps
+       calling back for everything.  */
+    if (!panda_use_memcb && !execute_llvm) {
+        if ((addr & TARGET_PAGE_MASK)
+             != (tlb_addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
+            if (!VICTIM_TLB_HIT(addr_read, addr)) {
+                tlb_fill(cpu, addr, READ_ACCESS_TYPE, mmu_idx, retaddr);
+            }
+            tlb_addr = env->tlb_table[mmu_idx][index].addr_read;
+        }
+        if (!(tlb_addr & TLB_PANDA_WATCH) ||
+            !panda_memcb_match(cpu, addr,
+                               env->iotlb[mmu_idx][index].panda_paddr
+                               + (addr & ~TARGET_PAGE_MASK),
+                               DATA_SIZE, false)) {
+            return helper_be_ld_name(env, addr, oi, retaddr);
+        }
+    }
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) { // hit!
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
     panda_callbacks_mem_before_read(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (void *)haddr);
     WORD_TYPE ret = helper_be_ld_name(env, addr, oi, retaddr);
     panda_callbacks_mem_after_read(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)ret, (void *)haddr);
@@ -509,10 +570,6 @@ void glue(helper_be_st_name, _panda)(CPUArchState *env, target_ulong addr,
     CPUState *cpu = ENV_GET_CPU(env);
     uintptr_t haddr = 0;
 
-    if ((addr & TARGET_PAGE_MASK) == tlb_addr) { // hit!
-        haddr = addr + env->tlb_table[mmu_idx][index].addend;
-    }
-
     /*
      * rwhelan: Hack to deal with the fact that we don't have the retaddr
      * available at the time when we are translating from TCG, retaddr is
@@ -522,6 +579,31 @@ void glue(helper_be_st_name, _panda)(CPUArchState *env, target_ulong addr,
         retaddr = GETPC();
     }
 
+    /* Only watched pages want callbacks; misses, IO and notdirty pages
+       come here too.  LLVM code always calls these helpers and keeps
+       calling back for everything.  */
+    if (!panda_use_memcb && !execute_llvm) {
+        if ((addr & TARGET_PAGE_MASK)
+             != (tlb_addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
+            if (!VICTIM_TLB_HIT(addr_write, addr)) {
+                tlb_fill(cpu, addr, MMU_DATA_STORE, mmu_idx, retaddr);
+            }
+            tlb_addr = env->tlb_table[mmu_idx][index].addr_write;
+        }
+        if (!(tlb_addr & TLB_PANDA_WATCH) ||
+            !panda_memcb_match(cpu, addr,
+                               env->iotlb[mmu_idx][index].panda_paddr
+                               + (addr & ~TARGET_PAGE_MASK),
+                               DATA_SIZE, true)) {
+            helper_be_st_name(env, addr, val, oi, retaddr);
+            return;
+        }
+    }
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) { // hit!
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
     panda_callbacks_mem_before_write(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)val, (void *)haddr);
     helper_be_st_name(env, addr, val, oi, retaddr);
     panda_callbacks_mem_after_write(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)val, (void *)haddr);
@@ -38,6 +38,7 @@ static bool get_phys_addr_lpae(CPUARMState *env, target_ulong address,
 #endif
 
 #include "panda/callbacks/cb-support.h"
+#include "panda/common.h"
 
 static int vfp_gdb_get_reg(CPUARMState *env, uint8_t *buf, int reg)
 {
@@ -2590,6 +2591,8 @@ static void vmsa_ttbr_write(CPUARMState *env, const ARMCPRegInfo *ri,
 	// ret val !=0 means *dont* allow allow to change
 	if (0 == (panda_callbacks_asid_changed(ENV_GET_CPU(env), current_value, value))){
 		raw_write(env, ri, value);
+		// the TLB is tagged with the ASID, but PANDA's translations aren't
+		panda_v2p_cache_flush(ENV_GET_CPU(env));
 	}
 }
 
@@ -37,6 +37,7 @@
 #include "exec/log.h"
 
 #include "panda/callbacks/cb-support.h"
+#include "panda/callbacks/cb-dispatch.h"
 
 #ifdef CONFIG_SOFTMMU
 #include "panda/rr/rr_log.h"
@@ -11921,8 +11922,9 @@ void gen_intermediate_code(CPUARMState *env, TranslationBlock *tb)
 
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
-        // In LLVM mode we generate this more efficiently.
-        if ((rr_on() || panda_update_pc) && !generate_llvm) {
+        // In LLVM mode we generate this more efficiently, unless the TCG
+        // translation may be run in place of the LLVM one.
+        if (((rr_on() || panda_update_pc) && !generate_llvm) || panda_llvm_bypass) {
             gen_op_update_panda_pc(dc->pc);
             gen_op_update_rr_icount();
         }
@@ -11946,8 +11948,11 @@ void gen_intermediate_code(CPUARMState *env, TranslationBlock *tb)
         }
 
         // PANDA: ask if anyone wants execution notification
-        if (unlikely(panda_callbacks_insn_translate(cs, dc->pc))) {
-            // PANDA: Insert the instrumentation
+        if (unlikely(panda_cb_any(PANDA_CB_INSN_TRANSLATE) &&
+                     panda_callbacks_insn_translate(cs, dc->pc))) {
+            // PANDA: Insert the instrumentation, leaving a precise pc so the
+            // callback can restart execution here
+            gen_set_pc_im(dc, dc->pc);
             gen_helper_panda_insn_exec(tcg_const_tl(dc->pc));
         }
 
@@ -11967,7 +11972,8 @@ void gen_intermediate_code(CPUARMState *env, TranslationBlock *tb)
             disas_arm_insn(dc, insn);
         }
 
-        if (unlikely(panda_callbacks_after_insn_translate(cs, dc->pc))
+        if (unlikely(panda_cb_any(PANDA_CB_AFTER_INSN_TRANSLATE) &&
+                     panda_callbacks_after_insn_translate(cs, dc->pc))
                 && !dc->is_jmp) {
             gen_helper_panda_after_insn_exec(tcg_const_tl(dc->pc));
         }
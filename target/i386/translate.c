@@ -33,6 +33,7 @@ extern bool panda_update_pc;
 #endif
 
 #include "panda/callbacks/cb-support.h"
+#include "panda/callbacks/cb-dispatch.h"
 
 #include "exec/helper-proto.h"
 #include "exec/helper-gen.h"
@@ -8535,23 +8536,28 @@ generate_debug:
 
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
-        // In LLVM mode we generate this more efficiently.
-        if ((rr_on() || panda_update_pc) && !generate_llvm) {
+        // In LLVM mode we generate this more efficiently, unless the TCG
+        // translation may be run in place of the LLVM one.
+        if (((rr_on() || panda_update_pc) && !generate_llvm) || panda_llvm_bypass) {
             gen_op_update_panda_pc(pc_ptr);
             gen_op_update_rr_icount();
         }
 #endif
 
         // PANDA: ask if anyone wants execution notification
-        if (unlikely(panda_callbacks_insn_translate(ENV_GET_CPU(env), pc_ptr))) {
+        if (unlikely(panda_cb_any(PANDA_CB_INSN_TRANSLATE) &&
+                     panda_callbacks_insn_translate(ENV_GET_CPU(env), pc_ptr))) {
+            // Leave a precise eip so the callback can restart execution here
             gen_update_cc_op(dc);
+            gen_jmp_im(pc_ptr - dc->cs_base);
             gen_helper_panda_insn_exec(tcg_const_tl(pc_ptr));
         }
 
         pc_ptr = disas_insn(env, dc, pc_ptr);
         rr_updated_instr_count++;
 
-        if (unlikely(panda_callbacks_after_insn_translate(ENV_GET_CPU(env), pc_ptr))
+        if (unlikely(panda_cb_any(PANDA_CB_AFTER_INSN_TRANSLATE) &&
+                     panda_callbacks_after_insn_translate(ENV_GET_CPU(env), pc_ptr))
                 && !dc->is_jmp) {
             gen_helper_panda_after_insn_exec(tcg_const_tl(pc_ptr));
         }
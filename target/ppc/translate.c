@@ -34,6 +34,7 @@
 #include "exec/log.h"
 
 #include "panda/callbacks/cb-support.h"
+#include "panda/callbacks/cb-dispatch.h"
 
 #ifdef CONFIG_SOFTMMU
 #include "panda/rr/rr_log.h"
@@ -7286,8 +7287,9 @@ void gen_intermediate_code(CPUPPCState *env, struct TranslationBlock *tb)
 
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
-        // In LLVM mode we generate this more efficiently.
-        if (rr_on() && !generate_llvm) {
+        // In LLVM mode we generate this more efficiently, unless the TCG
+        // translation may be run in place of the LLVM one.
+        if ((rr_on() && !generate_llvm) || panda_llvm_bypass) {
             gen_op_update_panda_pc(ctx.nip);
             gen_op_update_rr_icount();
         }
@@ -7347,8 +7349,11 @@ void gen_intermediate_code(CPUPPCState *env, struct TranslationBlock *tb)
         }
 
         // PANDA: ask if anyone wants execution notification
-        if (unlikely(panda_callbacks_insn_translate(cs, ctx.nip))) {
-            // PANDA: Insert the instrumentation
+        if (unlikely(panda_cb_any(PANDA_CB_INSN_TRANSLATE) &&
+                     panda_callbacks_insn_translate(cs, ctx.nip))) {
+            // PANDA: Insert the instrumentation, leaving a precise nip so the
+            // callback can restart execution here
+            gen_update_nip(&ctx, ctx.nip);
             gen_helper_panda_insn_exec(tcg_const_tl(ctx.nip));
         }
 
@@ -7357,7 +7362,8 @@ void gen_intermediate_code(CPUPPCState *env, struct TranslationBlock *tb)
         handler->count++;
 #endif
 
-        if (unlikely(panda_callbacks_after_insn_translate(cs, ctx.nip))) {
+        if (unlikely(panda_cb_any(PANDA_CB_AFTER_INSN_TRANSLATE) &&
+                     panda_callbacks_after_insn_translate(cs, ctx.nip))) {
             gen_helper_panda_after_insn_exec(tcg_const_tl(ctx.nip));
         }
 
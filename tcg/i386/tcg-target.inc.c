@@ -1215,6 +1215,7 @@ static void tcg_out_nopn(TCGContext *s, int n)
 
 #if defined(CONFIG_SOFTMMU)
 extern bool panda_use_memcb;
+extern bool panda_memcb_watching;
 
 /* helper signature: helper_ret_ld_mmu(CPUState *env, target_ulong addr,
  *                                     int mmu_idx, uintptr_t ra)
@@ -1238,8 +1239,11 @@ static void * const qemu_ld_helpers_panda[16] = {
     [MO_BEUL] = helper_be_ldul_mmu_panda,
     [MO_BEQ]  = helper_be_ldq_mmu_panda,
 };
+/* With watches the TLB fast path stays inline; watched pages carry
+   TLB_PANDA_WATCH and so miss into the _panda helpers.  */
 #define qemu_ld_helpers \
-    (panda_use_memcb ? qemu_ld_helpers_panda : qemu_ld_helpers_normal)
+    ((panda_use_memcb || panda_memcb_watching) ? \
+     qemu_ld_helpers_panda : qemu_ld_helpers_normal)
 
 /* helper signature: helper_ret_st_mmu(CPUState *env, target_ulong addr,
  *                                     uintxx_t val, int mmu_idx, uintptr_t ra)
@@ -1264,7 +1268,8 @@ static void * const qemu_st_helpers_panda[16] = {
     [MO_BEQ]  = helper_be_stq_mmu_panda,
 };
 #define qemu_st_helpers \
-    (panda_use_memcb ? qemu_st_helpers_panda : qemu_st_helpers_normal)
+    ((panda_use_memcb || panda_memcb_watching) ? \
+     qemu_st_helpers_panda : qemu_st_helpers_normal)
 
 /* Perform the TLB load and compare.
 
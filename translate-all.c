@@ -1775,7 +1775,10 @@ static TranslationBlock *tb_find_pc(uintptr_t tc_ptr)
                 return tb;
             }
         }
-        return NULL;
+        /* with panda_llvm_bypass we may be in the TCG translation */
+        if (!panda_llvm_bypass) {
+            return NULL;
+        }
     }
 #endif
 
@@ -153,12 +153,16 @@ extern bool panda_load_plugin(const char *, const char *);
 extern void panda_unload_plugins(void);
 extern char *panda_plugin_path(const char *name);
 extern void panda_set_os_name(char *os_name);
+extern bool panda_cb_profiling;
 extern void panda_callbacks_after_machine_init(CPUState *);
 extern void panda_callbacks_pre_shutdown(void);
 extern void panda_callbacks_main_loop_wait(void);
 extern void pandalog_cc_init_write(const char * fname);
+extern bool pandalog_cc_set_codec(const char *spec);
+extern void pandalog_cc_set_threads(unsigned n);
 
 int pandalog = 0;
+static const char *pandalog_name = NULL;
 int panda_in_main_loop = 0;
 extern bool panda_abort_requested; // When set, we exit in after printing a help message
 bool panda_break_vl_loop_req = false; // When set, we break the main loop in vl.c
@@ -4234,10 +4238,23 @@ int main_aux(int argc, char **argv, char **envp, PandaMainMode pmm)
                 display_type = DT_NONE;
                 replay_name = optarg;
                 break;
+            case QEMU_OPTION_replay_no_prefetch:
+                rr_prefetch_enabled = false;
+                break;
             case QEMU_OPTION_pandalog:
-                pandalog = 1;
-                pandalog_cc_init_write(optarg);
-                printf ("pandalogging to [%s]\n", optarg);
+                // opened once all options are parsed, so the codec and
+                // thread options can come in any order
+                pandalog_name = optarg;
+                break;
+            case QEMU_OPTION_pandalog_codec:
+                if (!pandalog_cc_set_codec(optarg)) {
+                    error_report("unknown or unsupported pandalog codec '%s'",
+                                 optarg);
+                    exit(1);
+                }
+                break;
+            case QEMU_OPTION_pandalog_threads:
+                pandalog_cc_set_threads(atoi(optarg));
                 break;
             case QEMU_OPTION_record_from:
                 record_name = optarg;
@@ -4301,6 +4318,9 @@ int main_aux(int argc, char **argv, char **envp, PandaMainMode pmm)
                     free(new_optarg);
                     break;
                 }
+            case QEMU_OPTION_panda_cb_stats:
+                panda_cb_profiling = true;
+                break;
             case QEMU_OPTION_panda_os_name:
             {
                 char *os_name = strdup(optarg);
@@ -4319,6 +4339,12 @@ int main_aux(int argc, char **argv, char **envp, PandaMainMode pmm)
      */
     loc_set_none();
 
+    if (pandalog_name) {
+        pandalog = 1;
+        pandalog_cc_init_write(pandalog_name);
+        printf ("pandalogging to [%s]\n", pandalog_name);
+    }
+
     // Now that all arguments are available, we can load plugins
     int pp_idx;
     for (pp_idx = 0; pp_idx < nb_panda_plugins; pp_idx++) {